@@ -107,6 +107,7 @@ protected:
     virtual std::string handleDisconnectButtonClicked();
     virtual std::string handleExecuteCommand(std::string_view command);
     virtual std::string handleSendInput(std::string_view text);
+    virtual std::string handleSendPaste(std::string_view text);
     virtual std::string handleResize(int cols, int rows);
     virtual std::string handleRequestCompletion(std::string_view text, int cursorPosition);
     virtual std::string handleRequestReconnect(std::string_view address);
@@ -142,6 +143,11 @@ protected:
     virtual void handleWebSocketEvent(const WebSocketClientController::ErrorEvent& errorEvent);
     
 private:
+    /**
+     * Move server subscription to session (unsubscribes from previous one)
+     * @param sessionId session to receive live updates of
+     */
+    void subscribeToSession(uint64_t sessionId);
     
     bool initialized = false;
     
@@ -168,6 +174,9 @@ private:
     
     // Active session ID (0 = no session selected)
     uint64_t activeSessionId = 0;
+    
+    // Session the server routes live updates of to this client (0 = none)
+    uint64_t subscribedSessionId = 0;
 };
 
 // Simple C++ API (uses global instance)
@@ -118,6 +118,7 @@ void ClientCoreController::shutdown() {
     this->lastEvent.clear();
     this->serverAddress.clear();
     this->activeSessionId = 0;
+    this->subscribedSessionId = 0;
     this->initialized = false;
 }
 
@@ -151,6 +152,8 @@ std::string ClientCoreController::sendMessage(std::string_view message) {
             return setResponse(this->handleExecuteCommand(j.at("command").get<std::string>()));
         } else if (type == "sendInput") {
             return setResponse(this->handleSendInput(j.at("text").get<std::string>()));
+        } else if (type == "sendPaste") {
+            return setResponse(this->handleSendPaste(j.at("text").get<std::string>()));
         } else if (type == "resize") {
             return setResponse(this->handleResize(j.at("cols").get<int>(), j.at("rows").get<int>()));
         } else if (type == "requestCompletion") {
@@ -344,6 +347,23 @@ std::string ClientCoreController::handleSendInput(std::string_view text) {
     return "";
 }
 
+std::string ClientCoreController::handleSendPaste(std::string_view text) {
+    fmt::print("ClientCoreController: Send paste: {} bytes\n", text.size());
+    
+    if (!this->webSocketController || !this->webSocketController->isConnected()) {
+        return "Not connected to server";
+    }
+    
+    if (this->activeSessionId == 0) {
+        return "No active session";
+    }
+    
+    InputMessage message{this->activeSessionId, std::string(text), true};
+    this->webSocketController->send(serialize(message));
+    
+    return "";
+}
+
 std::string ClientCoreController::handleResize(int cols, int rows) {
     fmt::print("ClientCoreController: Resize: {}x{}\n", cols, rows);
     
@@ -414,8 +434,9 @@ std::string ClientCoreController::handleSwitchSession(uint64_t sessionId) {
         this->clientStorage->setUInt64(KEY_LAST_SESSION_ID, sessionId);
     }
     
-    // Request history for new session
+    // Receive live updates of new session only, then request its history
     if (this->webSocketController && this->webSocketController->isConnected()) {
+        this->subscribeToSession(sessionId);
         this->webSocketController->send(serialize(GetHistoryMessage{sessionId}));
     }
     
@@ -582,6 +603,17 @@ void ClientCoreController::update() {
     }
 }
 
+void ClientCoreController::subscribeToSession(uint64_t sessionId) {
+    if (sessionId == this->subscribedSessionId) {
+        return;
+    }
+    if (this->subscribedSessionId != 0) {
+        this->webSocketController->send(serialize(UnsubscribeMessage{this->subscribedSessionId}));
+    }
+    this->webSocketController->send(serialize(SubscribeMessage{sessionId}));
+    this->subscribedSessionId = sessionId;
+}
+
 // WebSocket event handlers (called from main thread via update())
 
 void ClientCoreController::handleWebSocketEvent(const WebSocketClientController::OpenEvent&) {
@@ -643,7 +675,8 @@ void ClientCoreController::handleWebSocketEvent(const WebSocketClientController:
                 // Add active session id to event data for UI
                 serverData["active_session_id"] = selectedId;
                 
-                // Request history for selected session
+                // Receive live updates of selected session, request its history
+                this->subscribeToSession(selectedId);
                 this->webSocketController->send(serialize(GetHistoryMessage{selectedId}));
             }
         } else if (messageType == "session_created") {
@@ -653,6 +686,7 @@ void ClientCoreController::handleWebSocketEvent(const WebSocketClientController:
             if (this->clientStorage) {
                 this->clientStorage->setUInt64(KEY_LAST_SESSION_ID, sessionId);
             }
+            this->subscribeToSession(sessionId);
             fmt::print("ClientCoreController: Session created and activated: {}\n", sessionId);
         } else if (messageType == "session_closed") {
             uint64_t sessionId = serverData.at("session_id").get<uint64_t>();
@@ -783,6 +817,7 @@ void ClientCoreController::handleWebSocketEvent(const WebSocketClientController:
                std::hash<std::thread::id>{}(std::this_thread::get_id()));
     
     this->activeSessionId = 0;
+    this->subscribedSessionId = 0;  // Server drops subscriptions with the connection
     
     this->pushEvent(json{
         {"type", "connectionStateChanged"},
@@ -197,6 +197,11 @@ class SceneDelegate: UIResponder, UIWindowSceneDelegate {
                 terminalVC?.appendOutput(outputData)
             }
             
+        case "output_skipped":
+            guard isActiveSession(messageDict) else { break }
+            let count = messageDict["count"] as? Int ?? 0
+            terminalVC?.appendOutput("[\(count) lines skipped, see history]\n")
+            
         case "history":
             if let commandsData = messageDict["commands"] {
                 do {
@@ -119,6 +119,36 @@ struct StyledSegmentShared: Codable {
 struct ScreenRowUpdateShared: Codable {
     let row: Int
     let segments: [StyledSegmentShared]
+    /// First updated cell; nil means the segments replace the whole row
+    let column: Int?
+    
+    /// Apply update to the current contents of the row
+    func applied(to line: [StyledSegmentShared]) -> [StyledSegmentShared] {
+        guard let column = column else { return segments }
+        
+        // Cells are unicode scalars: split the old row around the updated range
+        let length = segments.reduce(0) { $0 + $1.text.unicodeScalars.count }
+        var result: [StyledSegmentShared] = []
+        var suffix: [StyledSegmentShared] = []
+        var position = 0
+        for segment in line {
+            let scalars = Array(segment.text.unicodeScalars)
+            let start = position
+            position += scalars.count
+            if start < column {
+                let prefix = scalars[0..<min(scalars.count, column - start)]
+                result.append(StyledSegmentShared(text: String(String.UnicodeScalarView(prefix)), style: segment.style))
+            }
+            if position > column + length {
+                let tail = scalars[max(0, column + length - start)...]
+                suffix.append(StyledSegmentShared(text: String(String.UnicodeScalarView(tail)), style: segment.style))
+            }
+        }
+        if position < column {
+            result.append(StyledSegmentShared(text: String(repeating: " ", count: column - position), style: SegmentStyleShared()))
+        }
+        return result + segments + suffix
+    }
 }
 
 /// Command history record received from server
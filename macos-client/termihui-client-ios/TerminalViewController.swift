@@ -336,7 +336,7 @@ class TerminalViewController: UIViewController {
         }
         
         for update in updates {
-            commandBlocks[idx].activeScreenLines[update.row] = update.segments
+            commandBlocks[idx].activeScreenLines[update.row] = update.applied(to: commandBlocks[idx].activeScreenLines[update.row])
         }
         
         let indexPath = IndexPath(row: idx, section: 0)
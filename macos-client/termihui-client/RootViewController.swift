@@ -269,6 +269,11 @@ class RootViewController: NSViewController {
                 terminalViewController.appendOutput(outputData)
             }
             
+        case "output_skipped":
+            guard isActiveSession(messageDict) else { break }
+            let count = messageDict["count"] as? Int ?? 0
+            terminalViewController.appendOutput("[\(count) lines skipped, see history]\n")
+            
         case "status":
             if let running = messageDict["running"] as? Bool,
                let exitCode = messageDict["exit_code"] as? Int {
@@ -448,6 +453,9 @@ class RootViewController: NSViewController {
         case "screen_diff":
             handleScreenDiff(messageDict)
             
+        case "screen_scroll":
+            handleScreenScroll(messageDict)
+            
         case "interactive_mode_end":
             print("🖥️ Interactive mode end")
             terminalViewController.exitInteractiveMode()
@@ -526,6 +534,17 @@ class RootViewController: NSViewController {
         }
     }
     
+    private func handleScreenScroll(_ messageDict: [String: Any]) {
+        guard let top = messageDict["top"] as? Int,
+              let bottom = messageDict["bottom"] as? Int,
+              let count = messageDict["count"] as? Int else {
+            print("❌ screen_scroll missing fields: \(messageDict)")
+            return
+        }
+        
+        terminalViewController.handleScreenScroll(top: top, bottom: bottom, count: count)
+    }
+    
     private func determineInitialState() {
         guard !initialStateDetermined else { return }
         guard clientCore != nil else { return } // Need clientCore to proceed
@@ -143,7 +143,7 @@ extension TerminalViewController {
         if event.modifierFlags.contains(.command), let chars = event.charactersIgnoringModifiers, chars.lowercased() == "v" {
             if isCommandRunning || isInteractiveMode {
                 if let pasteString = NSPasteboard.general.string(forType: .string) {
-                    sendRawInput(pasteString)
+                    sendRawInput(pasteString, paste: true)
                 }
                 return
             }
@@ -923,7 +923,7 @@ class TerminalViewController: NSViewController, NSGestureRecognizerDelegate {
             while commandBlocks[idx].activeScreenLines.count <= update.row {
                 commandBlocks[idx].activeScreenLines.append([])
             }
-            commandBlocks[idx].activeScreenLines[update.row] = update.segments
+            commandBlocks[idx].activeScreenLines[update.row] = update.applied(to: commandBlocks[idx].activeScreenLines[update.row])
         }
         
         reloadBlock(at: idx)
@@ -1044,7 +1044,8 @@ class TerminalViewController: NSViewController, NSGestureRecognizerDelegate {
     }
     
     /// Sends raw input to PTY via WebSocket
-    func sendRawInput(_ text: String) {
+    /// Pasted text is marked so the server can wrap it in bracketed paste markers
+    func sendRawInput(_ text: String, paste: Bool = false) {
         // Local echo for printable characters and newlines - ONLY in non-interactive mode
         // In interactive mode, the app handles its own display via screen_diff
         if !isInteractiveMode {
@@ -1058,7 +1059,7 @@ class TerminalViewController: NSViewController, NSGestureRecognizerDelegate {
             // Don't echo control characters (Ctrl+C, escape sequences, etc.)
         }
         
-        clientCore?.send(["type": "sendInput", "text": text])
+        clientCore?.send(["type": paste ? "sendPaste" : "sendInput", "text": text])
     }
     
     // MARK: - Interactive Mode (Full Terminal Emulation)
@@ -1183,6 +1184,22 @@ class TerminalViewController: NSViewController, NSGestureRecognizerDelegate {
         renderInteractiveScreen()
     }
     
+    /// Handle screen scroll: shift rows top...bottom locally, rows scrolled in arrive with the next diff
+    func handleScreenScroll(top: Int, bottom: Int, count: Int) {
+        guard isInteractiveMode, top >= 0, top <= bottom, bottom < interactiveScreenLines.count else { return }
+        
+        let shift = min(abs(count), bottom - top + 1)
+        var region = Array(interactiveScreenLines[top...bottom])
+        if count > 0 {
+            region.removeFirst(shift)
+            region.append(contentsOf: Array(repeating: [], count: shift))
+        } else {
+            region.removeLast(shift)
+            region.insert(contentsOf: Array(repeating: [], count: shift), at: 0)
+        }
+        interactiveScreenLines.replaceSubrange(top...bottom, with: region)
+    }
+    
     /// Handle screen diff (partial update)
     func handleScreenDiff(updates: [ScreenRowUpdate], cursorRow: Int, cursorColumn: Int) {
         guard isInteractiveMode else { return }
@@ -1190,7 +1207,7 @@ class TerminalViewController: NSViewController, NSGestureRecognizerDelegate {
         // Apply updates
         for update in updates {
             if update.row < interactiveScreenLines.count {
-                interactiveScreenLines[update.row] = update.segments
+                interactiveScreenLines[update.row] = update.applied(to: interactiveScreenLines[update.row])
             }
         }
         
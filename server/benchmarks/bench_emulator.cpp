@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "corpora.h"
+#include "../src/AnsiProcessor.h"
+
+using namespace termihui;
+
+namespace {
+
+/**
+ * Measure feeding corpus to a processor on a screen of given size (screen set up once)
+ */
+void measureProcess(Catch::Benchmark::Chronometer meter, const std::string& corpus, size_t rows, size_t columns) {
+    VirtualScreen screen(rows, columns);
+    AnsiProcessor processor(screen);
+    meter.measure([&] {
+        auto events = processor.process(corpus);
+        screen.clearDirtyRows();
+        screen.takeScrolledOffRows();
+        return events.size();
+    });
+}
+
+} // anonymous namespace
+
+TEST_CASE("AnsiProcessor throughput", "[benchmark][AnsiProcessor]") {
+    const std::string lsListing = corpora::lsListing(5000);
+    const std::string compilerLog = corpora::compilerLog(2000);
+    const std::string htopFrames = corpora::htopFrames(60, 50, 200);
+    const std::string colorGradient = corpora::colorGradient(50, 200);
+
+    BENCHMARK_ADVANCED("process ls -la")(Catch::Benchmark::Chronometer meter) {
+        measureProcess(meter, lsListing, 50, 200);
+    };
+
+    BENCHMARK_ADVANCED("process compiler log")(Catch::Benchmark::Chronometer meter) {
+        measureProcess(meter, compilerLog, 50, 200);
+    };
+
+    BENCHMARK_ADVANCED("process htop frames")(Catch::Benchmark::Chronometer meter) {
+        measureProcess(meter, htopFrames, 50, 200);
+    };
+
+    BENCHMARK_ADVANCED("process 24-bit gradient")(Catch::Benchmark::Chronometer meter) {
+        measureProcess(meter, colorGradient, 50, 200);
+    };
+}
+
+TEST_CASE("VirtualScreen hot paths", "[benchmark][VirtualScreen]") {
+    VirtualScreen screen(50, 200);
+    AnsiProcessor processor(screen);
+    processor.process(corpora::compilerLog(100));
+
+    BENCHMARK("scroll full screen") {
+        screen.scroll(1);
+        screen.clearDirtyRows();
+        screen.takeScrolledOffRows();
+        return screen.cursorRow();
+    };
+
+    // Scrolling above left a blank screen: fill it again before reading rows
+    processor.process(corpora::compilerLog(100));
+    processor.process(corpora::colorGradient(10, 200));
+
+    BENCHMARK("getRowSegments all rows") {
+        size_t segments = 0;
+        for (size_t row = 0; row < screen.rows(); ++row) {
+            segments += screen.getRowSegments(row).size();
+        }
+        return segments;
+    };
+
+    BENCHMARK("getRowText all rows") {
+        size_t bytes = 0;
+        for (size_t row = 0; row < screen.rows(); ++row) {
+            bytes += screen.getRowText(row).size();
+        }
+        return bytes;
+    };
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "corpora.h"
+#include "../src/AnsiProcessor.h"
+#include <termihui/protocol/protocol.h>
+
+using namespace termihui;
+
+TEST_CASE("Protocol serialization", "[benchmark][protocol]") {
+    VirtualScreen screen(50, 200);
+    AnsiProcessor processor(screen);
+    processor.process(corpora::compilerLog(100));
+
+    BlockScreenUpdateMessage message;
+    message.sessionId = 1;
+    message.cursorRow = screen.cursorRow();
+    message.cursorColumn = screen.cursorColumn();
+    std::vector<EncodedRowUpdate> encodedUpdates;
+    for (size_t row = 0; row < screen.rows(); ++row) {
+        message.updates.push_back(ScreenRowUpdate{row, screen.getRowSegments(row)});
+        encodedUpdates.push_back(EncodedRowUpdate{row, encodeSegments(message.updates.back().segments)});
+    }
+
+    BENCHMARK("serialize BlockScreenUpdateMessage") {
+        return serialize(message).size();
+    };
+
+    BENCHMARK("serialize BlockScreenUpdateMessage pre-encoded rows") {
+        return serialize(message, encodedUpdates).size();
+    };
+
+    BENCHMARK("encodeSegments all rows") {
+        size_t bytes = 0;
+        for (const auto& update : message.updates) {
+            bytes += encodeSegments(update.segments).size();
+        }
+        return bytes;
+    };
+}
+
+TEST_CASE("Protocol parsing", "[benchmark][protocol]") {
+    const std::string input = serialize(InputMessage{1, "ls -la --color=auto\r", false});
+    const std::string paste = serialize(InputMessage{1, corpora::lsListing(50), true});
+    const std::string resize = serialize(ResizeMessage{1, 200, 50});
+
+    BENCHMARK("parseClientMessage input") {
+        return parseClientMessage(input).index();
+    };
+
+    BENCHMARK("parseClientMessage large paste") {
+        return parseClientMessage(paste).index();
+    };
+
+    BENCHMARK("parseClientMessage resize") {
+        return parseClientMessage(resize).index();
+    };
+}
@@ -0,0 +1,55 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "corpora.h"
+#include "../src/AnsiProcessor.h"
+#include "../src/ScrollbackBuffer.h"
+#include "../src/SessionStorage.h"
+#include <termihui/protocol/protocol.h>
+#include <filesystem>
+
+using namespace termihui;
+
+TEST_CASE("Output line storage", "[benchmark][storage]") {
+    // Rendered lines the way they scroll off: styled segments, and their JSON for SQLite
+    VirtualScreen screen(50, 200);
+    AnsiProcessor processor(screen);
+    processor.process(corpora::compilerLog(100));
+    std::vector<std::vector<StyledSegment>> lines;
+    std::vector<std::string> encodedLines;
+    for (size_t row = 0; row < screen.rows(); ++row) {
+        lines.push_back(screen.getRowSegments(row));
+        encodedLines.push_back(encodeSegments(lines.back()));
+    }
+
+    std::filesystem::path dbPath = std::filesystem::temp_directory_path() / "termihui_benchmark_session.db";
+    std::filesystem::remove(dbPath);
+    {
+        SessionStorage storage(dbPath);
+        storage.initialize();
+        uint64_t commandId = storage.addCommand(1, "make", "/tmp");
+        size_t next = 0;
+
+        BENCHMARK("SessionStorage::addOutputLine") {
+            storage.addOutputLine(commandId, encodedLines[next++ % encodedLines.size()]);
+            return next;
+        };
+    }
+    std::filesystem::remove(dbPath);
+
+    ScrollbackBuffer scrollback;
+    size_t next = 0;
+
+    BENCHMARK("ScrollbackBuffer::append") {
+        scrollback.append(1, lines[next++ % lines.size()]);
+        return scrollback.lineCount();
+    };
+
+    ScrollbackBuffer history;
+    for (size_t index = 0; index < 1000; ++index) {
+        history.append(2, lines[index % lines.size()]);
+    }
+
+    BENCHMARK("ScrollbackBuffer::commandLines 1000 lines") {
+        return history.commandLines(2)->size();
+    };
+}
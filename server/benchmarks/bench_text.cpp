@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "corpora.h"
+#include <termihui/unicode_width.h>
+#include <termihui/utf8.h>
+#include <string>
+
+using namespace termihui;
+
+namespace {
+
+/**
+ * Multi-byte decoder of AnsiProcessor before utf8.h (no overlong, surrogate or range
+ * checks), kept as the baseline for the shared decoder
+ */
+size_t decodeSequenceScalar(const char* data, size_t size, char32_t& codepoint) {
+    auto lead = static_cast<unsigned char>(data[0]);
+    size_t length;
+    if ((lead & 0xE0) == 0xC0) {
+        length = 2;
+        codepoint = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3;
+        codepoint = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4;
+        codepoint = lead & 0x07;
+    } else {
+        return 0;
+    }
+    if (length > size) {
+        return 0;
+    }
+    for (size_t i = 1; i < length; ++i) {
+        auto byte = static_cast<unsigned char>(data[i]);
+        if ((byte & 0xC0) != 0x80) {
+            return 0;
+        }
+        codepoint = (codepoint << 6) | (byte & 0x3F);
+    }
+    return length;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Unicode width lookup", "[benchmark][unicode]") {
+    std::u32string text;
+    for (int i = 0; i < 4096; ++i) {
+        text += U"ls -la \u0444\u0430\u0439\u043B \u65E5\u672C ";
+    }
+
+    BENCHMARK("width") {
+        int columns = 0;
+        for (char32_t codepoint : text) {
+            columns += unicode::width(codepoint);
+        }
+        return columns;
+    };
+
+    BENCHMARK("segmenter") {
+        unicode::GraphemeSegmenter segmenter;
+        size_t clusters = 0;
+        for (char32_t codepoint : text) {
+            clusters += segmenter.isBoundary(codepoint) ? 1 : 0;
+        }
+        return clusters;
+    };
+}
+
+TEST_CASE("UTF-8 decoding", "[benchmark][utf8]") {
+    const std::string text = corpora::lsListing(5000);
+    std::u32string codepoints;
+    codepoints.reserve(text.size());
+
+    BENCHMARK("bulk decode") {
+        codepoints.clear();
+        return utf8::decode(text, codepoints);
+    };
+
+    BENCHMARK("byte-wise decoder") {
+        utf8::Decoder decoder;
+        codepoints.clear();
+        for (char ch : text) {
+            char32_t codepoint = 0;
+            if (decoder.feed(static_cast<unsigned char>(ch), codepoint) == utf8::Decoder::Result::Complete) {
+                codepoints.push_back(codepoint);
+            }
+        }
+        return codepoints.size();
+    };
+
+    BENCHMARK("scalar decode (before utf8.h)") {
+        codepoints.clear();
+        size_t i = 0;
+        while (i < text.size()) {
+            auto byte = static_cast<unsigned char>(text[i]);
+            if (byte < 0x80) {
+                codepoints.push_back(byte);
+                ++i;
+                continue;
+            }
+            char32_t codepoint = 0;
+            size_t length = decodeSequenceScalar(text.data() + i, text.size() - i, codepoint);
+            if (length == 0) {
+                break;
+            }
+            codepoints.push_back(codepoint);
+            i += length;
+        }
+        return i;
+    };
+}
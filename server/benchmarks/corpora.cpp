@@ -0,0 +1,153 @@
+#include "corpora.h"
+#include <fmt/core.h>
+#include <cstdint>
+#include <iterator>
+
+namespace corpora {
+
+namespace {
+
+/**
+ * Small deterministic generator (xorshift), same sequence everywhere
+ */
+class Random {
+public:
+    explicit Random(uint32_t seed) : state(seed) {}
+
+    uint32_t next() {
+        this->state ^= this->state << 13;
+        this->state ^= this->state >> 17;
+        this->state ^= this->state << 5;
+        return this->state;
+    }
+
+    uint32_t below(uint32_t limit) { return this->next() % limit; }
+
+private:
+    uint32_t state;
+};
+
+const char* const fileStems[] = {
+    "main", "config", "README", "build", "server", "client", "utils", "test_session",
+    "VirtualScreen", "AnsiProcessor", "отчёт", "データ", "libhv", "Makefile", "notes", "archive",
+};
+
+const char* const fileExtensions[] = {".cpp", ".h", ".md", ".txt", ".json", ".tar.gz", "", ".sh"};
+
+const char* const months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+const char* const diagnosticTexts[] = {
+    "no matching function for call to 'process(std::string&, int)'",
+    "unused variable 'result' [-Wunused-variable]",
+    "comparison of integer expressions of different signedness: 'int' and 'size_t' [-Wsign-compare]",
+    "'class VirtualScreen' has no member named 'scrollRegion'",
+    "control reaches end of non-void function [-Wreturn-type]",
+};
+
+const char* const commands[] = {
+    "/usr/bin/termihui-server --port 37854", "postgres: checkpointer", "node /srv/app/index.js",
+    "/usr/lib/systemd/systemd-journald", "htop", "bash", "clang++ -std=c++20 -O2 -c VirtualScreen.cpp",
+};
+
+} // anonymous namespace
+
+std::string lsListing(size_t entries) {
+    Random random(1);
+    std::string out;
+    auto it = std::back_inserter(out);
+    fmt::format_to(it, "total {}\r\n", entries * 8);
+    for (size_t index = 0; index < entries; ++index) {
+        uint32_t kind = random.below(10);
+        const char* permissions = kind < 3 ? "drwxr-xr-x" : kind < 5 ? "-rwxr-xr-x" : kind < 6 ? "lrwxrwxrwx" : "-rw-r--r--";
+        const char* color = kind < 3 ? "01;34" : kind < 5 ? "01;32" : kind < 6 ? "01;36" : nullptr;
+        std::string name = fmt::format("{}_{}{}", fileStems[random.below(std::size(fileStems))], index,
+                                       kind < 3 ? "" : fileExtensions[random.below(std::size(fileExtensions))]);
+
+        fmt::format_to(it, "{} {:>3} developer staff {:>9} {} {:>2} {:02}:{:02} ", permissions, 1 + random.below(40),
+                       random.below(10000000), months[random.below(12)], 1 + random.below(28), random.below(24),
+                       random.below(60));
+        if (color) {
+            fmt::format_to(it, "\x1b[{}m{}\x1b[0m", color, name);
+        } else {
+            out += name;
+        }
+        if (kind == 5) {
+            fmt::format_to(it, " -> ../shared/{}", name);
+        }
+        out += "\r\n";
+    }
+    return out;
+}
+
+std::string compilerLog(size_t diagnostics) {
+    Random random(2);
+    std::string out;
+    auto it = std::back_inserter(out);
+    for (size_t index = 0; index < diagnostics; ++index) {
+        bool error = random.below(3) == 0;
+        uint32_t line = 1 + random.below(2000);
+        uint32_t column = 1 + random.below(60);
+        fmt::format_to(it, "\x1b[01m\x1b[Ksrc/{}.cpp:{}:{}:\x1b[m\x1b[K \x1b[01;{}m\x1b[K{}:\x1b[m\x1b[K {}\r\n",
+                       fileStems[random.below(8)], line, column, error ? 31 : 35, error ? "error" : "warning",
+                       diagnosticTexts[random.below(std::size(diagnosticTexts))]);
+        fmt::format_to(it, " {:>4} |     auto value = this->screen.process(data, \x1b[01;{}m\x1b[Kcount\x1b[m\x1b[K);\r\n",
+                       line, error ? 31 : 35);
+        fmt::format_to(it, "      | {:>{}}\x1b[01;32m\x1b[K^~~~~\x1b[m\x1b[K\r\n", "", column);
+    }
+    fmt::format_to(it, "make[2]: *** [CMakeFiles/termihui-server.dir/build.make:76] Error 1\r\n");
+    return out;
+}
+
+std::string htopFrames(size_t frames, size_t rows, size_t columns) {
+    Random random(3);
+    std::string out = "\x1b[?1049h\x1b[?25l\x1b[H\x1b[2J";
+    auto it = std::back_inserter(out);
+    size_t barWidth = columns / 2 - 12;
+    size_t meterRows = 4;
+    for (size_t frame = 0; frame < frames; ++frame) {
+        // CPU meters: bars of changing length in green / red
+        for (size_t cpu = 0; cpu < meterRows; ++cpu) {
+            size_t used = random.below(static_cast<uint32_t>(barWidth));
+            size_t kernel = used / 4;
+            fmt::format_to(it, "\x1b[{};3H\x1b[36m{:>2}\x1b[39m[\x1b[32m{:|<{}}\x1b[31m{:|<{}}\x1b[90m{:>{}.1f}%\x1b[39m]",
+                           cpu + 1, cpu, "", used - kernel, "", kernel, used * 100.0 / barWidth, barWidth - used + 5);
+        }
+        fmt::format_to(it, "\x1b[{};3H\x1b[36mTasks: \x1b[1m{}\x1b[22m, \x1b[32m{}\x1b[39m running\x1b[K",
+                       meterRows + 1, 180 + random.below(40), 1 + random.below(6));
+
+        // Header row in reverse video, then process rows
+        size_t headerRow = meterRows + 3;
+        fmt::format_to(it, "\x1b[{};1H\x1b[30;42m{:<{}}\x1b[0m", headerRow,
+                       "    PID USER      PRI  NI  VIRT   RES   SHR S CPU% MEM%   TIME+  Command", columns);
+        for (size_t row = headerRow + 1; row <= rows - 1; ++row) {
+            bool selected = row == headerRow + 1;
+            fmt::format_to(it, "\x1b[{};1H{}{:>7} developer  20   0 {:>5}M {:>5}M {:>5}M {} {:>4.1f} {:>4.1f} {:>2}:{:02}.{:02} {}\x1b[K{}",
+                           row, selected ? "\x1b[30;46m" : "", 1000 + random.below(90000), random.below(4000),
+                           random.below(900), random.below(100), random.below(8) == 0 ? 'R' : 'S',
+                           random.below(1000) / 10.0, random.below(300) / 10.0, random.below(60), random.below(60),
+                           random.below(100), commands[random.below(std::size(commands))], selected ? "\x1b[0m" : "");
+        }
+        fmt::format_to(it, "\x1b[{};1H\x1b[30;46mF1\x1b[39;49mHelp  \x1b[30;46mF2\x1b[39;49mSetup  "
+                           "\x1b[30;46mF10\x1b[39;49mQuit\x1b[K", rows);
+    }
+    out += "\x1b[?25h\x1b[?1049l";
+    return out;
+}
+
+std::string colorGradient(size_t rows, size_t columns) {
+    std::string out;
+    auto it = std::back_inserter(out);
+    for (size_t row = 0; row < rows; ++row) {
+        for (size_t column = 0; column < columns; ++column) {
+            unsigned red = static_cast<unsigned>(255 * column / columns);
+            unsigned green = static_cast<unsigned>(255 * row / rows);
+            unsigned blue = 255 - red;
+            fmt::format_to(it, "\x1b[48;2;{};{};{}m\x1b[38;2;{};{};{}m{}", red, green, blue, 255 - red, 255 - green,
+                           255 - blue, static_cast<char>('a' + column % 26));
+        }
+        out += "\x1b[0m\r\n";
+    }
+    return out;
+}
+
+} // namespace corpora
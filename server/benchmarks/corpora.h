@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Terminal output corpora for benchmarks
+ *
+ * Generated deterministically, shaped after what real programs write: the same bytes on
+ * every run and machine, so results of two runs can be compared.
+ */
+namespace corpora {
+
+/**
+ * `ls -la --color` of a large directory: permissions, sizes, dates, colored names
+ * (directories, executables, symlinks) and some non-ASCII file names
+ */
+std::string lsListing(size_t entries);
+
+/**
+ * Colored compiler diagnostics as GCC writes them: bold locations, red errors,
+ * magenta warnings, quoted source lines and green carets
+ */
+std::string compilerLog(size_t diagnostics);
+
+/**
+ * htop refresh frames: cursor-addressed meter bars and process rows, redrawn in place
+ * with changing numbers, on a screen of given size
+ */
+std::string htopFrames(size_t frames, size_t rows, size_t columns);
+
+/**
+ * 24-bit color gradient: every cell sets its own RGB background and foreground
+ */
+std::string colorGradient(size_t rows, size_t columns);
+
+} // namespace corpora
@@ -0,0 +1,58 @@
+#include <catch2/catch_test_case_info.hpp>
+#include <catch2/interfaces/catch_interfaces_reporter.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include <catch2/reporters/catch_reporter_streaming_base.hpp>
+#include <hv/json.hpp>
+#include <chrono>
+
+namespace {
+
+using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+/**
+ * Reporter writing all benchmark results of a run as one JSON document
+ *
+ * Meant to run next to the console reporter, e.g.
+ *   termihui_benchmarks --reporter console --reporter benchmark-json::out=results.json
+ * Times are in nanoseconds per run of the benchmark body.
+ */
+class BenchmarkJsonReporter : public Catch::StreamingReporterBase {
+public:
+    explicit BenchmarkJsonReporter(Catch::ReporterConfig&& config)
+        : StreamingReporterBase(std::move(config))
+    {
+    }
+
+    static std::string getDescription() {
+        return "Reports benchmark results as JSON (times in nanoseconds)";
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+        this->results.push_back({
+            {"test_case", this->currentTestCaseInfo ? this->currentTestCaseInfo->name : std::string()},
+            {"name", stats.info.name},
+            {"samples", stats.info.samples},
+            {"iterations", stats.info.iterations},
+            {"mean", Nanoseconds(stats.mean.point).count()},
+            {"mean_lower_bound", Nanoseconds(stats.mean.lower_bound).count()},
+            {"mean_upper_bound", Nanoseconds(stats.mean.upper_bound).count()},
+            {"standard_deviation", Nanoseconds(stats.standardDeviation.point).count()},
+            {"outlier_variance", stats.outlierVariance},
+        });
+    }
+
+    void testRunEnded(const Catch::TestRunStats& stats) override {
+        nlohmann::json report = {
+            {"benchmarks", std::move(this->results)},
+        };
+        this->m_stream << report.dump(2) << '\n';
+        StreamingReporterBase::testRunEnded(stats);
+    }
+
+private:
+    nlohmann::json results = nlohmann::json::array();
+};
+
+} // anonymous namespace
+
+CATCH_REGISTER_REPORTER("benchmark-json", BenchmarkJsonReporter)
@@ -0,0 +1,154 @@
+// Replays PTY recordings (see PtyRecording, server option --record) through the
+// block/interactive output pipeline, without a shell or network:
+//   termihui_replay session_1_run_3.ptyrec [more.ptyrec ...]
+// Per recording prints throughput, frames and bytes sent to clients, and a hash of the
+// final screen, so two builds can be compared for speed and for identical output.
+
+#include "TermihuiServerController.h"
+#include "PtyRecording.h"
+#include "Logger.h"
+#include "TerminalSessionControllerMock.h"
+#include "WebSocketServerMock.h"
+#include "AIAgentControllerMock.h"
+#include "ServerStorageMock.h"
+#include <termihui/protocol/protocol.h>
+#include <fmt/core.h>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+namespace {
+
+/**
+ * WebSocket server counting outgoing traffic instead of recording every call
+ * (recordings can be far larger than what a test keeps in memory)
+ */
+class CountingWebSocketServer : public WebSocketServerMock {
+public:
+    size_t messages = 0;
+    size_t bytesSent = 0;
+    size_t frames = 0;  // Screen updates and snapshots; scrolls belong to the diff that follows them
+
+    void sendMessage(int, std::string message) override {
+        this->count(message);
+    }
+
+    void broadcastMessage(std::string message) override {
+        this->count(message);
+    }
+
+    void sendSessionMessage(int, uint64_t, MessageClass messageClass, std::string message) override {
+        this->countSessionMessage(messageClass, message);
+    }
+
+    void broadcastSessionMessage(uint64_t, MessageClass messageClass, std::string message) override {
+        this->countSessionMessage(messageClass, message);
+    }
+
+private:
+    void count(const std::string& message) {
+        ++this->messages;
+        this->bytesSent += message.size();
+    }
+
+    void countSessionMessage(MessageClass messageClass, const std::string& message) {
+        this->count(message);
+        bool screenMessage = messageClass == MessageClass::ScreenUpdate || messageClass == MessageClass::ScreenSnapshot;
+        if (screenMessage && message.find("\"screen_scroll\"") == std::string::npos) {
+            ++this->frames;
+        }
+    }
+};
+
+/**
+ * FNV-1a over every row (segments with styles, as sent to clients) and the cursor
+ */
+uint64_t hashScreen(const termihui::VirtualScreen& screen) {
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](std::string_view bytes) {
+        for (char byte : bytes) {
+            hash = (hash ^ static_cast<uint8_t>(byte)) * 1099511628211ull;
+        }
+    };
+    for (size_t row = 0; row < screen.rows(); ++row) {
+        mix(encodeSegments(screen.getRowSegments(row)));
+        mix("\n");
+    }
+    mix(fmt::format("{},{}", screen.cursorRow(), screen.cursorColumn()));
+    return hash;
+}
+
+/**
+ * Replay one recording and print its results
+ * @return false if the recording can't be read
+ */
+bool replay(const char* path) {
+    PtyRecording::Reader reader;
+    if (!reader.open(path)) {
+        fmt::print(stderr, "Error: '{}' is not a readable PTY recording\n", path);
+        return false;
+    }
+
+    auto webSocketServer = std::make_unique<CountingWebSocketServer>();
+    CountingWebSocketServer* webSocketServerPointer = webSocketServer.get();
+    TermihuiServerController controller(std::move(webSocketServer), std::make_unique<AIAgentControllerMock>(),
+                                        std::make_unique<ServerStorageMock>());
+    TerminalSessionControllerMock session;
+    session.getVirtualScreen().resize(reader.rows(), reader.columns());
+
+    size_t outputBytes = 0;
+    size_t chunks = 0;
+    std::chrono::microseconds recordedDuration{};
+    std::chrono::steady_clock::duration processingTime{};
+    PtyRecording::Record record;
+    while (reader.next(record)) {
+        recordedDuration += record.delay;
+        if (record.kind == PtyRecording::Record::Kind::Resize) {
+            session.getVirtualScreen().resize(record.rows, record.columns);
+            continue;
+        }
+        outputBytes += record.bytes.size();
+        ++chunks;
+        session.readOutputReturnValues.push(std::move(record.bytes));
+        session.hasDataReturnValue = true;
+
+        auto start = std::chrono::steady_clock::now();
+        controller.processTerminalOutput(session);
+        processingTime += std::chrono::steady_clock::now() - start;
+
+        // Mock keeps every history call: drop them, only the screen and traffic matter here
+        session.calls.clear();
+    }
+
+    double seconds = std::chrono::duration<double>(processingTime).count();
+    double megabytesPerSecond = seconds > 0 ? static_cast<double>(outputBytes) / seconds / (1024 * 1024) : 0;
+    const auto& screen = session.getVirtualScreen();
+    fmt::print("{}\n", path);
+    fmt::print("  recorded:  {} bytes in {} chunks over {:.3f} s, screen {}x{}\n", outputBytes, chunks,
+               std::chrono::duration<double>(recordedDuration).count(), reader.columns(), reader.rows());
+    fmt::print("  replayed:  {:.3f} ms, {:.2f} MiB/s\n", seconds * 1000, megabytesPerSecond);
+    fmt::print("  sent:      {} frames, {} messages, {} bytes\n", webSocketServerPointer->frames,
+               webSocketServerPointer->messages, webSocketServerPointer->bytesSent);
+    fmt::print("  screen:    {}x{}, hash {:016x}\n", screen.columns(), screen.rows(), hashScreen(screen));
+    return true;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0) {
+        fmt::print("Usage: {} <recording.ptyrec>...\n", argv[0]);
+        fmt::print("Replays recordings made with termihui-server --record, frames unpaced\n");
+        return argc < 2 ? 1 : 0;
+    }
+
+    // Per-line logging would dominate the measurement
+    Logger::instance().configure("warn");
+
+    bool ok = true;
+    for (int i = 1; i < argc; ++i) {
+        ok = replay(argv[i]) && ok;
+    }
+    return ok ? 0 : 1;
+}
@@ -4,6 +4,8 @@
 #include <vector>
 #include <cstdint>
 
+class EventLoop;
+
 /**
  * Events returned by AIAgentController::update()
  */
@@ -61,6 +63,19 @@ public:
      */
     virtual std::vector<AIEvent> update() = 0;
     
+    /**
+     * Drive network transfers from the server event loop instead of polling
+     * Transfer sockets are registered with the loop; update() still collects events
+     * @param eventLoop loop owned by the caller, must outlive the controller's requests
+     */
+    virtual void attachEventLoop(EventLoop& eventLoop) = 0;
+    
+    /**
+     * Time until update() has to be called even without socket activity
+     * @return milliseconds (0 = immediately), -1 if nothing is pending
+     */
+    virtual int nextTimeoutMs() const = 0;
+    
     /**
      * Clear chat history for a session
      * @param sessionId Terminal session ID
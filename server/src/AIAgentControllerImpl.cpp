@@ -1,4 +1,6 @@
 #include "AIAgentControllerImpl.h"
+#include "EventLoop.h"
+#include "Logger.h"
 #include <hv/json.hpp>
 #include <fmt/core.h>
 #include <algorithm>
@@ -28,7 +30,7 @@ AIAgentControllerImpl::~AIAgentControllerImpl() {
 }
 
 void AIAgentControllerImpl::setEndpoint(std::string ep) {
-    fmt::print("AI: setEndpoint called with '{}'\n", ep);
+    LOG_DEBUG(LogCategory::Ai, "setEndpoint called with '{}'", ep);
     endpoint = std::move(ep);
 }
 
@@ -40,6 +42,70 @@ void AIAgentControllerImpl::setApiKey(std::string key) {
     apiKey = std::move(key);
 }
 
+void AIAgentControllerImpl::attachEventLoop(EventLoop& loop) {
+    eventLoop = &loop;
+    curl_multi_setopt(multiHandle, CURLMOPT_SOCKETFUNCTION, socketCallback);
+    curl_multi_setopt(multiHandle, CURLMOPT_SOCKETDATA, this);
+    curl_multi_setopt(multiHandle, CURLMOPT_TIMERFUNCTION, timerCallback);
+    curl_multi_setopt(multiHandle, CURLMOPT_TIMERDATA, this);
+}
+
+int AIAgentControllerImpl::socketCallback(CURL*, curl_socket_t socket, int what, void* userp, void*) {
+    auto* self = static_cast<AIAgentControllerImpl*>(userp);
+    if (what == CURL_POLL_REMOVE) {
+        self->eventLoop->unwatch(socket);
+        return 0;
+    }
+    
+    uint32_t events = 0;
+    if (what & CURL_POLL_IN) events |= EventLoop::Readable;
+    if (what & CURL_POLL_OUT) events |= EventLoop::Writable;
+    
+    if (self->eventLoop->isWatching(socket)) {
+        self->eventLoop->modify(socket, events);
+    } else {
+        self->eventLoop->watch(socket, events, [self, socket](uint32_t readyEvents) {
+            int actionFlags = 0;
+            if (readyEvents & EventLoop::Readable) actionFlags |= CURL_CSELECT_IN;
+            if (readyEvents & EventLoop::Writable) actionFlags |= CURL_CSELECT_OUT;
+            if (readyEvents & EventLoop::Hangup) actionFlags |= CURL_CSELECT_ERR;
+            int stillRunning = 0;
+            CURLMcode mc = curl_multi_socket_action(self->multiHandle, socket, actionFlags, &stillRunning);
+            if (mc != CURLM_OK) {
+                LOG_ERROR(LogCategory::Ai, "curl_multi_socket_action error: {}", curl_multi_strerror(mc));
+            }
+        });
+    }
+    return 0;
+}
+
+int AIAgentControllerImpl::timerCallback(CURLM*, long timeoutMs, void* userp) {
+    auto* self = static_cast<AIAgentControllerImpl*>(userp);
+    if (timeoutMs < 0) {
+        self->timerArmed = false;
+    } else {
+        self->timerArmed = true;
+        self->timerDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    }
+    return 0;
+}
+
+int AIAgentControllerImpl::nextTimeoutMs() const {
+    if (activeRequests.empty()) {
+        return -1;
+    }
+    if (!eventLoop) {
+        // Polling mode: curl_multi_perform needs regular calls while requests are active
+        return 10;
+    }
+    if (!timerArmed) {
+        return -1;
+    }
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        timerDeadline - std::chrono::steady_clock::now()).count();
+    return remaining > 0 ? static_cast<int>(remaining) : 0;
+}
+
 size_t AIAgentControllerImpl::writeCallback(char* ptr, size_t size, size_t nmemb, void* userdata) {
     size_t totalSize = size * nmemb;
     auto* req = static_cast<ActiveRequest*>(userdata);
@@ -87,7 +153,7 @@ std::string AIAgentControllerImpl::buildRequestBody(uint64_t sessionId, const st
 }
 
 void AIAgentControllerImpl::sendMessage(uint64_t sessionId, const std::string& message) {
-    fmt::print("AI: sendMessage called, endpoint='{}', model='{}'\n", endpoint, model);
+    LOG_DEBUG(LogCategory::Ai, "sendMessage called, endpoint='{}', model='{}'", endpoint, model);
     
     // Add user message to history
     chatHistory[sessionId].push_back({std::string("user"), std::string(message)});
@@ -100,7 +166,7 @@ void AIAgentControllerImpl::sendMessage(uint64_t sessionId, const std::string& m
     // Setup CURL handle
     CURL* handle = curl_easy_init();
     if (!handle) {
-        fmt::print(stderr, "Failed to create CURL handle\n");
+        LOG_ERROR(LogCategory::Ai, "Failed to create CURL handle");
         return;
     }
     
@@ -108,8 +174,8 @@ void AIAgentControllerImpl::sendMessage(uint64_t sessionId, const std::string& m
     
     // Build URL (store in ActiveRequest to keep it alive - CURL stores pointer only!)
     activeRequest->url = endpoint + "/v1/chat/completions";
-    fmt::print("AI: POST to {}\n", activeRequest->url);
-    fmt::print("AI: Request body: {}\n", activeRequest->postData);
+    LOG_INFO(LogCategory::Ai, "POST to {}", activeRequest->url);
+    LOG_TRACE(LogCategory::Ai, "Request body: {}", activeRequest->postData);
     
     // Setup headers
     activeRequest->headers = curl_slist_append(nullptr, "Content-Type: application/json");
@@ -134,13 +200,13 @@ void AIAgentControllerImpl::sendMessage(uint64_t sessionId, const std::string& m
     // Add to multi handle
     CURLMcode mc = curl_multi_add_handle(multiHandle, handle);
     if (mc != CURLM_OK) {
-        fmt::print(stderr, "AI: curl_multi_add_handle error: {}\n", curl_multi_strerror(mc));
+        LOG_ERROR(LogCategory::Ai, "curl_multi_add_handle error: {}", curl_multi_strerror(mc));
     }
     
     // Store request
     activeRequests[handle] = std::move(activeRequest);
     
-    fmt::print("AI: Started request for session {} (active requests: {})\n", sessionId, activeRequests.size());
+    LOG_INFO(LogCategory::Ai, "Started request for session {} (active requests: {})", sessionId, activeRequests.size());
 }
 
 std::vector<AIEvent> AIAgentControllerImpl::parseSSEBuffer(ActiveRequest& activeRequest) {
@@ -178,7 +244,7 @@ std::vector<AIEvent> AIAgentControllerImpl::parseSSEBuffer(ActiveRequest& active
         // Parse SSE data line
         if (line.rfind("data: ", 0) == 0) {
             std::string data = line.substr(6);
-            fmt::print("AI: SSE data: {}\n", data);
+            LOG_TRACE(LogCategory::Ai, "SSE data: {}", data);
             
             // Check for stream end
             if (data == "[DONE]") {
@@ -198,14 +264,14 @@ std::vector<AIEvent> AIAgentControllerImpl::parseSSEBuffer(ActiveRequest& active
                 // Extract content delta from choices[0].delta.content
                 auto choicesIt = j.find("choices");
                 if (choicesIt == j.end() || choicesIt->empty()) {
-                    fmt::print(stderr, "AI: SSE response missing 'choices' array\n");
+                    LOG_ERROR(LogCategory::Ai, "SSE response missing 'choices' array");
                     continue;
                 }
                 
                 auto& choice = (*choicesIt)[0];
                 auto deltaIt = choice.find("delta");
                 if (deltaIt == choice.end()) {
-                    fmt::print(stderr, "AI: SSE response missing 'delta' in choice\n");
+                    LOG_ERROR(LogCategory::Ai, "SSE response missing 'delta' in choice");
                     continue;
                 }
                 
@@ -217,12 +283,12 @@ std::vector<AIEvent> AIAgentControllerImpl::parseSSEBuffer(ActiveRequest& active
                 
                 std::string content = contentIt->get<std::string>();
                 if (!content.empty()) {
-                    fmt::print("AI: Chunk content: '{}'\n", content);
+                    LOG_TRACE(LogCategory::Ai, "Chunk content: '{}'", content);
                     activeRequest.accumulatedContent += content;
                     events.push_back({AIEvent::Type::Chunk, activeRequest.sessionId, std::move(content)});
                 }
             } catch (const json::exception& e) {
-                fmt::print(stderr, "AI: JSON parse error: {}\n", e.what());
+                LOG_ERROR(LogCategory::Ai, "JSON parse error: {}", e.what());
             }
         }
     }
@@ -256,13 +322,24 @@ std::vector<AIEvent> AIAgentControllerImpl::update() {
         return events;
     }
     
-    // Perform multi operations
+    // Perform multi operations: socket activity is already handled by event loop callbacks,
+    // here we only fire expired curl timeouts. Without event loop, poll all transfers.
     int stillRunning = 0;
-    CURLMcode mc = curl_multi_perform(multiHandle, &stillRunning);
-    fmt::print("AI: update() - activeRequests={}, stillRunning={}, mc={}\n", 
-               activeRequests.size(), stillRunning, static_cast<int>(mc));
-    if (mc != CURLM_OK) {
-        fmt::print(stderr, "AI: curl_multi_perform error: {}\n", curl_multi_strerror(mc));
+    if (eventLoop) {
+        if (timerArmed && std::chrono::steady_clock::now() >= timerDeadline) {
+            timerArmed = false;
+            CURLMcode mc = curl_multi_socket_action(multiHandle, CURL_SOCKET_TIMEOUT, 0, &stillRunning);
+            if (mc != CURLM_OK) {
+                LOG_ERROR(LogCategory::Ai, "curl_multi_socket_action error: {}", curl_multi_strerror(mc));
+            }
+        }
+    } else {
+        CURLMcode mc = curl_multi_perform(multiHandle, &stillRunning);
+        LOG_TRACE(LogCategory::Ai, "update() - activeRequests={}, stillRunning={}, mc={}", 
+                  activeRequests.size(), stillRunning, static_cast<int>(mc));
+        if (mc != CURLM_OK) {
+            LOG_ERROR(LogCategory::Ai, "curl_multi_perform error: {}", curl_multi_strerror(mc));
+        }
     }
     
     // Process data from all active requests
@@ -286,14 +363,14 @@ std::vector<AIEvent> AIAgentControllerImpl::update() {
             auto it = activeRequests.find(handle);
             if (it != activeRequests.end()) {
                 uint64_t sessionId = it->second->sessionId;
-                fmt::print("AI: Request done - CURLcode={} ({}), URL='{}'\n", 
-                           static_cast<int>(result), curl_easy_strerror(result), it->second->url);
+                LOG_DEBUG(LogCategory::Ai, "Request done - CURLcode={} ({}), URL='{}'", 
+                          static_cast<int>(result), curl_easy_strerror(result), it->second->url);
                 
                 if (result != CURLE_OK) {
                     // Error occurred
                     std::string error = curl_easy_strerror(result);
                     events.push_back({AIEvent::Type::Error, sessionId, error});
-                    fmt::print(stderr, "AI: Request failed for session {}: {} (code {})\n", sessionId, error, static_cast<int>(result));
+                    LOG_ERROR(LogCategory::Ai, "Request failed for session {}: {} (code {})", sessionId, error, static_cast<int>(result));
                 } else {
                     // Check HTTP status code
                     long httpCode = 0;
@@ -302,7 +379,7 @@ std::vector<AIEvent> AIAgentControllerImpl::update() {
                     if (httpCode >= 400) {
                         std::string error = fmt::format("HTTP error {}", httpCode);
                         events.push_back({AIEvent::Type::Error, sessionId, error});
-                        fmt::print(stderr, "AI: HTTP error for session {}: {}\n", sessionId, httpCode);
+                        LOG_ERROR(LogCategory::Ai, "HTTP error for session {}: {}", sessionId, httpCode);
                     } else {
                         // Process any remaining data
                         if (!it->second->responseBuffer.empty()) {
@@ -324,7 +401,7 @@ std::vector<AIEvent> AIAgentControllerImpl::update() {
                             events.push_back({AIEvent::Type::Done, sessionId, it->second->accumulatedContent});
                         }
                         
-                        fmt::print("AI: Request completed for session {}\n", sessionId);
+                        LOG_INFO(LogCategory::Ai, "Request completed for session {}", sessionId);
                     }
                 }
                 
@@ -343,5 +420,5 @@ std::vector<AIEvent> AIAgentControllerImpl::update() {
 
 void AIAgentControllerImpl::clearHistory(uint64_t sessionId) {
     chatHistory.erase(sessionId);
-    fmt::print("AI: Cleared history for session {}\n", sessionId);
+    LOG_INFO(LogCategory::Ai, "Cleared history for session {}", sessionId);
 }
@@ -6,6 +6,7 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <chrono>
 
 /**
  * AI Agent Controller implementation using curl_multi for non-blocking streaming requests
@@ -24,6 +25,8 @@ public:
     void setApiKey(std::string apiKey) override;
     void sendMessage(uint64_t sessionId, const std::string& message) override;
     std::vector<AIEvent> update() override;
+    void attachEventLoop(EventLoop& eventLoop) override;
+    int nextTimeoutMs() const override;
     void clearHistory(uint64_t sessionId) override;
     
 private:
@@ -59,6 +62,17 @@ private:
     // Active requests: CURL handle -> request data
     std::unordered_map<CURL*, std::unique_ptr<ActiveRequest>> activeRequests;
     
+    // Event loop integration (nullptr = fall back to curl_multi_perform polling)
+    EventLoop* eventLoop = nullptr;
+    bool timerArmed = false;
+    std::chrono::steady_clock::time_point timerDeadline;
+    
+    // curl_multi socket callback: (un)registers transfer sockets with the event loop
+    static int socketCallback(CURL* easy, curl_socket_t socket, int what, void* userp, void* socketp);
+    
+    // curl_multi timer callback: stores deadline reported via nextTimeoutMs()
+    static int timerCallback(CURLM* multi, long timeoutMs, void* userp);
+    
     // CURL write callback (receives streaming data)
     static size_t writeCallback(char* ptr, size_t size, size_t nmemb, void* userdata);
     
@@ -2,8 +2,102 @@
 #include <charconv>
 #include <algorithm>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define TERMIHUI_SCAN_X86 1
+#endif
+
 namespace termihui {
 
+namespace {
+
+/**
+ * Check if byte is printable ASCII (0x20..0x7E)
+ */
+inline bool isPrintableAscii(unsigned char byte) {
+    return byte >= 0x20 && byte < 0x7F;
+}
+
+size_t scanPrintableAsciiScalar(const char* data, size_t size) {
+    size_t i = 0;
+    while (i < size && isPrintableAscii(static_cast<unsigned char>(data[i]))) {
+        ++i;
+    }
+    return i;
+}
+
+#ifdef TERMIHUI_SCAN_X86
+
+// Signed compare: bytes >= 0x80 are negative and fail the lower bound
+size_t scanPrintableAsciiSse2(const char* data, size_t size) {
+    const __m128i lower = _mm_set1_epi8(0x1F);
+    const __m128i upper = _mm_set1_epi8(0x7F);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(chunk, lower), _mm_cmplt_epi8(chunk, upper));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(printable));
+        if (mask != 0xFFFF) {
+            return i + static_cast<size_t>(__builtin_ctz(~mask));
+        }
+    }
+    return i + scanPrintableAsciiScalar(data + i, size - i);
+}
+
+__attribute__((target("avx2")))
+size_t scanPrintableAsciiAvx2(const char* data, size_t size) {
+    const __m256i lower = _mm256_set1_epi8(0x1F);
+    const __m256i upper = _mm256_set1_epi8(0x7F);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i printable = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, lower), _mm256_cmpgt_epi8(upper, chunk));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(printable));
+        if (mask != 0xFFFFFFFFu) {
+            return i + static_cast<size_t>(__builtin_ctz(~mask));
+        }
+    }
+    return i + scanPrintableAsciiSse2(data + i, size - i);
+}
+
+#endif
+
+/**
+ * Length of leading run of printable ASCII bytes
+ */
+size_t scanPrintableAscii(const char* data, size_t size) {
+#ifdef TERMIHUI_SCAN_X86
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    return hasAvx2 ? scanPrintableAsciiAvx2(data, size) : scanPrintableAsciiSse2(data, size);
+#else
+    return scanPrintableAsciiScalar(data, size);
+#endif
+}
+
+/**
+ * Color for a 256-color palette index (first 16 entries map to standard and bright colors)
+ */
+Color paletteColor(int colorIndex) {
+    if (colorIndex >= 0 && colorIndex < 8) {
+        return Color::standard(colorIndex);
+    } else if (colorIndex >= 8 && colorIndex < 16) {
+        return Color::bright(colorIndex - 8);
+    }
+    return Color::indexed(colorIndex);
+}
+
+} // anonymous namespace
+
+const AnsiEvent::ByteRange* oscRange(const AnsiEventVariant& event) {
+    return std::visit([](const auto& e) -> const AnsiEvent::ByteRange* {
+        if constexpr (requires { e.range; }) {
+            return &e.range;
+        } else {
+            return nullptr;
+        }
+    }, event);
+}
+
 AnsiProcessor::AnsiProcessor(VirtualScreen& screen)
     : screen(screen)
 {
@@ -11,221 +105,337 @@ AnsiProcessor::AnsiProcessor(VirtualScreen& screen)
 
 std::vector<AnsiEventVariant> AnsiProcessor::process(std::string_view data) {
     std::vector<AnsiEventVariant> events;
+    this->run(data, false, events);
+    return events;
+}
+
+size_t AnsiProcessor::processUntilOsc(std::string_view data, std::vector<AnsiEventVariant>& events) {
+    return this->run(data, true, events);
+}
+
+std::optional<size_t> AnsiProcessor::pendingOscStart() const {
+    if (this->state != vt::State::OscString && !this->trailingEscape) {
+        return std::nullopt;
+    }
+    return this->sequenceStart;
+}
+
+size_t AnsiProcessor::run(std::string_view data, bool stopAfterOsc, std::vector<AnsiEventVariant>& events) {
+    // A sequence still open from the previous call started before this data
+    this->sequenceStart = 0;
     
-    for (char ch : data) {
-        this->processCharacter(ch, events);
+    size_t i = 0;
+    while (i < data.size()) {
+        if (this->state == vt::State::Ground) {
+            if (!this->utf8Decoder.pending()) {
+                size_t runLength = this->processPrintableRun(data.substr(i));
+                if (runLength > 0) {
+                    i += runLength;
+                    continue;
+                }
+            }
+            this->sequenceStart = i;
+        }
+        this->advance(static_cast<unsigned char>(data[i]), events);
+        ++i;
+        
+        if (this->completedOsc) {
+            // Terminated by ST (ESC \): the backslash belongs to the sequence
+            if (this->state == vt::State::Escape && i < data.size() && data[i] == '\\') {
+                this->advance('\\', events);
+                ++i;
+            }
+            AnsiEventVariant event = std::move(*this->completedOsc);
+            this->completedOsc.reset();
+            std::visit([this, i](auto& e) {
+                if constexpr (requires { e.range; }) {
+                    e.range = AnsiEvent::ByteRange{this->sequenceStart, i};
+                }
+            }, event);
+            events.push_back(std::move(event));
+            if (stopAfterOsc) {
+                break;
+            }
+        }
     }
     
-    return events;
+    // Lone ESC at the end: whether it starts an OSC is only known from the next call
+    if (i > 0) {
+        this->trailingEscape = this->state == vt::State::Escape && this->sequenceStart + 1 == i;
+    }
+    return i;
+}
+
+size_t AnsiProcessor::processPrintableRun(std::string_view data) {
+    // Printable ASCII and complete UTF-8 sequences go to the screen in one putString;
+    // control bytes, escapes and split sequences are left for the byte-wise parser
+    const char* bytes = data.data();
+    size_t size = data.size();
+    size_t i = scanPrintableAscii(bytes, size);
+    if (i == size || static_cast<unsigned char>(bytes[i]) < 0x80) {
+        // Plain ASCII: no decoding needed
+        this->screen.putString(data.substr(0, i));
+        return i;
+    }
+    
+    this->printableRun.assign(bytes, bytes + i);
+    i += utf8::decode(data.substr(i), this->printableRun, scanPrintableAscii);
+    this->screen.putString(this->printableRun);
+    return i;
 }
 
 void AnsiProcessor::reset() {
-    this->state = State::Normal;
-    this->paramBuffer.clear();
+    this->state = vt::State::Ground;
+    this->clearSequence();
     this->oscBuffer.clear();
-    this->utf8Buffer.clear();
+    this->completedOsc.reset();
+    this->trailingEscape = false;
+    this->utf8Decoder.reset();
+}
+
+// =============================================================================
+// State Machine
+// =============================================================================
+
+void AnsiProcessor::advance(unsigned char byte, std::vector<AnsiEventVariant>& events) {
+    vt::TransitionEntry entry = vt::transitionTable[static_cast<size_t>(this->state)][byte];
+    vt::Action action = vt::entryAction(entry);
+    uint8_t next = vt::entryNextState(entry);
+    
+    if (next == vt::stay) {
+        this->performAction(action, byte, events);
+    } else {
+        this->transitionTo(static_cast<vt::State>(next), action, byte, events);
+    }
+}
+
+void AnsiProcessor::transitionTo(vt::State next, vt::Action action, unsigned char byte,
+                                 std::vector<AnsiEventVariant>& events) {
+    // A UTF-8 sequence interrupted by a control sequence is dropped
+    this->utf8Decoder.reset();
+    
+    this->performAction(vt::onExit(this->state), byte, events);
+    this->performAction(action, byte, events);
+    this->state = next;
+    this->performAction(vt::onEntry(next), byte, events);
 }
 
-void AnsiProcessor::processCharacter(char ch, std::vector<AnsiEventVariant>& events) {
-    switch (this->state) {
-        case State::Normal:
-            this->processNormalChar(ch, events);
+void AnsiProcessor::performAction(vt::Action action, unsigned char byte, std::vector<AnsiEventVariant>& events) {
+    switch (action) {
+        case vt::Action::None:
             break;
-        case State::Escape:
-            this->processEscapeChar(ch);
+        case vt::Action::Print:
+            this->print(byte, events);
             break;
-        case State::CSI:
-        case State::CSIParam:
-            this->processCSIChar(ch, events);
+        case vt::Action::Execute:
+            this->executeControl(byte, events);
             break;
-        case State::OSC:
-        case State::OSCString:
-            this->processOSCChar(ch, events);
+        case vt::Action::Clear:
+            this->clearSequence();
+            break;
+        case vt::Action::Collect:
+            this->collect(byte);
+            break;
+        case vt::Action::Param:
+            this->param(byte);
+            break;
+        case vt::Action::EscDispatch:
+            if (!this->intermediateOverflow) {
+                this->executeEscape(static_cast<char>(byte));
+            }
+            break;
+        case vt::Action::CsiDispatch:
+            if (!this->intermediateOverflow) {
+                this->executeCSI(static_cast<char>(byte), events);
+            }
+            break;
+        case vt::Action::Hook:
+        case vt::Action::Put:
+        case vt::Action::Unhook:
+            // No DCS sequences are supported: the payload is consumed and dropped
+            break;
+        case vt::Action::OscStart:
+            this->oscBuffer.clear();
+            break;
+        case vt::Action::OscPut:
+            if (this->oscBuffer.size() < maxOscLength) {
+                this->oscBuffer.push_back(static_cast<char>(byte));
+            }
+            break;
+        case vt::Action::OscEnd:
+            this->executeOSC();
+            break;
+        case vt::Action::C1Control:
+            this->executeC1(byte, events);
             break;
     }
 }
 
-void AnsiProcessor::processNormalChar(char ch, std::vector<AnsiEventVariant>& events) {
-    unsigned char uch = static_cast<unsigned char>(ch);
-    
-    // Check if we're in the middle of a UTF-8 sequence
-    if (!this->utf8Buffer.empty()) {
-        // UTF-8 continuation byte should be 10xxxxxx (0x80-0xBF)
-        if ((uch & 0xC0) == 0x80) {
-            this->utf8Buffer.push_back(ch);
-            
-            // Check if UTF-8 sequence is complete
-            size_t expectedLen = 0;
-            unsigned char firstByte = static_cast<unsigned char>(this->utf8Buffer[0]);
-            if ((firstByte & 0xE0) == 0xC0) expectedLen = 2;      // 110xxxxx
-            else if ((firstByte & 0xF0) == 0xE0) expectedLen = 3; // 1110xxxx
-            else if ((firstByte & 0xF8) == 0xF0) expectedLen = 4; // 11110xxx
-            
-            if (this->utf8Buffer.size() >= expectedLen) {
-                // Decode UTF-8 to char32_t
-                char32_t codepoint = 0;
-                if (expectedLen == 2) {
-                    codepoint = ((this->utf8Buffer[0] & 0x1F) << 6) |
-                                (this->utf8Buffer[1] & 0x3F);
-                } else if (expectedLen == 3) {
-                    codepoint = ((this->utf8Buffer[0] & 0x0F) << 12) |
-                                ((this->utf8Buffer[1] & 0x3F) << 6) |
-                                (this->utf8Buffer[2] & 0x3F);
-                } else if (expectedLen == 4) {
-                    codepoint = ((this->utf8Buffer[0] & 0x07) << 18) |
-                                ((this->utf8Buffer[1] & 0x3F) << 12) |
-                                ((this->utf8Buffer[2] & 0x3F) << 6) |
-                                (this->utf8Buffer[3] & 0x3F);
-                }
-                this->screen.putCharacter(codepoint);
-                this->utf8Buffer.clear();
-            }
-            return;
-        } else {
-            // Invalid continuation - discard buffer and process current byte normally
-            this->utf8Buffer.clear();
-        }
+void AnsiProcessor::print(unsigned char byte, std::vector<AnsiEventVariant>& events) {
+    using Result = utf8::Decoder::Result;
+    char32_t codepoint = 0;
+    Result result = this->utf8Decoder.feed(byte, codepoint);
+    if (result == Result::Interrupted) {
+        // Incomplete sequence is dropped, the byte counts on its own
+        result = this->utf8Decoder.feed(byte, codepoint);
     }
     
-    // Check for UTF-8 multi-byte sequence start
-    if ((uch & 0xE0) == 0xC0 || (uch & 0xF0) == 0xE0 || (uch & 0xF8) == 0xF0) {
-        // Start of multi-byte UTF-8 sequence
-        this->utf8Buffer.push_back(ch);
-        return;
+    if (result == Result::Complete) {
+        this->screen.putCharacter(codepoint);
+    } else if (result == Result::Invalid && byte < 0xA0) {
+        // Lone byte from the C1 range is an 8-bit control
+        this->executeC1(byte, events);
     }
-    
-    if (ch == '\x1B') {
-        // ESC - start escape sequence
-        this->state = State::Escape;
-    } else if (uch == 0x9B) {
-        // 8-bit CSI
-        this->state = State::CSI;
-        this->paramBuffer.clear();
-    } else if (ch == '\r') {
-        // Carriage return
-        this->screen.carriageReturn();
-    } else if (ch == '\n') {
-        // Line feed
-        this->screen.lineFeed();
-    } else if (ch == '\t') {
-        // Tab - move to next tab stop (every 8 columns)
-        size_t currentCol = this->screen.cursorColumn();
-        size_t nextTab = ((currentCol / 8) + 1) * 8;
-        this->screen.moveCursor(this->screen.cursorRow(), nextTab);
-    } else if (ch == '\b') {
-        // Backspace
-        if (this->screen.cursorColumn() > 0) {
-            this->screen.moveCursorRelative(0, -1);
-        }
-    } else if (ch == '\x07') {
-        // Bell
-        events.push_back(AnsiEvent::Bell{});
-    } else if (uch >= 0x20 && uch < 0x80) {
-        // ASCII printable character
-        this->screen.putCharacter(static_cast<char32_t>(uch));
-    }
-    // Other control characters and invalid bytes are ignored
+    // Stray continuation bytes and invalid lead bytes are ignored
 }
 
-void AnsiProcessor::processEscapeChar(char ch) {
-    if (ch == '[') {
-        // CSI sequence
-        this->state = State::CSI;
-        this->paramBuffer.clear();
-    } else if (ch == ']') {
-        // OSC sequence
-        this->state = State::OSC;
-        this->oscBuffer.clear();
-    } else if (ch == '\\') {
-        // ST (String Terminator) - end of sequence
-        this->state = State::Normal;
-    } else if (ch == 'c') {
-        // RIS - Reset to Initial State
-        this->screen.clearScreen(VirtualScreen::ClearScreenMode::Entire);
-        this->screen.moveCursor(0, 0);
-        this->screen.resetStyle();
-        this->state = State::Normal;
-    } else if (ch == 'D') {
-        // IND - Index (line feed)
-        this->screen.lineFeed();
-        this->state = State::Normal;
-    } else if (ch == 'E') {
-        // NEL - Next Line
-        this->screen.carriageReturn();
-        this->screen.lineFeed();
-        this->state = State::Normal;
-    } else if (ch == 'M') {
-        // RI - Reverse Index (reverse line feed)
-        if (this->screen.cursorRow() > 0) {
-            this->screen.moveCursorRelative(-1, 0);
-        } else {
-            this->screen.scroll(-1);
-        }
-        this->state = State::Normal;
-    } else if (ch == '7') {
-        // DECSC - Save Cursor (simplified - just ignore for now)
-        this->state = State::Normal;
-    } else if (ch == '8') {
-        // DECRC - Restore Cursor (simplified - just ignore for now)
-        this->state = State::Normal;
-    } else {
-        // Unknown escape sequence - ignore and return to normal
-        this->state = State::Normal;
-    }
+void AnsiProcessor::executeC1(unsigned char byte, std::vector<AnsiEventVariant>& events) {
+    // 8-bit C1 control is the same as ESC followed by byte - 0x40
+    this->transitionTo(vt::State::Escape, vt::Action::None, byte, events);
+    this->advance(static_cast<unsigned char>(byte - 0x40), events);
 }
 
-void AnsiProcessor::processCSIChar(char ch, std::vector<AnsiEventVariant>& events) {
-    unsigned char uch = static_cast<unsigned char>(ch);
+void AnsiProcessor::executeControl(unsigned char byte, std::vector<AnsiEventVariant>& events) {
+    this->utf8Decoder.reset();
     
-    // Check if this is a final character (0x40-0x7E)
-    if (uch >= 0x40 && uch <= 0x7E) {
-        this->executeCSI(ch, events);
-        this->state = State::Normal;
-    } else {
-        // Parameter character - accumulate
-        this->paramBuffer += ch;
+    switch (byte) {
+        case '\r':
+            this->screen.carriageReturn();
+            break;
+        case '\n':
+        case '\v':
+        case '\f':
+            this->screen.lineFeed();
+            break;
+        case '\t': {
+            // Tab - move to next tab stop (every 8 columns)
+            size_t currentCol = this->screen.cursorColumn();
+            size_t nextTab = ((currentCol / 8) + 1) * 8;
+            this->screen.moveCursor(this->screen.cursorRow(), nextTab);
+            break;
+        }
+        case '\b':
+            if (this->screen.cursorColumn() > 0) {
+                this->screen.moveCursorRelative(0, -1);
+            }
+            break;
+        case '\x07':
+            events.push_back(AnsiEvent::Bell{});
+            break;
+        default:
+            // Other control characters are ignored
+            break;
     }
 }
 
-void AnsiProcessor::processOSCChar(char ch, std::vector<AnsiEventVariant>& events) {
-    if (ch == '\x07') {
-        // BEL terminates OSC
-        this->executeOSC(events);
-        this->state = State::Normal;
-    } else if (ch == '\x1B') {
-        // Possible ST (ESC \) - will be handled in processEscapeChar
-        // For now, execute OSC and switch to Escape state
-        this->executeOSC(events);
-        this->state = State::Escape;
+void AnsiProcessor::clearSequence() {
+    this->paramCount = 0;
+    this->subparamMask = 0;
+    this->paramOverflow = false;
+    this->intermediateCount = 0;
+    this->intermediateOverflow = false;
+    this->privateMarker = 0;
+}
+
+void AnsiProcessor::collect(unsigned char byte) {
+    if (byte >= 0x3C && byte <= 0x3F) {
+        this->privateMarker = static_cast<char>(byte);
+    } else if (this->intermediateCount < maxIntermediates) {
+        this->intermediates[this->intermediateCount++] = static_cast<char>(byte);
     } else {
-        this->oscBuffer += ch;
+        this->intermediateOverflow = true;
     }
 }
 
-void AnsiProcessor::executeOSC(std::vector<AnsiEventVariant>& events) {
-    if (this->oscBuffer.empty()) {
+void AnsiProcessor::param(unsigned char byte) {
+    if (this->paramCount == 0) {
+        this->params[0] = 0;
+        this->paramCount = 1;
+    }
+    
+    if (byte == ';' || byte == ':') {
+        if (this->paramCount == maxParams) {
+            this->paramOverflow = true;
+            return;
+        }
+        if (byte == ':') {
+            this->subparamMask |= 1u << this->paramCount;
+        }
+        this->params[this->paramCount++] = 0;
         return;
     }
     
-    // Find the separator between command and argument
-    size_t semicolonPos = this->oscBuffer.find(';');
-    if (semicolonPos == std::string::npos) {
-        this->oscBuffer.clear();
+    if (this->paramOverflow) {
+        return;
+    }
+    int& value = this->params[this->paramCount - 1];
+    value = std::min(value * 10 + (byte - '0'), maxParamValue);
+}
+
+// =============================================================================
+// Dispatch
+// =============================================================================
+
+void AnsiProcessor::executeEscape(char command) {
+    if (this->intermediateCount > 0) {
+        // Character set designation (ESC ( B), DECALN (ESC # 8) etc. - ignore
         return;
     }
     
-    std::string commandStr = this->oscBuffer.substr(0, semicolonPos);
-    std::string argument = this->oscBuffer.substr(semicolonPos + 1);
+    switch (command) {
+        case 'c': // RIS - Reset to Initial State
+            this->screen.resetScrollRegion();
+            this->screen.clearScreen(VirtualScreen::ClearScreenMode::Entire);
+            this->screen.moveCursor(0, 0);
+            this->screen.resetStyle();
+            break;
+        case 'D': // IND - Index (line feed)
+            this->screen.lineFeed();
+            break;
+        case 'E': // NEL - Next Line
+            this->screen.carriageReturn();
+            this->screen.lineFeed();
+            break;
+        case 'M': // RI - Reverse Index (reverse line feed)
+            this->screen.reverseLineFeed();
+            break;
+        case '7': // DECSC - Save Cursor
+            this->screen.saveCursor();
+            break;
+        case '8': // DECRC - Restore Cursor
+            this->screen.restoreCursor();
+            break;
+        default:
+            // ST (ESC \\) and unknown escape sequences - ignore
+            break;
+    }
+}
+
+void AnsiProcessor::executeOSC() {
+    std::string_view osc = this->oscBuffer;
+    this->completedOsc = AnsiEvent::OtherOsc{};
     
+    // Find the separator between command and argument
+    size_t semicolonPos = osc.find(';');
     int command = 0;
-    auto [ptr, ec] = std::from_chars(commandStr.data(), commandStr.data() + commandStr.size(), command);
-    
-    if (ec == std::errc()) {
+    auto [ptr, ec] = std::from_chars(osc.data(), osc.data() + std::min(semicolonPos, osc.size()), command);
+    if (semicolonPos != std::string_view::npos && ec == std::errc() && ptr == osc.data() + semicolonPos) {
+        std::string_view argument = osc.substr(semicolonPos + 1);
         switch (command) {
             case 0: // Set icon name and window title
             case 1: // Set icon name
             case 2: // Set window title
-                events.push_back(AnsiEvent::TitleChanged{std::move(argument)});
+                this->completedOsc = AnsiEvent::TitleChanged{std::string(argument), {}};
+                break;
+            case 7: // Current working directory
+                if (auto path = parseFileUrlPath(argument)) {
+                    this->completedOsc = AnsiEvent::CwdChanged{std::move(*path), {}};
+                }
+                break;
+            case 133: // Shell integration
+                if (auto marker = parseCommandMarker(argument)) {
+                    this->completedOsc = std::move(*marker);
+                }
                 break;
             default:
                 // Other OSC commands - ignore
@@ -236,21 +446,59 @@ void AnsiProcessor::executeOSC(std::vector<AnsiEventVariant>& events) {
     this->oscBuffer.clear();
 }
 
+std::optional<AnsiEvent::CommandMarker> AnsiProcessor::parseCommandMarker(std::string_view argument) {
+    using Kind = AnsiEvent::CommandMarker::Kind;
+    if (argument.empty() || argument[0] < 'A' || argument[0] > 'D') {
+        return std::nullopt;
+    }
+    AnsiEvent::CommandMarker marker;
+    marker.kind = static_cast<Kind>(argument[0] - 'A');
+    
+    // Fields: ;key=value...
+    argument.remove_prefix(1);
+    while (!argument.empty()) {
+        argument.remove_prefix(argument[0] == ';' ? 1 : 0);
+        std::string_view field = argument.substr(0, argument.find(';'));
+        argument.remove_prefix(field.size());
+        if (field.starts_with("exit=")) {
+            std::from_chars(field.data() + 5, field.data() + field.size(), marker.exitCode);
+        } else if (field.starts_with("cwd=")) {
+            marker.cwd = field.substr(4);
+        }
+    }
+    return marker;
+}
+
+std::optional<std::string> AnsiProcessor::parseFileUrlPath(std::string_view url) {
+    // file://host/path: the path starts at the first slash after the host
+    size_t hostStart = url.find("file://");
+    if (hostStart == std::string_view::npos) {
+        return std::nullopt;
+    }
+    size_t slashPos = url.find('/', hostStart + 7);
+    if (slashPos == std::string_view::npos) {
+        return std::nullopt;
+    }
+    return std::string(url.substr(slashPos));
+}
+
 void AnsiProcessor::executeCSI(char command, std::vector<AnsiEventVariant>& events) {
+    std::span<const int> params(this->params.data(), this->paramCount);
+    
     // Check for private mode sequences (starts with ?)
-    if (!this->paramBuffer.empty() && this->paramBuffer[0] == '?') {
-        std::string privateParams = this->paramBuffer.substr(1);
-        this->paramBuffer = privateParams;
-        
+    if (this->privateMarker == '?' && this->intermediateCount == 0) {
         if (command == 'h') {
-            this->executePrivateMode(command, true, events);
+            this->executePrivateMode(true, params, events);
         } else if (command == 'l') {
-            this->executePrivateMode(command, false, events);
+            this->executePrivateMode(false, params, events);
         }
         return;
     }
     
-    std::vector<int> params = this->parseParams();
+    if (this->privateMarker != 0 || this->intermediateCount > 0) {
+        // Other private (DA2, XTMODKEYS...) and intermediate (DECSTR, DECSCUSR...) forms - ignore
+        return;
+    }
     
     switch (command) {
         case 'A': { // CUU - Cursor Up
@@ -328,6 +576,16 @@ void AnsiProcessor::executeCSI(char command, std::vector<AnsiEventVariant>& even
             }
             break;
         }
+        case 'L': { // IL - Insert Lines
+            int n = params.empty() ? 1 : std::max(1, params[0]);
+            this->screen.insertLines(static_cast<size_t>(n));
+            break;
+        }
+        case 'M': { // DL - Delete Lines
+            int n = params.empty() ? 1 : std::max(1, params[0]);
+            this->screen.deleteLines(static_cast<size_t>(n));
+            break;
+        }
         case 'S': { // SU - Scroll Up
             int n = params.empty() ? 1 : std::max(1, params[0]);
             this->screen.scroll(n);
@@ -344,19 +602,22 @@ void AnsiProcessor::executeCSI(char command, std::vector<AnsiEventVariant>& even
             break;
         }
         case 'm': { // SGR - Select Graphic Rendition
-            if (params.empty()) {
-                params.push_back(0); // Default is reset
-            }
-            this->executeSGR(params);
+            static constexpr int resetParams[] = {0}; // Default is reset
+            this->executeSGR(params.empty() ? std::span<const int>(resetParams) : params);
             break;
         }
-        case 'r': { // DECSTBM - Set Scrolling Region (simplified - ignore)
+        case 'r': { // DECSTBM - Set Top and Bottom Margins
+            int top = (params.size() >= 1 && params[0] > 0) ? params[0] : 1;
+            size_t bottom = (params.size() >= 2 && params[1] > 0) ? static_cast<size_t>(params[1]) : this->screen.rows();
+            this->screen.setScrollRegion(static_cast<size_t>(top - 1), bottom - 1);
             break;
         }
-        case 's': { // Save cursor position (simplified - ignore)
+        case 's': { // SCOSC - Save cursor position
+            this->screen.saveCursor();
             break;
         }
-        case 'u': { // Restore cursor position (simplified - ignore)
+        case 'u': { // SCORC - Restore cursor position
+            this->screen.restoreCursor();
             break;
         }
         default:
@@ -365,11 +626,16 @@ void AnsiProcessor::executeCSI(char command, std::vector<AnsiEventVariant>& even
     }
 }
 
-void AnsiProcessor::executeSGR(const std::vector<int>& params) {
+void AnsiProcessor::executeSGR(std::span<const int> params) {
     TextStyle style = this->screen.currentStyle();
     
     size_t i = 0;
     while (i < params.size()) {
+        if (this->subparamMask & (1u << i)) {
+            // Colon sub-parameter of an attribute we don't distinguish (e.g. 4:3 curly underline)
+            ++i;
+            continue;
+        }
         int code = params[i];
         
         switch (code) {
@@ -481,24 +747,32 @@ void AnsiProcessor::executeSGR(const std::vector<int>& params) {
     this->screen.setCurrentStyle(style);
 }
 
-void AnsiProcessor::executePrivateMode(char /* command */, bool enable, std::vector<AnsiEventVariant>& events) {
-    std::vector<int> params = this->parseParams();
-    
+void AnsiProcessor::executePrivateMode(bool enable, std::span<const int> params, std::vector<AnsiEventVariant>& events) {
     for (int param : params) {
         switch (param) {
-            case 1049: // Alternate screen buffer
-            case 47:   // Alternate screen buffer (older)
+            case 1049: // Alternate screen buffer, saving cursor
+            case 47:   // Alternate screen buffer (older, not cleared)
             case 1047: // Alternate screen buffer variant
                 if (enable != this->interactiveMode) {
                     this->interactiveMode = enable;
                     events.push_back(AnsiEvent::InteractiveModeChanged{enable});
                     if (enable) {
-                        // Entering alternate screen - clear it
-                        this->screen.clearScreen(VirtualScreen::ClearScreenMode::Entire);
-                        this->screen.moveCursor(0, 0);
+                        if (param == 1049) {
+                            this->screen.saveCursor();
+                        }
+                        this->screen.enterAlternateScreen(param != 47);
+                    } else {
+                        // Primary screen comes back as it was left
+                        this->screen.exitAlternateScreen();
+                        if (param == 1049) {
+                            this->screen.restoreCursor();
+                        }
                     }
                 }
                 break;
+            case 2004: // Bracketed paste mode
+                this->bracketedPasteMode = enable;
+                break;
             case 25: // DECTCEM - Show/hide cursor (ignore for now)
                 break;
             case 7: // DECAWM - Autowrap mode (ignore for now)
@@ -512,38 +786,26 @@ void AnsiProcessor::executePrivateMode(char /* command */, bool enable, std::vec
     }
 }
 
-std::vector<int> AnsiProcessor::parseParams() const {
-    std::vector<int> result;
-    
-    if (this->paramBuffer.empty()) {
-        return result;
+std::optional<Color> AnsiProcessor::parseExtendedColor(std::span<const int> params, size_t& index) const {
+    if (index + 1 >= params.size()) {
+        return std::nullopt;
     }
     
-    size_t pos = 0;
-    while (pos < this->paramBuffer.size()) {
-        size_t semicolonPos = this->paramBuffer.find(';', pos);
-        if (semicolonPos == std::string::npos) {
-            semicolonPos = this->paramBuffer.size();
+    if (this->subparamMask & (1u << (index + 1))) {
+        // Colon form: 38:5:N, 38:2:R:G:B or 38:2:CS:R:G:B (ITU T.416 with color space id)
+        size_t end = index + 1;
+        while (end < params.size() && (this->subparamMask & (1u << end))) {
+            ++end;
         }
-        
-        std::string_view token{this->paramBuffer.data() + pos, semicolonPos - pos};
-        
-        int value = 0;
-        auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
-        if (ec == std::errc()) {
-            result.push_back(value);
-        } else {
-            result.push_back(0);
+        std::span<const int> color = params.subspan(index + 1, end - index - 1);
+        index = end - 1;
+        if (color[0] == 5 && color.size() >= 2) {
+            return paletteColor(color[1]);
+        }
+        if (color[0] == 2 && color.size() >= 4) {
+            size_t first = color.size() >= 5 ? 2 : 1;
+            return Color::rgb(color[first], color[first + 1], color[first + 2]);
         }
-        
-        pos = semicolonPos + 1;
-    }
-    
-    return result;
-}
-
-std::optional<Color> AnsiProcessor::parseExtendedColor(const std::vector<int>& params, size_t& index) {
-    if (index + 1 >= params.size()) {
         return std::nullopt;
     }
     
@@ -557,13 +819,7 @@ std::optional<Color> AnsiProcessor::parseExtendedColor(const std::vector<int>& p
         int colorIndex = params[index + 2];
         index += 2;
         
-        if (colorIndex >= 0 && colorIndex < 8) {
-            return Color::standard(colorIndex);
-        } else if (colorIndex >= 8 && colorIndex < 16) {
-            return Color::bright(colorIndex - 8);
-        } else {
-            return Color::indexed(colorIndex);
-        }
+        return paletteColor(colorIndex);
     } else if (colorType == 2) {
         // RGB mode: 38;2;R;G;B or 48;2;R;G;B
         if (index + 4 >= params.size()) {
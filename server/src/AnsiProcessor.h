@@ -1,7 +1,12 @@
 #pragma once
 
 #include "VirtualScreen.h"
+#include "VtStateMachine.h"
 #include <termihui/text_style.h>
+#include <termihui/utf8.h>
+#include <array>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -13,6 +18,15 @@ namespace termihui {
  * Events generated during ANSI processing
  */
 namespace AnsiEvent {
+    /**
+     * Bytes of an OSC sequence in the data of the process call that completed it
+     * (begin is 0 if the sequence started in an earlier call)
+     */
+    struct ByteRange {
+        size_t begin = 0;
+        size_t end = 0;
+    };
+    
     /**
      * Interactive mode (alternate screen) changed
      */
@@ -25,6 +39,38 @@ namespace AnsiEvent {
      */
     struct TitleChanged {
         std::string title;
+        ByteRange range;
+    };
+    
+    /**
+     * Working directory reported by the shell (OSC 7 file://host/path)
+     */
+    struct CwdChanged {
+        std::string path;
+        ByteRange range;
+    };
+    
+    /**
+     * Shell integration marker (OSC 133;A-D with optional exit= and cwd= fields)
+     */
+    struct CommandMarker {
+        enum class Kind {
+            CommandStart,  // A
+            CommandEnd,    // B
+            PromptStart,   // C
+            PromptEnd      // D
+        };
+        Kind kind = Kind::CommandStart;
+        int exitCode = 0;
+        std::string cwd;  // Empty if not given
+        ByteRange range;
+    };
+    
+    /**
+     * Any other OSC sequence (consumed without effect)
+     */
+    struct OtherOsc {
+        ByteRange range;
     };
     
     /**
@@ -36,18 +82,32 @@ namespace AnsiEvent {
 using AnsiEventVariant = std::variant<
     AnsiEvent::InteractiveModeChanged,
     AnsiEvent::TitleChanged,
+    AnsiEvent::CwdChanged,
+    AnsiEvent::CommandMarker,
+    AnsiEvent::OtherOsc,
     AnsiEvent::Bell
 >;
 
+/**
+ * Get byte range of an OSC event (nullptr for events not caused by an OSC sequence)
+ */
+const AnsiEvent::ByteRange* oscRange(const AnsiEventVariant& event);
+
 /**
  * ANSI escape sequence processor
  * 
  * Parses ANSI escape sequences from PTY output and applies them to VirtualScreen.
+ * Sequences are recognized by the table-driven VT500 state machine (VtStateMachine.h),
+ * so unsupported CSI/ESC/DCS/OSC/SOS/PM/APC sequences are consumed without side effects.
  * Supports:
  * - SGR (Select Graphic Rendition) for colors and text styles
  * - Cursor movement commands (CUU, CUD, CUF, CUB, CUP)
  * - Screen clearing (ED) and line clearing (EL)
  * - Alternate screen buffer switching (DECSET/DECRST 1049)
+ * - Bracketed paste mode tracking (DECSET/DECRST 2004)
+ * - Title (OSC 0/1/2), working directory (OSC 7) and shell integration markers (OSC 133)
+ *   as events carrying the byte range of the sequence; sequences split across calls are
+ *   completed by the call that receives their end
  */
 class AnsiProcessor {
 public:
@@ -64,6 +124,29 @@ public:
      */
     std::vector<AnsiEventVariant> process(std::string_view data);
     
+    /**
+     * Process input data up to and including the next OSC sequence
+     * Stops right after the sequence, so the screen holds only the output preceding it
+     * when its event (last in events) is handled.
+     * @param data Raw bytes from PTY output
+     * @param events Receives events generated during processing
+     * @return Number of bytes consumed (data.size() if no OSC sequence ended in data)
+     */
+    size_t processUntilOsc(std::string_view data, std::vector<AnsiEventVariant>& events);
+    
+    /**
+     * Get offset in the data of the last process call where an unfinished OSC sequence starts
+     * (0 if it started in an earlier call), nullopt if none is pending
+     * A lone ESC at the end of the data counts too: it may still turn out to start an OSC.
+     */
+    std::optional<size_t> pendingOscStart() const;
+    
+    /**
+     * Check if the last process call ended with a lone ESC (see pendingOscStart())
+     * If the next call doesn't make it an OSC, that ESC belongs to the text before.
+     */
+    bool endsWithEscape() const { return this->trailingEscape; }
+    
     /**
      * Reset processor state (but not screen)
      */
@@ -73,37 +156,76 @@ public:
      * Check if currently in interactive mode (alternate screen)
      */
     bool isInteractiveMode() const { return this->interactiveMode; }
+    
+    /**
+     * Check if application asked for pasted text to be bracketed (ESC[200~ ... ESC[201~)
+     */
+    bool isBracketedPasteMode() const { return this->bracketedPasteMode; }
 
 private:
-    enum class State {
-        Normal,     // Regular text
-        Escape,     // After ESC (0x1B)
-        CSI,        // After ESC[
-        CSIParam,   // Reading CSI parameters
-        OSC,        // After ESC]
-        OSCString   // Reading OSC string
-    };
+    static constexpr size_t maxParams = 32;
+    static constexpr size_t maxIntermediates = 2;
+    static constexpr size_t maxOscLength = 4096;
+    static constexpr int maxParamValue = 65535;
     
     VirtualScreen& screen;
-    State state = State::Normal;
-    std::string paramBuffer;
+    vt::State state = vt::State::Ground;
+    
+    // Current sequence (fixed storage, reset by the Clear action)
+    std::array<int, maxParams> params{};
+    size_t paramCount = 0;
+    uint32_t subparamMask = 0;  // Bit i set: params[i] was preceded by ':'
+    bool paramOverflow = false;
+    std::array<char, maxIntermediates> intermediates{};
+    size_t intermediateCount = 0;
+    bool intermediateOverflow = false;
+    char privateMarker = 0;     // '<', '=', '>' or '?' right after CSI / DCS
+    
     std::string oscBuffer;
-    std::string utf8Buffer;  // Buffer for multi-byte UTF-8 sequences
+    std::optional<AnsiEventVariant> completedOsc;  // Event of OSC just ended, range set by run()
+    size_t sequenceStart = 0;   // Offset of the escape sequence being parsed in the current call
+    bool trailingEscape = false;  // Last call ended with ESC that started a sequence
+    utf8::Decoder utf8Decoder;  // Multi-byte sequence in progress, kept across calls
+    std::u32string printableRun;  // Decoded run for the fast path (reused to avoid allocations)
     bool interactiveMode = false;
+    bool bracketedPasteMode = false;
+    
+    /**
+     * Feed data through the state machine, optionally stopping after the first OSC sequence
+     * @return bytes consumed
+     */
+    size_t run(std::string_view data, bool stopAfterOsc, std::vector<AnsiEventVariant>& events);
+    
+    /**
+     * Fast path for text: write leading run of printable characters with one putString
+     * @return bytes consumed (0 if data starts with a control byte or partial UTF-8 sequence)
+     */
+    size_t processPrintableRun(std::string_view data);
+    
+    /**
+     * Feed one byte through the state machine: one table lookup, then the action and,
+     * on a state change, the exit and entry actions
+     */
+    void advance(unsigned char byte, std::vector<AnsiEventVariant>& events);
+    void transitionTo(vt::State next, vt::Action action, unsigned char byte, std::vector<AnsiEventVariant>& events);
+    void performAction(vt::Action action, unsigned char byte, std::vector<AnsiEventVariant>& events);
     
-    void processCharacter(char ch, std::vector<AnsiEventVariant>& events);
-    void processNormalChar(char ch, std::vector<AnsiEventVariant>& events);
-    void processEscapeChar(char ch);
-    void processCSIChar(char ch, std::vector<AnsiEventVariant>& events);
-    void processOSCChar(char ch, std::vector<AnsiEventVariant>& events);
+    void print(unsigned char byte, std::vector<AnsiEventVariant>& events);
+    void executeControl(unsigned char byte, std::vector<AnsiEventVariant>& events);
+    void executeC1(unsigned char byte, std::vector<AnsiEventVariant>& events);
+    void clearSequence();
+    void collect(unsigned char byte);
+    void param(unsigned char byte);
     
+    void executeEscape(char command);
     void executeCSI(char command, std::vector<AnsiEventVariant>& events);
-    void executeSGR(const std::vector<int>& params);
-    void executePrivateMode(char command, bool enable, std::vector<AnsiEventVariant>& events);
-    void executeOSC(std::vector<AnsiEventVariant>& events);
+    void executeSGR(std::span<const int> params);
+    void executePrivateMode(bool enable, std::span<const int> params, std::vector<AnsiEventVariant>& events);
+    void executeOSC();
+    static std::optional<AnsiEvent::CommandMarker> parseCommandMarker(std::string_view argument);
+    static std::optional<std::string> parseFileUrlPath(std::string_view url);
     
-    std::vector<int> parseParams() const;
-    std::optional<Color> parseExtendedColor(const std::vector<int>& params, size_t& index);
+    std::optional<Color> parseExtendedColor(std::span<const int> params, size_t& index) const;
 };
 
 } // namespace termihui
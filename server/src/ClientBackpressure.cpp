@@ -0,0 +1,76 @@
+#include "ClientBackpressure.h"
+#include <termihui/protocol/protocol.h>
+
+ClientBackpressure::ClientBackpressure(size_t budgetBytes)
+    : budgetBytes(budgetBytes)
+{
+}
+
+bool ClientBackpressure::admit(const WebSocketServer::OutgoingMessage& message, size_t pendingBytes, std::vector<std::string>& preamble) {
+    switch (message.messageClass) {
+        case MessageClass::Control:
+            return true;
+
+        case MessageClass::ScreenUpdate:
+            // Update applies to a screen state the client doesn't have: wait for snapshot
+            if (this->staleScreens.contains(message.sessionId)) {
+                return false;
+            }
+            if (pendingBytes > this->budgetBytes) {
+                this->staleScreens[message.sessionId] = false;
+                return false;
+            }
+            return true;
+
+        case MessageClass::ScreenSnapshot:
+            if (pendingBytes > this->budgetBytes) {
+                // Still behind: ask again once drained
+                this->staleScreens[message.sessionId] = false;
+                return false;
+            }
+            this->staleScreens.erase(message.sessionId);
+            return true;
+
+        case MessageClass::OutputLine: {
+            auto it = this->skippedOutputLines.find(message.sessionId);
+            if (it != this->skippedOutputLines.end()) {
+                if (!this->hasCaughtUp(pendingBytes)) {
+                    ++it->second;
+                    return false;
+                }
+                this->releaseSkippedOutput(message.sessionId, preamble);
+                return true;
+            }
+            if (pendingBytes > this->budgetBytes * outputLineBudgetFactor) {
+                this->skippedOutputLines[message.sessionId] = 1;
+                return false;
+            }
+            return true;
+        }
+    }
+    return true;
+}
+
+void ClientBackpressure::poll(size_t pendingBytes, std::vector<std::string>& markers, std::vector<uint64_t>& resyncSessions) {
+    if (!this->hasCaughtUp(pendingBytes)) {
+        return;
+    }
+    while (!this->skippedOutputLines.empty()) {
+        this->releaseSkippedOutput(this->skippedOutputLines.begin()->first, markers);
+    }
+    for (auto& [sessionId, resyncRequested] : this->staleScreens) {
+        if (!resyncRequested) {
+            resyncRequested = true;
+            resyncSessions.push_back(sessionId);
+        }
+    }
+}
+
+void ClientBackpressure::releaseSkippedOutput(uint64_t sessionId, std::vector<std::string>& markers) {
+    auto it = this->skippedOutputLines.find(sessionId);
+    if (it == this->skippedOutputLines.end()) {
+        return;
+    }
+    markers.push_back(serialize(OutputSkippedMessage{sessionId, it->second}));
+    this->skippedOutputLines.erase(it);
+}
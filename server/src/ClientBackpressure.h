@@ -0,0 +1,81 @@
+#pragma once
+
+#include "WebSocketServer.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Outbound budget policy for one WebSocket client
+ *
+ * Decides per message whether it is written, given how many bytes are still queued
+ * in the client's socket buffer. No I/O: WebSocketServerImpl feeds it and writes.
+ *
+ * Features:
+ * - Control messages are always delivered
+ * - Screen updates over budget are dropped; the session is marked stale and further
+ *   updates are dropped until a screen snapshot gets through
+ * - Output lines get a larger allowance, beyond it they are counted and later announced
+ *   with one output_skipped marker placed where they would have been
+ * - Once the client drains below half the budget, markers are released and a resync
+ *   (fresh snapshot) is requested for every stale session
+ */
+class ClientBackpressure {
+public:
+    using MessageClass = WebSocketServer::MessageClass;
+
+    /**
+     * Output lines may queue up to this many budgets before they are skipped
+     */
+    static constexpr size_t outputLineBudgetFactor = 4;
+
+    /**
+     * Constructor
+     * @param budgetBytes bytes that may be queued for the client before screen updates are dropped
+     */
+    explicit ClientBackpressure(size_t budgetBytes);
+
+    /**
+     * Decide whether message may be written now
+     * @param message outgoing message
+     * @param pendingBytes bytes already queued for the client
+     * @param preamble receives messages to write right before it (output_skipped markers)
+     * @return true if message should be written
+     */
+    bool admit(const WebSocketServer::OutgoingMessage& message, size_t pendingBytes, std::vector<std::string>& preamble);
+
+    /**
+     * Check whether client caught up (call periodically, not only when messages arrive)
+     * @param pendingBytes bytes already queued for the client
+     * @param markers receives output_skipped markers to write now
+     * @param resyncSessions receives sessions whose screen has to be resent to the client
+     */
+    void poll(size_t pendingBytes, std::vector<std::string>& markers, std::vector<uint64_t>& resyncSessions);
+
+    /**
+     * Check if nothing is being tracked (client is not behind)
+     */
+    bool isIdle() const { return this->staleScreens.empty() && this->skippedOutputLines.empty(); }
+
+private:
+    /**
+     * Check if client drained enough to be served normally again
+     */
+    bool hasCaughtUp(size_t pendingBytes) const { return pendingBytes <= this->budgetBytes / 2; }
+
+    /**
+     * Move output_skipped marker of session into markers
+     */
+    void releaseSkippedOutput(uint64_t sessionId, std::vector<std::string>& markers);
+
+private:
+    size_t budgetBytes;
+
+    // Sessions whose screen updates were dropped → resync already requested
+    std::unordered_map<uint64_t, bool> staleScreens;
+
+    // Sessions whose output lines were dropped → number of dropped lines
+    std::unordered_map<uint64_t, size_t> skippedOutputLines;
+};
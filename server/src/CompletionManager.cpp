@@ -1,4 +1,5 @@
 #include "CompletionManager.h"
+#include "Logger.h"
 
 #include <filesystem>
 #include <cstdlib>
@@ -165,7 +166,7 @@ std::vector<std::string> CompletionManager::getCompletions(const std::string& te
         completions = getFileCompletions(lastWord, currentDir);
     }
     
-    fmt::print("CompletionManager: Found {} options for '{}' in directory '{}'\n", completions.size(), text, currentDir);
+    LOG_DEBUG(LogCategory::Session, "CompletionManager: Found {} options for '{}' in directory '{}'", completions.size(), text, currentDir);
     return completions;
 }
 
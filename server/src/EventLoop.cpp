@@ -0,0 +1,254 @@
+#include "EventLoop.h"
+#include "Logger.h"
+#include <cerrno>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#else
+#include <poll.h>
+#endif
+
+namespace {
+
+#ifdef __linux__
+uint32_t toEpollEvents(uint32_t events) {
+    uint32_t epollEvents = 0;
+    if (events & EventLoop::Readable) epollEvents |= EPOLLIN;
+    if (events & EventLoop::Writable) epollEvents |= EPOLLOUT;
+    return epollEvents;
+}
+
+uint32_t fromEpollEvents(uint32_t epollEvents) {
+    uint32_t events = 0;
+    if (epollEvents & EPOLLIN) events |= EventLoop::Readable;
+    if (epollEvents & EPOLLOUT) events |= EventLoop::Writable;
+    if (epollEvents & (EPOLLHUP | EPOLLERR)) events |= EventLoop::Hangup;
+    return events;
+}
+#else
+short toPollEvents(uint32_t events) {
+    short pollEvents = 0;
+    if (events & EventLoop::Readable) pollEvents |= POLLIN;
+    if (events & EventLoop::Writable) pollEvents |= POLLOUT;
+    return pollEvents;
+}
+
+uint32_t fromPollEvents(short pollEvents) {
+    uint32_t events = 0;
+    if (pollEvents & POLLIN) events |= EventLoop::Readable;
+    if (pollEvents & POLLOUT) events |= EventLoop::Writable;
+    if (pollEvents & (POLLHUP | POLLERR | POLLNVAL)) events |= EventLoop::Hangup;
+    return events;
+}
+#endif
+
+} // anonymous namespace
+
+EventLoop::EventLoop() {
+#ifdef __linux__
+    this->pollerFd = epoll_create1(EPOLL_CLOEXEC);
+    if (this->pollerFd < 0) {
+        LOG_ERROR(LogCategory::Session, "epoll_create1 error: {}", strerror(errno));
+    }
+
+    this->wakeupReadFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    this->wakeupWriteFd = this->wakeupReadFd;
+    if (this->wakeupReadFd < 0) {
+        LOG_ERROR(LogCategory::Session, "eventfd error: {}", strerror(errno));
+    } else if (this->pollerFd >= 0) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = this->wakeupReadFd;
+        epoll_ctl(this->pollerFd, EPOLL_CTL_ADD, this->wakeupReadFd, &event);
+    }
+#else
+    int pipeFds[2];
+    if (pipe(pipeFds) == 0) {
+        for (int fd : pipeFds) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+        this->wakeupReadFd = pipeFds[0];
+        this->wakeupWriteFd = pipeFds[1];
+    } else {
+        LOG_ERROR(LogCategory::Session, "Wakeup pipe error: {}", strerror(errno));
+    }
+#endif
+}
+
+EventLoop::~EventLoop() {
+    if (this->wakeupWriteFd >= 0 && this->wakeupWriteFd != this->wakeupReadFd) {
+        close(this->wakeupWriteFd);
+    }
+    if (this->wakeupReadFd >= 0) {
+        close(this->wakeupReadFd);
+    }
+    if (this->pollerFd >= 0) {
+        close(this->pollerFd);
+    }
+}
+
+bool EventLoop::watch(int fd, uint32_t events, Callback callback) {
+    if (fd < 0) {
+        return false;
+    }
+
+    const bool alreadyWatched = this->watches.count(fd) > 0;
+#ifdef __linux__
+    epoll_event event{};
+    event.events = toEpollEvents(events);
+    event.data.fd = fd;
+    if (epoll_ctl(this->pollerFd, alreadyWatched ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event) < 0) {
+        LOG_ERROR(LogCategory::Session, "epoll_ctl add fd {} error: {}", fd, strerror(errno));
+        return false;
+    }
+#else
+    (void)alreadyWatched;
+#endif
+    this->watches[fd] = Watch{events, std::move(callback)};
+    return true;
+}
+
+bool EventLoop::modify(int fd, uint32_t events) {
+    auto it = this->watches.find(fd);
+    if (it == this->watches.end()) {
+        return false;
+    }
+    if (it->second.events == events) {
+        return true;
+    }
+
+#ifdef __linux__
+    epoll_event event{};
+    event.events = toEpollEvents(events);
+    event.data.fd = fd;
+    if (epoll_ctl(this->pollerFd, EPOLL_CTL_MOD, fd, &event) < 0) {
+        LOG_ERROR(LogCategory::Session, "epoll_ctl mod fd {} error: {}", fd, strerror(errno));
+        return false;
+    }
+#endif
+    it->second.events = events;
+    return true;
+}
+
+void EventLoop::unwatch(int fd) {
+    auto it = this->watches.find(fd);
+    if (it == this->watches.end()) {
+        return;
+    }
+
+#ifdef __linux__
+    // May fail with EBADF if fd was already closed - kernel dropped it then anyway
+    epoll_ctl(this->pollerFd, EPOLL_CTL_DEL, fd, nullptr);
+#endif
+    this->watches.erase(it);
+}
+
+bool EventLoop::isWatching(int fd) const {
+    return this->watches.count(fd) > 0;
+}
+
+void EventLoop::wakeup() {
+    if (this->wakeupWriteFd < 0) {
+        return;
+    }
+#ifdef __linux__
+    uint64_t one = 1;
+    [[maybe_unused]] auto written = write(this->wakeupWriteFd, &one, sizeof(one));
+#else
+    char byte = 1;
+    // EAGAIN means pipe is full - loop is already going to wake up
+    [[maybe_unused]] auto written = write(this->wakeupWriteFd, &byte, 1);
+#endif
+}
+
+void EventLoop::drainWakeup() {
+#ifdef __linux__
+    uint64_t counter = 0;
+    [[maybe_unused]] auto bytesRead = read(this->wakeupReadFd, &counter, sizeof(counter));
+#else
+    char drainBuffer[64];
+    while (read(this->wakeupReadFd, drainBuffer, sizeof(drainBuffer)) > 0) {
+    }
+#endif
+}
+
+bool EventLoop::dispatch(int fd, uint32_t events) {
+    // Watch may have been removed by a previous callback in the same batch
+    auto it = this->watches.find(fd);
+    if (it == this->watches.end()) {
+        return false;
+    }
+
+    // Copy callback: it may unwatch itself (destroying the stored std::function)
+    Callback callback = it->second.callback;
+    callback(events);
+    return true;
+}
+
+int EventLoop::wait(int timeoutMs) {
+    int dispatched = 0;
+
+#ifdef __linux__
+    if (this->pollerFd < 0) {
+        return 0;
+    }
+
+    epoll_event readyEvents[64];
+    int readyCount = epoll_wait(this->pollerFd, readyEvents, 64, timeoutMs);
+    if (readyCount < 0) {
+        if (errno != EINTR) {
+            LOG_ERROR(LogCategory::Session, "epoll_wait error: {}", strerror(errno));
+        }
+        return 0;
+    }
+
+    for (int i = 0; i < readyCount; ++i) {
+        int fd = readyEvents[i].data.fd;
+        if (fd == this->wakeupReadFd) {
+            this->drainWakeup();
+            continue;
+        }
+        if (this->dispatch(fd, fromEpollEvents(readyEvents[i].events))) {
+            ++dispatched;
+        }
+    }
+#else
+    std::vector<pollfd> pollFds;
+    pollFds.reserve(this->watches.size() + 1);
+    if (this->wakeupReadFd >= 0) {
+        pollFds.push_back(pollfd{this->wakeupReadFd, POLLIN, 0});
+    }
+    for (const auto& [fd, watch] : this->watches) {
+        pollFds.push_back(pollfd{fd, toPollEvents(watch.events), 0});
+    }
+
+    int readyCount = poll(pollFds.data(), static_cast<nfds_t>(pollFds.size()), timeoutMs);
+    if (readyCount < 0) {
+        if (errno != EINTR) {
+            LOG_ERROR(LogCategory::Session, "poll error: {}", strerror(errno));
+        }
+        return 0;
+    }
+
+    for (const auto& pollFd : pollFds) {
+        if (pollFd.revents == 0) {
+            continue;
+        }
+        if (pollFd.fd == this->wakeupReadFd) {
+            this->drainWakeup();
+            continue;
+        }
+        if (this->dispatch(pollFd.fd, fromPollEvents(pollFd.revents))) {
+            ++dispatched;
+        }
+    }
+#endif
+
+    return dispatched;
+}
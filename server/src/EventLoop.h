@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+/**
+ * Readiness-based event loop for the server main thread
+ *
+ * Features:
+ * - epoll on Linux, poll() fallback on other platforms (macOS)
+ * - Level-triggered file descriptor watches with per-fd callbacks
+ * - Thread-safe wakeup() so other threads (WebSocket I/O) can interrupt wait()
+ *
+ * Callbacks may watch/unwatch descriptors (including their own) while being dispatched.
+ */
+class EventLoop {
+public:
+    /**
+     * Readiness flags used by watch()/modify() and reported to callbacks
+     */
+    enum Events : uint32_t {
+        Readable = 1u << 0,
+        Writable = 1u << 1,
+        Hangup = 1u << 2    // Peer closed or error condition (reported only, never requested)
+    };
+
+    /**
+     * Callback invoked with the reported readiness flags
+     */
+    using Callback = std::function<void(uint32_t events)>;
+
+    EventLoop();
+    ~EventLoop();
+
+    // Disable copying and moving
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+    EventLoop(EventLoop&&) = delete;
+    EventLoop& operator=(EventLoop&&) = delete;
+
+    /**
+     * Start watching file descriptor
+     * @param fd file descriptor (must stay open until unwatch)
+     * @param events combination of Readable/Writable
+     * @param callback called from wait() when fd is ready
+     * @return true if registered successfully
+     */
+    bool watch(int fd, uint32_t events, Callback callback);
+
+    /**
+     * Change requested events for already watched descriptor
+     * @param fd file descriptor
+     * @param events combination of Readable/Writable
+     * @return true if updated successfully
+     */
+    bool modify(int fd, uint32_t events);
+
+    /**
+     * Stop watching file descriptor (no-op if not watched)
+     * @param fd file descriptor
+     */
+    void unwatch(int fd);
+
+    /**
+     * Check if descriptor is currently watched
+     */
+    bool isWatching(int fd) const;
+
+    /**
+     * Interrupt current or next wait() call
+     * Safe to call from any thread and from signal handlers
+     */
+    void wakeup();
+
+    /**
+     * Wait for readiness and dispatch callbacks
+     * @param timeoutMs maximum time to block in milliseconds (0 = don't block, -1 = no limit)
+     * @return number of dispatched callbacks (wakeups are not counted)
+     */
+    int wait(int timeoutMs);
+
+private:
+    struct Watch {
+        uint32_t events = 0;
+        Callback callback;
+    };
+
+    /**
+     * Drain wakeup descriptor so it stops reporting readiness
+     */
+    void drainWakeup();
+
+    /**
+     * Look up watch and invoke its callback
+     * @return true if callback was called
+     */
+    bool dispatch(int fd, uint32_t events);
+
+private:
+    int pollerFd = -1;          // epoll instance (Linux only)
+    int wakeupReadFd = -1;      // eventfd on Linux, pipe read end elsewhere
+    int wakeupWriteFd = -1;     // same as wakeupReadFd for eventfd
+    std::unordered_map<int, Watch> watches;
+};
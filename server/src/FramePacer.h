@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+/**
+ * Per-session frame pacing state
+ *
+ * Screen damage accumulates in VirtualScreen between frames; the pacer decides when it
+ * may be sent, so a fast producer results in at most one frame per interval.
+ * A deferred frame is represented by a deadline the session owner has to honour.
+ */
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Check if a frame may be sent now, otherwise arm deadline for a deferred frame
+     * @param now current time
+     * @param interval minimal time between frames (zero = no pacing)
+     * @return true if caller should send the frame now
+     */
+    bool shouldSendFrame(Clock::time_point now, Clock::duration interval) {
+        if (this->immediateFrameRequested || interval <= Clock::duration::zero() ||
+            !this->lastFrameTime || now - *this->lastFrameTime >= interval) {
+            return true;
+        }
+        if (!this->pendingDeadline) {
+            this->pendingDeadline = *this->lastFrameTime + interval;
+        }
+        return false;
+    }
+
+    /**
+     * Record that a frame was sent (clears deferred frame and immediate request)
+     */
+    void frameSent(Clock::time_point now) {
+        this->lastFrameTime = now;
+        this->pendingDeadline.reset();
+        this->immediateFrameRequested = false;
+    }
+
+    /**
+     * Drop deferred frame (e.g. superseded by a full snapshot)
+     */
+    void cancelPendingFrame() {
+        this->pendingDeadline.reset();
+    }
+
+    /**
+     * Let the next frame bypass the interval (user input: echo must not wait)
+     * A frame that is already deferred becomes due immediately.
+     */
+    void requestImmediateFrame() {
+        this->immediateFrameRequested = true;
+        if (this->pendingDeadline) {
+            this->pendingDeadline = Clock::time_point{};
+        }
+    }
+
+    /**
+     * Deadline of deferred frame, nullopt if nothing is pending
+     */
+    const std::optional<Clock::time_point>& getPendingDeadline() const { return this->pendingDeadline; }
+
+private:
+    std::optional<Clock::time_point> lastFrameTime;
+    std::optional<Clock::time_point> pendingDeadline;
+    bool immediateFrameRequested = false;
+};
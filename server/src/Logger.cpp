@@ -0,0 +1,216 @@
+#include "Logger.h"
+#include <optional>
+
+namespace {
+
+constexpr std::array<std::string_view, static_cast<size_t>(LogCategory::Count)> categoryNames = {
+    "pty", "osc", "ws", "storage", "ai", "session"
+};
+
+constexpr std::array<std::string_view, static_cast<size_t>(LogLevel::Off) + 1> levelNames = {
+    "trace", "debug", "info", "warn", "error", "off"
+};
+
+template<typename T, size_t N>
+bool parseName(const std::array<std::string_view, N>& names, std::string_view name, T& value) {
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (names[i] == name) {
+            value = static_cast<T>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger() {
+    for (auto& level : this->levels) {
+        level.store(LogLevel::Info, std::memory_order_relaxed);
+    }
+    this->writerThread = std::thread([this]() { this->run(); });
+}
+
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->wakeCondition.notify_one();
+    this->writerThread.join();
+}
+
+void Logger::setLevel(LogCategory category, LogLevel level) {
+    this->levels[static_cast<size_t>(category)].store(level, std::memory_order_relaxed);
+}
+
+void Logger::setLevel(LogLevel level) {
+    for (auto& categoryLevel : this->levels) {
+        categoryLevel.store(level, std::memory_order_relaxed);
+    }
+}
+
+bool Logger::configure(std::string_view spec) {
+    // Validate everything first so a typo doesn't leave a half-applied spec
+    std::array<std::optional<LogLevel>, static_cast<size_t>(LogCategory::Count)> newLevels;
+    while (!spec.empty()) {
+        size_t comma = spec.find(',');
+        std::string_view item = spec.substr(0, comma);
+        spec = comma == std::string_view::npos ? std::string_view() : spec.substr(comma + 1);
+        if (item.empty()) {
+            continue;
+        }
+
+        LogLevel level;
+        size_t equals = item.find('=');
+        if (equals == std::string_view::npos) {
+            if (!parseName(levelNames, item, level)) {
+                return false;
+            }
+            newLevels.fill(level);
+            continue;
+        }
+        LogCategory category;
+        if (!parseName(categoryNames, item.substr(0, equals), category) ||
+            !parseName(levelNames, item.substr(equals + 1), level)) {
+            return false;
+        }
+        newLevels[static_cast<size_t>(category)] = level;
+    }
+
+    for (size_t i = 0; i < newLevels.size(); ++i) {
+        if (newLevels[i]) {
+            this->setLevel(static_cast<LogCategory>(i), *newLevels[i]);
+        }
+    }
+    return true;
+}
+
+void Logger::setOutput(FILE* out, FILE* err) {
+    this->flush();
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->out = out ? out : stdout;
+    this->err = err ? err : stderr;
+}
+
+void Logger::flush() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->flushCondition.wait(lock, [this]() { return this->queue.empty() && !this->writing; });
+}
+
+void Logger::enqueue(LogCategory category, LogLevel level, std::string text) {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->queue.size() >= maxQueuedLines) {
+            this->droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        this->queue.push_back(Line{category, level, std::move(text)});
+        if (this->queue.size() > 1 || this->writing) {
+            // Writer is already awake
+            return;
+        }
+    }
+    this->wakeCondition.notify_one();
+}
+
+void Logger::run() {
+    std::vector<Line> lines;
+    std::unique_lock<std::mutex> lock(this->mutex);
+    for (;;) {
+        this->wakeCondition.wait(lock, [this]() { return !this->queue.empty() || this->stopping; });
+        if (this->queue.empty()) {
+            return;
+        }
+        lines.swap(this->queue);
+        this->writing = true;
+        uint64_t dropped = this->droppedCount.load(std::memory_order_relaxed);
+        FILE* out = this->out;
+        FILE* err = this->err;
+        lock.unlock();
+
+        this->write(lines, dropped, out, err);
+        lines.clear();
+
+        lock.lock();
+        this->writing = false;
+        if (this->queue.empty()) {
+            this->flushCondition.notify_all();
+        }
+    }
+}
+
+void Logger::write(const std::vector<Line>& lines, uint64_t dropped, FILE* out, FILE* err) {
+    // One write per stream per batch (stdout is unbuffered in main)
+    std::string outBuffer;
+    std::string errBuffer;
+    for (const auto& line : lines) {
+        std::string& buffer = line.level >= LogLevel::Warn ? errBuffer : outBuffer;
+        buffer += '[';
+        buffer += getCategoryName(line.category);
+        buffer += "] ";
+        if (line.level != LogLevel::Info) {
+            buffer += getLevelName(line.level);
+            buffer += ": ";
+        }
+        buffer += line.text;
+        if (line.text.empty() || line.text.back() != '\n') {
+            buffer += '\n';
+        }
+    }
+    if (dropped > this->reportedDroppedCount) {
+        errBuffer += fmt::format("[log] warn: {} lines dropped, writer can't keep up\n", dropped - this->reportedDroppedCount);
+        this->reportedDroppedCount = dropped;
+    }
+
+    if (!outBuffer.empty()) {
+        fwrite(outBuffer.data(), 1, outBuffer.size(), out);
+        fflush(out);
+    }
+    if (!errBuffer.empty()) {
+        fwrite(errBuffer.data(), 1, errBuffer.size(), err);
+        fflush(err);
+    }
+}
+
+std::string Logger::escape(std::string_view data) {
+    std::string result;
+    result.reserve(data.size());
+    size_t runStart = 0;
+    for (size_t i = 0; i < data.size(); ++i) {
+        auto c = static_cast<unsigned char>(data[i]);
+        if (c >= 32) {
+            continue;
+        }
+        result.append(data, runStart, i - runStart);
+        runStart = i + 1;
+        switch (c) {
+            case '\x1b': result += "\\e"; break;
+            case '\x07': result += "\\a"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            default: {
+                static constexpr char hexDigits[] = "0123456789abcdef";
+                result += "\\x";
+                result += hexDigits[c >> 4];
+                result += hexDigits[c & 0xf];
+                break;
+            }
+        }
+    }
+    result.append(data, runStart, data.size() - runStart);
+    return result;
+}
+
+std::string_view Logger::getCategoryName(LogCategory category) {
+    return categoryNames[static_cast<size_t>(category)];
+}
+
+std::string_view Logger::getLevelName(LogLevel level) {
+    return levelNames[static_cast<size_t>(level)];
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <fmt/core.h>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * Log severity, in increasing order
+ */
+enum class LogLevel : uint8_t {
+    Trace,
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+/**
+ * Subsystem a log line belongs to, each has its own level
+ */
+enum class LogCategory : uint8_t {
+    Pty,      // Shell processes and raw PTY traffic
+    Osc,      // Shell integration sequences (OSC 133/7/2)
+    Ws,       // WebSocket connections and messages
+    Storage,  // Session and server databases
+    Ai,       // LLM requests and streaming
+    Session,  // Session lifecycle, workers, event loop and server stats
+    Count
+};
+
+/**
+ * Trace lines are compiled in for debug builds (or with TERMIHUI_TRACE_LOG) only:
+ * in release builds LOG_TRACE doesn't evaluate its arguments at all
+ */
+#if defined(DEBUG) || defined(TERMIHUI_TRACE_LOG)
+#define TERMIHUI_TRACE_LOG_ENABLED 1
+#else
+#define TERMIHUI_TRACE_LOG_ENABLED 0
+#endif
+
+/**
+ * Leveled, asynchronous logger
+ *
+ * Features:
+ * - Per-category level, settable at runtime (atomic, checked before formatting)
+ * - Callers only format into a queue; a background thread writes batches to stdout/stderr
+ * - Warn and Error go to stderr, the rest to stdout
+ * - Queue is bounded: under a flood lines are dropped and counted instead of stalling the caller
+ *
+ * Use through LOG_TRACE/LOG_DEBUG/LOG_INFO/LOG_WARN/LOG_ERROR, which skip
+ * argument evaluation when the level is disabled.
+ */
+class Logger {
+public:
+    /**
+     * Max queued lines before new lines are dropped
+     */
+    static constexpr size_t maxQueuedLines = 16384;
+
+    /**
+     * Process-wide logger
+     */
+    static Logger& instance();
+
+    /**
+     * Destructor - writes queued lines and stops writer thread
+     */
+    ~Logger();
+
+    // Disable copying and moving
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+    Logger(Logger&&) = delete;
+    Logger& operator=(Logger&&) = delete;
+
+    /**
+     * Check if lines of given level are logged for category
+     */
+    bool isEnabled(LogCategory category, LogLevel level) const {
+        return level >= this->levels[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Set minimal level for one category
+     */
+    void setLevel(LogCategory category, LogLevel level);
+
+    /**
+     * Set minimal level for all categories
+     */
+    void setLevel(LogLevel level);
+
+    /**
+     * Apply level spec: comma-separated "<level>" (all categories) or "<category>=<level>"
+     * Example: "info,pty=trace,ws=debug". Nothing is applied if spec is invalid.
+     * @return false if spec is invalid
+     */
+    bool configure(std::string_view spec);
+
+    /**
+     * Redirect output (tests); nullptr restores stdout/stderr
+     */
+    void setOutput(FILE* out, FILE* err);
+
+    /**
+     * Block until all queued lines are written
+     */
+    void flush();
+
+    /**
+     * Number of lines dropped because the queue was full
+     */
+    uint64_t getDroppedCount() const { return this->droppedCount.load(std::memory_order_relaxed); }
+
+    /**
+     * Format and queue line (use LOG_* macros instead, they check the level first)
+     */
+    template<typename... Args>
+    void log(LogCategory category, LogLevel level, fmt::format_string<Args...> format, Args&&... args) {
+        this->enqueue(category, level, fmt::format(format, std::forward<Args>(args)...));
+    }
+
+    /**
+     * Make control characters visible (\e, \a, \n, \r, \xNN) for logging raw terminal data
+     */
+    static std::string escape(std::string_view data);
+
+    static std::string_view getCategoryName(LogCategory category);
+    static std::string_view getLevelName(LogLevel level);
+
+private:
+    Logger();
+
+    struct Line {
+        LogCategory category;
+        LogLevel level;
+        std::string text;
+    };
+
+    void enqueue(LogCategory category, LogLevel level, std::string text);
+    void run();
+    void write(const std::vector<Line>& lines, uint64_t dropped, FILE* out, FILE* err);
+
+private:
+    std::array<std::atomic<LogLevel>, static_cast<size_t>(LogCategory::Count)> levels;
+
+    std::mutex mutex;
+    std::condition_variable wakeCondition;    // Writer: lines queued or stopping
+    std::condition_variable flushCondition;   // flush(): writer went idle
+    std::vector<Line> queue;
+    bool writing = false;
+    bool stopping = false;
+    std::atomic<uint64_t> droppedCount{0};
+    uint64_t reportedDroppedCount = 0;        // Writer thread only
+
+    FILE* out = stdout;
+    FILE* err = stderr;
+    std::thread writerThread;
+};
+
+#define TERMIHUI_LOG(category, level, ...)                                        \
+    do {                                                                          \
+        auto& termihuiLogger = Logger::instance();                                \
+        if (termihuiLogger.isEnabled(category, level)) {                          \
+            termihuiLogger.log(category, level, __VA_ARGS__);                     \
+        }                                                                         \
+    } while (0)
+
+#if TERMIHUI_TRACE_LOG_ENABLED
+#define LOG_TRACE(category, ...) TERMIHUI_LOG(category, LogLevel::Trace, __VA_ARGS__)
+#else
+#define LOG_TRACE(category, ...) do {} while (0)
+#endif
+#define LOG_DEBUG(category, ...) TERMIHUI_LOG(category, LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(category, ...) TERMIHUI_LOG(category, LogLevel::Info, __VA_ARGS__)
+#define LOG_WARN(category, ...) TERMIHUI_LOG(category, LogLevel::Warn, __VA_ARGS__)
+#define LOG_ERROR(category, ...) TERMIHUI_LOG(category, LogLevel::Error, __VA_ARGS__)
@@ -0,0 +1,147 @@
+#include "OutboundDispatcher.h"
+#include "Logger.h"
+#include "hv/wsdef.h"
+
+OutboundDispatcher::OutboundDispatcher(size_t outboundBudget)
+    : outboundBudget(outboundBudget)
+{
+}
+
+void OutboundDispatcher::dispatch(const std::vector<OutgoingMessage>& messages, const Connections& connections,
+                                  std::vector<ResyncRequest>& resyncRequests)
+{
+    // Forget subscriptions of disconnected clients
+    std::erase_if(this->subscriptions, [&connections](const auto& entry) {
+        return !connections.contains(entry.first);
+    });
+
+    // Clients that fell behind: forget disconnected ones, serve the ones that caught up
+    for (auto it = this->clientBackpressures.begin(); it != this->clientBackpressures.end();) {
+        auto connectionIt = connections.find(it->first);
+        if (connectionIt == connections.end()) {
+            it = this->clientBackpressures.erase(it);
+            continue;
+        }
+        std::vector<std::string> markers;
+        std::vector<uint64_t> resyncSessions;
+        it->second.poll(connectionIt->second->pendingBytes(), markers, resyncSessions);
+        for (const auto& marker : markers) {
+            SharedFrame markerFrame;
+            this->writeFrame(it->first, *connectionIt->second, marker, markerFrame);
+        }
+        for (uint64_t sessionId : resyncSessions) {
+            resyncRequests.push_back({it->first, sessionId});
+        }
+        it = it->second.isIdle() ? this->clientBackpressures.erase(it) : std::next(it);
+    }
+
+    // Send messages: each payload is framed at most once, whatever the number of recipients
+    for (const auto& message : messages) {
+        SharedFrame frame;
+        if (message.clientId == 0) {
+            // Broadcast to all clients (session broadcasts to its subscribers only)
+            for (const auto& [clientId, connection] : connections) {
+                if (message.sessionId != 0 && !this->isSubscribed(clientId, message.sessionId)) {
+                    this->messagesFiltered.fetch_add(1, std::memory_order_relaxed);
+                    this->bytesFiltered.fetch_add(message.message.size(), std::memory_order_relaxed);
+                    continue;
+                }
+                this->deliverMessage(clientId, *connection, message, frame);
+            }
+        } else {
+            // Send to specific client
+            auto it = connections.find(message.clientId);
+            if (it != connections.end()) {
+                this->deliverMessage(message.clientId, *it->second, message, frame);
+            } else {
+                LOG_ERROR(LogCategory::Ws, "Client {} not found to send message", message.clientId);
+            }
+        }
+    }
+}
+
+void OutboundDispatcher::subscribe(int clientId, uint64_t sessionId)
+{
+    this->subscriptions[clientId].insert(sessionId);
+}
+
+void OutboundDispatcher::unsubscribe(int clientId, uint64_t sessionId)
+{
+    auto it = this->subscriptions.find(clientId);
+    if (it == this->subscriptions.end()) {
+        return;
+    }
+    // Empty set stays: client that unsubscribed from everything receives nothing,
+    // only clients that never subscribed receive all sessions
+    it->second.erase(sessionId);
+}
+
+void OutboundDispatcher::clear()
+{
+    this->subscriptions.clear();
+    this->clientBackpressures.clear();
+}
+
+OutboundDispatcher::OutboundStats OutboundDispatcher::getStats() const
+{
+    return OutboundStats{
+        this->messagesSent.load(),
+        this->bytesSent.load(),
+        this->messagesFiltered.load(),
+        this->bytesFiltered.load()
+    };
+}
+
+bool OutboundDispatcher::isSubscribed(int clientId, uint64_t sessionId) const
+{
+    auto it = this->subscriptions.find(clientId);
+    return it == this->subscriptions.end() || it->second.contains(sessionId);
+}
+
+void OutboundDispatcher::deliverMessage(int clientId, Connection& connection, const OutgoingMessage& message, SharedFrame& frame)
+{
+    if (message.messageClass == MessageClass::Control) {
+        this->writeFrame(clientId, connection, message.message, frame);
+        return;
+    }
+
+    auto it = this->clientBackpressures.find(clientId);
+    if (it == this->clientBackpressures.end()) {
+        it = this->clientBackpressures.try_emplace(clientId, this->outboundBudget).first;
+    }
+    std::vector<std::string> preamble;
+    bool admitted = it->second.admit(message, connection.pendingBytes(), preamble);
+    for (const auto& marker : preamble) {
+        SharedFrame markerFrame;
+        this->writeFrame(clientId, connection, marker, markerFrame);
+    }
+    if (admitted) {
+        this->writeFrame(clientId, connection, message.message, frame);
+    }
+    if (it->second.isIdle()) {
+        this->clientBackpressures.erase(it);
+    }
+}
+
+OutboundDispatcher::SharedFrame OutboundDispatcher::buildTextFrame(std::string_view payload)
+{
+    // Server frames are unmasked, so one frame is valid for every client
+    int payloadSize = static_cast<int>(payload.size());
+    auto frame = std::make_shared<std::string>();
+    frame->resize(static_cast<size_t>(ws_calc_frame_size(payloadSize, false)));
+    ws_build_frame(frame->data(), payload.data(), payloadSize, nullptr, false, WS_OPCODE_TEXT, true);
+    return frame;
+}
+
+void OutboundDispatcher::writeFrame(int clientId, Connection& connection, std::string_view payload, SharedFrame& frame)
+{
+    if (!frame) {
+        frame = buildTextFrame(payload);
+    }
+    if (!connection.write(frame)) {
+        LOG_ERROR(LogCategory::Ws, "Message send error to client {}", clientId);
+        return;
+    }
+    this->messagesSent.fetch_add(1, std::memory_order_relaxed);
+    this->bytesSent.fetch_add(frame->size(), std::memory_order_relaxed);
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "WebSocketServer.h"
+#include "ClientBackpressure.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Writes outgoing messages to client connections
+ *
+ * No sockets: WebSocketServerImpl adapts its libhv channels to Connection and calls
+ * dispatch() from update().
+ *
+ * Features:
+ * - Each payload is framed at most once (only if someone admits it); all recipients
+ *   get the same frame
+ * - Session broadcasts reach subscribed clients only; clients that never subscribed get all
+ * - Non-control messages go through the client's ClientBackpressure
+ */
+class OutboundDispatcher {
+public:
+    using MessageClass = WebSocketServer::MessageClass;
+    using OutgoingMessage = WebSocketServer::OutgoingMessage;
+    using ResyncRequest = WebSocketServer::ResyncRequest;
+    using OutboundStats = WebSocketServer::OutboundStats;
+
+    /**
+     * WebSocket frame shared by all recipients of one message
+     */
+    using SharedFrame = std::shared_ptr<const std::string>;
+
+    /**
+     * Client connection as seen by the dispatcher
+     */
+    class Connection {
+    public:
+        virtual ~Connection() = default;
+
+        /**
+         * Bytes queued for the client but not yet written to its socket
+         */
+        virtual size_t pendingBytes() const = 0;
+
+        /**
+         * Write complete frame (in one piece, so frames never interleave)
+         * @return false on write error
+         */
+        virtual bool write(const SharedFrame& frame) = 0;
+    };
+
+    using Connections = std::unordered_map<int, std::shared_ptr<Connection>>;
+
+    /**
+     * Constructor
+     * @param outboundBudget per-client outbound budget in bytes (see ClientBackpressure)
+     */
+    explicit OutboundDispatcher(size_t outboundBudget);
+
+    /**
+     * Write messages to connected clients and serve clients that caught up
+     * Called on every update, so recovery is noticed even when no new messages arrive.
+     * @param messages messages in queue order
+     * @param connections connected clients by ID
+     * @param resyncRequests receives screens to resend to clients that caught up
+     */
+    void dispatch(const std::vector<OutgoingMessage>& messages, const Connections& connections,
+                  std::vector<ResyncRequest>& resyncRequests);
+
+    void subscribe(int clientId, uint64_t sessionId);
+    void unsubscribe(int clientId, uint64_t sessionId);
+
+    /**
+     * Forget subscriptions and backpressure state of all clients
+     */
+    void clear();
+
+    /**
+     * Get outbound traffic counters (callable from any thread)
+     */
+    OutboundStats getStats() const;
+
+    /**
+     * Build unmasked text frame for payload
+     */
+    static SharedFrame buildTextFrame(std::string_view payload);
+
+private:
+    /**
+     * Check if broadcast of session should reach client
+     */
+    bool isSubscribed(int clientId, uint64_t sessionId) const;
+
+    /**
+     * Write message to client, subject to its outbound budget
+     * @param frame frame of message, built on first write and reused for other recipients
+     */
+    void deliverMessage(int clientId, Connection& connection, const OutgoingMessage& message, SharedFrame& frame);
+
+    /**
+     * Write frame to connection (builds it from payload first if empty), logging failures
+     */
+    void writeFrame(int clientId, Connection& connection, std::string_view payload, SharedFrame& frame);
+
+private:
+    size_t outboundBudget;
+
+    // Session subscriptions of clients that have any
+    std::unordered_map<int, std::unordered_set<uint64_t>> subscriptions;
+
+    // Backpressure state of clients that fell behind
+    std::unordered_map<int, ClientBackpressure> clientBackpressures;
+
+    // Outbound traffic counters
+    std::atomic<uint64_t> messagesSent{0};
+    std::atomic<uint64_t> bytesSent{0};
+    std::atomic<uint64_t> messagesFiltered{0};
+    std::atomic<uint64_t> bytesFiltered{0};
+};
@@ -0,0 +1,120 @@
+#include "ProcessReaper.h"
+#include "Logger.h"
+#include <cerrno>
+#include <cstring>
+#include <optional>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+ProcessReaper::ProcessReaper(EventLoop& eventLoop, Clock::duration gracePeriod)
+    : eventLoop(eventLoop)
+    , gracePeriod(gracePeriod)
+{
+}
+
+ProcessReaper::~ProcessReaper() {
+    while (!this->children.empty()) {
+        pid_t pid = this->children.begin()->first;
+        if (!this->tryReap(pid)) {
+            kill(pid, SIGKILL);
+        }
+        this->forget(pid);
+    }
+}
+
+void ProcessReaper::terminate(pid_t pid, int exitFd) {
+    if (pid <= 0) {
+        if (exitFd >= 0) {
+            close(exitFd);
+        }
+        return;
+    }
+
+    kill(pid, SIGTERM);
+    this->children[pid] = PendingChild{exitFd, Clock::now() + this->gracePeriod, false};
+
+    if (exitFd >= 0) {
+        this->eventLoop.watch(exitFd, EventLoop::Readable, [this, pid](uint32_t) {
+            if (this->tryReap(pid)) {
+                this->forget(pid);
+            }
+        });
+    }
+    // Shell may already be gone (PTY closed before us)
+    if (this->tryReap(pid)) {
+        this->forget(pid);
+    }
+}
+
+int ProcessReaper::nextTimeoutMs() const {
+    std::optional<Clock::time_point> earliest;
+    auto now = Clock::now();
+    for (const auto& [pid, child] : this->children) {
+        std::optional<Clock::time_point> due;
+        if (!child.killed) {
+            due = child.killDeadline;
+        }
+        if (child.exitFd < 0) {
+            // No exit event: poll
+            due = due ? std::min(*due, now + pollInterval) : now + pollInterval;
+        }
+        if (due && (!earliest || *due < *earliest)) {
+            earliest = due;
+        }
+    }
+    if (!earliest) {
+        return -1;
+    }
+    auto remaining = *earliest - now;
+    if (remaining <= Clock::duration::zero()) {
+        return 0;
+    }
+    return static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(remaining).count());
+}
+
+void ProcessReaper::processTimers() {
+    auto now = Clock::now();
+    for (auto it = this->children.begin(); it != this->children.end();) {
+        pid_t pid = it->first;
+        auto& child = it->second;
+        ++it;
+        if (this->tryReap(pid)) {
+            this->forget(pid);
+            continue;
+        }
+        if (!child.killed && child.killDeadline <= now) {
+            LOG_WARN(LogCategory::Pty, "Process {} ignored SIGTERM, killing", pid);
+            kill(pid, SIGKILL);
+            child.killed = true;
+        }
+    }
+}
+
+bool ProcessReaper::tryReap(pid_t pid) {
+    int status = 0;
+    pid_t result = waitpid(pid, &status, WNOHANG);
+    if (result == pid) {
+        return true;
+    }
+    if (result < 0 && errno != EINTR) {
+        // ECHILD: reaped elsewhere, nothing left to wait for
+        if (errno != ECHILD) {
+            LOG_ERROR(LogCategory::Pty, "waitpid error: {}", strerror(errno));
+        }
+        return true;
+    }
+    return false;
+}
+
+void ProcessReaper::forget(pid_t pid) {
+    auto it = this->children.find(pid);
+    if (it == this->children.end()) {
+        return;
+    }
+    if (it->second.exitFd >= 0) {
+        this->eventLoop.unwatch(it->second.exitFd);
+        close(it->second.exitFd);
+    }
+    this->children.erase(it);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "EventLoop.h"
+#include <chrono>
+#include <sys/types.h>
+#include <unordered_map>
+
+/**
+ * Asynchronous termination of child processes
+ *
+ * Features:
+ * - SIGTERM right away, SIGKILL once the grace period expires; never sleeps
+ * - Exit is a reactor event: child exit descriptor (pidfd) is watched on the event loop
+ * - Without exit descriptor (macOS, old kernels) children are polled with waitpid(WNOHANG)
+ * - Timers are driven by the owner: fold nextTimeoutMs() into the wait, call processTimers() after it
+ */
+class ProcessReaper {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * How often children without exit descriptor are polled
+     */
+    static constexpr Clock::duration pollInterval = std::chrono::milliseconds(50);
+
+    /**
+     * Constructor
+     * @param eventLoop loop to watch exit descriptors on, must outlive the reaper
+     * @param gracePeriod time between SIGTERM and SIGKILL
+     */
+    explicit ProcessReaper(EventLoop& eventLoop, Clock::duration gracePeriod = std::chrono::seconds(2));
+
+    /**
+     * Destructor - kills children that are still pending (they are reaped by init after we exit)
+     */
+    ~ProcessReaper();
+
+    // Disable copying and moving
+    ProcessReaper(const ProcessReaper&) = delete;
+    ProcessReaper& operator=(const ProcessReaper&) = delete;
+    ProcessReaper(ProcessReaper&&) = delete;
+    ProcessReaper& operator=(ProcessReaper&&) = delete;
+
+    /**
+     * Take over child process: send SIGTERM and reap it once it exits
+     * @param pid child process (ignored if <= 0)
+     * @param exitFd pidfd of child or -1, ownership is taken
+     */
+    void terminate(pid_t pid, int exitFd);
+
+    /**
+     * Time until the next kill deadline or poll
+     * @return milliseconds to wait, -1 if nothing is pending
+     */
+    int nextTimeoutMs() const;
+
+    /**
+     * Kill children whose grace period expired, poll children without exit descriptor
+     */
+    void processTimers();
+
+    /**
+     * Number of children not reaped yet
+     */
+    size_t getPendingCount() const { return this->children.size(); }
+
+private:
+    struct PendingChild {
+        int exitFd = -1;
+        Clock::time_point killDeadline;
+        bool killed = false;
+    };
+
+    /**
+     * Collect exit status of child if it exited
+     * @return true if child is gone
+     */
+    bool tryReap(pid_t pid);
+
+    /**
+     * Stop tracking child and close its exit descriptor
+     */
+    void forget(pid_t pid);
+
+private:
+    EventLoop& eventLoop;
+    Clock::duration gracePeriod;
+    std::unordered_map<pid_t, PendingChild> children;
+};
@@ -0,0 +1,152 @@
+#include "PtyRecording.h"
+#include <iterator>
+
+namespace PtyRecording {
+
+namespace {
+
+void writeVarint(std::string& bytes, uint64_t value) {
+    while (value >= 0x80) {
+        bytes += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    bytes += static_cast<char>(value);
+}
+
+/**
+ * Read varint, unlike ScrollbackBuffer's own data a recording may end mid-value
+ * @return false if bytes ended before the value did
+ */
+bool readVarint(std::string_view& bytes, uint64_t& value) {
+    value = 0;
+    int shift = 0;
+    while (!bytes.empty() && shift < 64) {
+        auto byte = static_cast<uint8_t>(bytes.front());
+        bytes.remove_prefix(1);
+        value |= uint64_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+        shift += 7;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+bool Writer::open(const std::filesystem::path& path, size_t rows, size_t columns, Clock::time_point now) {
+    this->close();
+    this->file.open(path, std::ios::binary | std::ios::trunc);
+    if (!this->file.is_open()) {
+        return false;
+    }
+    this->record.assign(magic);
+    writeVarint(this->record, version);
+    writeVarint(this->record, rows);
+    writeVarint(this->record, columns);
+    this->file.write(this->record.data(), static_cast<std::streamsize>(this->record.size()));
+    this->lastRecordTime = now;
+    return this->file.good();
+}
+
+void Writer::close() {
+    if (this->file.is_open()) {
+        this->file.close();
+    }
+}
+
+void Writer::writeOutput(std::string_view bytes, Clock::time_point now) {
+    if (!this->file.is_open() || bytes.empty()) {
+        return;
+    }
+    this->beginRecord(Record::Kind::Output, now);
+    writeVarint(this->record, bytes.size());
+    this->file.write(this->record.data(), static_cast<std::streamsize>(this->record.size()));
+    this->file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+void Writer::writeResize(size_t rows, size_t columns, Clock::time_point now) {
+    if (!this->file.is_open()) {
+        return;
+    }
+    this->beginRecord(Record::Kind::Resize, now);
+    writeVarint(this->record, rows);
+    writeVarint(this->record, columns);
+    this->file.write(this->record.data(), static_cast<std::streamsize>(this->record.size()));
+}
+
+void Writer::beginRecord(Record::Kind kind, Clock::time_point now) {
+    // Time points come from the caller: an out-of-order one is recorded as no delay
+    auto delay = std::chrono::duration_cast<std::chrono::microseconds>(now - this->lastRecordTime);
+    if (delay.count() < 0) {
+        delay = {};
+    } else {
+        this->lastRecordTime = now;
+    }
+    this->record.clear();
+    writeVarint(this->record, static_cast<uint64_t>(kind));
+    writeVarint(this->record, static_cast<uint64_t>(delay.count()));
+}
+
+bool Reader::open(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    this->contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    this->remaining = this->contents;
+
+    if (!this->remaining.starts_with(magic)) {
+        return false;
+    }
+    this->remaining.remove_prefix(magic.size());
+    uint64_t fileVersion = 0;
+    uint64_t rows = 0;
+    uint64_t columns = 0;
+    if (!readVarint(this->remaining, fileVersion) || fileVersion != version ||
+        !readVarint(this->remaining, rows) || !readVarint(this->remaining, columns)) {
+        return false;
+    }
+    this->initialRows = static_cast<size_t>(rows);
+    this->initialColumns = static_cast<size_t>(columns);
+    return true;
+}
+
+bool Reader::next(Record& record) {
+    uint64_t kind = 0;
+    uint64_t delay = 0;
+    if (!readVarint(this->remaining, kind) || !readVarint(this->remaining, delay)) {
+        return false;
+    }
+    record.delay = std::chrono::microseconds(static_cast<int64_t>(delay));
+
+    if (kind == static_cast<uint64_t>(Record::Kind::Output)) {
+        uint64_t length = 0;
+        if (!readVarint(this->remaining, length) || length > this->remaining.size()) {
+            return false;
+        }
+        record.kind = Record::Kind::Output;
+        record.bytes.assign(this->remaining.substr(0, static_cast<size_t>(length)));
+        record.rows = 0;
+        record.columns = 0;
+        this->remaining.remove_prefix(static_cast<size_t>(length));
+        return true;
+    }
+    if (kind == static_cast<uint64_t>(Record::Kind::Resize)) {
+        uint64_t rows = 0;
+        uint64_t columns = 0;
+        if (!readVarint(this->remaining, rows) || !readVarint(this->remaining, columns)) {
+            return false;
+        }
+        record.kind = Record::Kind::Resize;
+        record.bytes.clear();
+        record.rows = static_cast<size_t>(rows);
+        record.columns = static_cast<size_t>(columns);
+        return true;
+    }
+    // Unknown record kind: the rest can't be framed
+    this->remaining = {};
+    return false;
+}
+
+} // namespace PtyRecording
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+/**
+ * PTY stream recording: the exact bytes a session handed to the emulator, chunk by chunk
+ *
+ * Used to reproduce slowdowns offline: a recording keeps the drain boundaries and the
+ * time between them, so replaying it drives AnsiProcessor, VirtualScreen and the block
+ * mode pipeline exactly like the live session did, without a shell.
+ *
+ * File format (integers are LEB128 varints):
+ * - header: magic "TMHPTYR", format version, initial screen rows, columns
+ * - records: kind, microseconds since previous record, then
+ *   output: byte count + bytes; resize: rows, columns
+ * A record cut off by a crash is ignored on reading.
+ */
+namespace PtyRecording {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::string_view magic = "TMHPTYR";
+constexpr uint64_t version = 1;
+
+/**
+ * One recorded event
+ */
+struct Record {
+    enum class Kind : uint8_t {
+        Output = 0,  // Bytes of one drain
+        Resize = 1   // Screen size change
+    };
+
+    Kind kind = Kind::Output;
+    std::chrono::microseconds delay{};  // Time since previous record (or recording start)
+    std::string bytes;                  // Output only
+    size_t rows = 0;                    // Resize only
+    size_t columns = 0;                 // Resize only
+};
+
+/**
+ * Appends records to a recording file
+ */
+class Writer {
+public:
+    /**
+     * Create (truncate) recording file and write header
+     * @param path file to write
+     * @param rows screen rows when recording starts
+     * @param columns screen columns when recording starts
+     * @param now recording start time (first record's delay is measured from it)
+     * @return false if the file can't be created
+     */
+    bool open(const std::filesystem::path& path, size_t rows, size_t columns, Clock::time_point now);
+
+    /**
+     * Flush and close file (no-op if not open)
+     */
+    void close();
+
+    bool isOpen() const { return this->file.is_open(); }
+
+    /**
+     * Record output chunk
+     */
+    void writeOutput(std::string_view bytes, Clock::time_point now);
+
+    /**
+     * Record screen size change
+     */
+    void writeResize(size_t rows, size_t columns, Clock::time_point now);
+
+private:
+    /**
+     * Start record in the scratch buffer: kind and delay since the previous one
+     */
+    void beginRecord(Record::Kind kind, Clock::time_point now);
+
+    std::ofstream file;
+    std::string record;  // Scratch buffer, reused between records
+    Clock::time_point lastRecordTime;
+};
+
+/**
+ * Reads a recording file written by Writer
+ */
+class Reader {
+public:
+    /**
+     * Load recording and check its header
+     * @return false if the file can't be read or is not a recording of a known version
+     */
+    bool open(const std::filesystem::path& path);
+
+    /**
+     * Screen size when recording started
+     */
+    size_t rows() const { return this->initialRows; }
+    size_t columns() const { return this->initialColumns; }
+
+    /**
+     * Read next record
+     * @return false at end of recording (or at a truncated last record)
+     */
+    bool next(Record& record);
+
+private:
+    std::string contents;
+    std::string_view remaining;
+    size_t initialRows = 0;
+    size_t initialColumns = 0;
+};
+
+} // namespace PtyRecording
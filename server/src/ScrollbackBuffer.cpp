@@ -0,0 +1,219 @@
+#include "ScrollbackBuffer.h"
+#include <algorithm>
+
+namespace {
+
+void writeVarint(std::string& bytes, uint64_t value) {
+    while (value >= 0x80) {
+        bytes += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    bytes += static_cast<char>(value);
+}
+
+uint64_t readVarint(std::string_view& bytes) {
+    uint64_t value = 0;
+    int shift = 0;
+    while (!bytes.empty()) {
+        auto byte = static_cast<uint8_t>(bytes.front());
+        bytes.remove_prefix(1);
+        value |= uint64_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            break;
+        }
+        shift += 7;
+    }
+    return value;
+}
+
+} // anonymous namespace
+
+ScrollbackBuffer::ScrollbackBuffer(Limits limits)
+    : currentLimits(limits)
+{
+}
+
+void ScrollbackBuffer::append(uint64_t commandId, const std::vector<StyledSegment>& segments) {
+    if (this->currentLimits.maxLines == 0 || this->currentLimits.maxBytes == 0) {
+        return;
+    }
+
+    // Make room up front: ids of runs already interned must stay valid for this line
+    if (this->styleTable.size() + segments.size() > termihui::StyleTable::capacity) {
+        this->compactStyles();
+    }
+
+    std::vector<PackedRun> runs;
+    runs.reserve(segments.size());
+    for (const auto& segment : segments) {
+        if (!segment.text.empty()) {
+            runs.push_back(PackedRun{this->internStyle(segment.style), segment.text});
+        }
+    }
+    this->appendPacked(commandId, runs);
+    this->evict();
+}
+
+std::optional<std::vector<std::vector<StyledSegment>>> ScrollbackBuffer::commandLines(uint64_t commandId) const {
+    auto it = this->commands.find(commandId);
+    if (it == this->commands.end() || it->second.firstLine < this->firstLine()) {
+        return std::nullopt;
+    }
+
+    std::vector<std::vector<StyledSegment>> lines;
+    const CommandSpan& span = it->second;
+    for (uint64_t line = span.firstLine; line <= span.lastLine;) {
+        const Page* page = this->pageOf(line);
+        size_t end = std::min<uint64_t>(page->lineOffsets.size(), span.lastLine - page->firstLine + 1);
+        for (size_t index = static_cast<size_t>(line - page->firstLine); index < end; ++index, ++line) {
+            std::string_view bytes = lineBytes(*page, index);
+            if (readCommandId(bytes) != commandId) {
+                continue;
+            }
+            std::vector<StyledSegment> segments;
+            for (const auto& run : readRuns(bytes)) {
+                segments.push_back(StyledSegment{std::string(run.text), this->styleTable.style(run.styleId)});
+            }
+            lines.push_back(std::move(segments));
+        }
+    }
+    return lines;
+}
+
+void ScrollbackBuffer::setLimits(Limits limits) {
+    this->currentLimits = limits;
+    if (limits.maxLines == 0 || limits.maxBytes == 0) {
+        this->clear();
+    } else {
+        this->evict();
+    }
+}
+
+void ScrollbackBuffer::clear() {
+    this->pages.clear();
+    this->commands.clear();
+    this->styleTable.clear();
+    this->totalPayloadBytes = 0;
+}
+
+size_t ScrollbackBuffer::memoryUsage() const {
+    size_t bytes = this->pages.size() * sizeof(Page);
+    for (const auto& page : this->pages) {
+        bytes += page.bytes.capacity() + page.lineOffsets.capacity() * sizeof(uint32_t);
+    }
+    // Style kept in the table's vector and as key of its index
+    bytes += this->styleTable.size() * (2 * sizeof(TextStyle) + sizeof(StyleId));
+    bytes += this->commands.size() * (sizeof(uint64_t) + sizeof(CommandSpan));
+    return bytes;
+}
+
+const ScrollbackBuffer::Page* ScrollbackBuffer::pageOf(uint64_t line) const {
+    // Last page starting at or before line
+    auto it = std::upper_bound(this->pages.begin(), this->pages.end(), line,
+                               [](uint64_t value, const Page& page) { return value < page.firstLine; });
+    return &*std::prev(it);
+}
+
+std::string_view ScrollbackBuffer::lineBytes(const Page& page, size_t index) {
+    size_t begin = page.lineOffsets[index];
+    size_t end = index + 1 < page.lineOffsets.size() ? page.lineOffsets[index + 1] : page.bytes.size();
+    return std::string_view(page.bytes).substr(begin, end - begin);
+}
+
+uint64_t ScrollbackBuffer::readCommandId(std::string_view& bytes) {
+    return readVarint(bytes);
+}
+
+std::vector<ScrollbackBuffer::PackedRun> ScrollbackBuffer::readRuns(std::string_view bytes) {
+    std::vector<PackedRun> runs(static_cast<size_t>(readVarint(bytes)));
+    for (auto& run : runs) {
+        run.styleId = static_cast<StyleId>(readVarint(bytes));
+        size_t length = static_cast<size_t>(readVarint(bytes));
+        run.text = bytes.substr(0, length);
+        bytes.remove_prefix(run.text.size());
+    }
+    return runs;
+}
+
+void ScrollbackBuffer::appendPacked(uint64_t commandId, const std::vector<PackedRun>& runs) {
+    if (this->pages.empty() || this->pages.back().bytes.size() >= pageBytes) {
+        Page page;
+        page.firstLine = this->nextLine;
+        page.bytes.reserve(pageBytes + 256);
+        this->pages.push_back(std::move(page));
+    }
+
+    Page& page = this->pages.back();
+    size_t sizeBefore = page.bytes.size();
+    page.lineOffsets.push_back(static_cast<uint32_t>(sizeBefore));
+    writeVarint(page.bytes, commandId);
+    writeVarint(page.bytes, runs.size());
+    for (const auto& run : runs) {
+        writeVarint(page.bytes, run.styleId);
+        writeVarint(page.bytes, run.text.size());
+        page.bytes.append(run.text);
+    }
+    this->totalPayloadBytes += page.bytes.size() - sizeBefore;
+
+    auto [it, inserted] = this->commands.try_emplace(commandId, CommandSpan{this->nextLine, this->nextLine});
+    if (!inserted) {
+        it->second.lastLine = this->nextLine;
+    }
+    ++this->nextLine;
+}
+
+StyleId ScrollbackBuffer::internStyle(const TextStyle& style) {
+    return this->styleTable.intern(style);
+}
+
+void ScrollbackBuffer::compactStyles() {
+    std::vector<bool> used(this->styleTable.size(), false);
+    for (const auto& page : this->pages) {
+        for (size_t index = 0; index < page.lineOffsets.size(); ++index) {
+            std::string_view bytes = lineBytes(page, index);
+            readCommandId(bytes);
+            for (const auto& run : readRuns(bytes)) {
+                used[run.styleId] = true;
+            }
+        }
+    }
+    std::vector<StyleId> remap = this->styleTable.compact(used);
+
+    // Ids are varints: repack every page with the new numbering
+    std::deque<Page> oldPages = std::move(this->pages);
+    this->pages.clear();
+    this->totalPayloadBytes = 0;
+    uint64_t nextLine = this->nextLine;
+    for (const auto& oldPage : oldPages) {
+        this->nextLine = oldPage.firstLine;
+        for (size_t index = 0; index < oldPage.lineOffsets.size(); ++index) {
+            std::string_view bytes = lineBytes(oldPage, index);
+            uint64_t commandId = readCommandId(bytes);
+            auto runs = readRuns(bytes);
+            for (auto& run : runs) {
+                run.styleId = remap[run.styleId];
+            }
+            this->appendPacked(commandId, runs);
+        }
+    }
+    this->nextLine = nextLine;
+}
+
+void ScrollbackBuffer::evict() {
+    // Whole pages only; the page being filled always stays
+    bool evicted = false;
+    while (this->pages.size() > 1 &&
+           (this->lineCount() > this->currentLimits.maxLines ||
+            this->totalPayloadBytes > this->currentLimits.maxBytes)) {
+        this->totalPayloadBytes -= this->pages.front().bytes.size();
+        this->pages.pop_front();
+        evicted = true;
+    }
+    if (!evicted) {
+        return;
+    }
+
+    // Forget commands whose lines are all gone (partially evicted ones stay, reported as not held)
+    uint64_t first = this->firstLine();
+    std::erase_if(this->commands, [first](const auto& entry) { return entry.second.lastLine < first; });
+}
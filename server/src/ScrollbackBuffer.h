@@ -0,0 +1,130 @@
+#pragma once
+
+#include <termihui/style_table.h>
+#include <termihui/text_style.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Bounded in-memory scrollback of one session
+ *
+ * Keeps the rendered lines that scrolled off the screen, so history requests and
+ * reattaching clients are served without SQLite queries and JSON parsing.
+ * SQLite stays the durable copy; lines evicted from here are read from there.
+ *
+ * Features:
+ * - Lines are packed as style runs: varint style id + UTF-8 text, styles interned in
+ *   an own StyleTable (a style costs 1-3 bytes per run instead of a JSON object)
+ * - Lines go into fixed-size pages; the oldest page is dropped once the line or byte
+ *   limit is exceeded, so eviction is one deque pop
+ * - Lines are looked up per command: a command is served from memory only while
+ *   none of its lines were evicted
+ */
+class ScrollbackBuffer {
+public:
+    /**
+     * Retention limits (whichever is hit first evicts the oldest page)
+     */
+    struct Limits {
+        size_t maxLines = 10000;
+        size_t maxBytes = 4 * 1024 * 1024;
+    };
+
+    /**
+     * Page payload size at which a new page is started
+     */
+    static constexpr size_t pageBytes = 16 * 1024;
+
+    ScrollbackBuffer() = default;
+    explicit ScrollbackBuffer(Limits limits);
+
+    /**
+     * Append line that scrolled off the screen
+     * @param commandId command the line belongs to
+     * @param segments rendered line
+     */
+    void append(uint64_t commandId, const std::vector<StyledSegment>& segments);
+
+    /**
+     * Get all lines of command, oldest first
+     * @return lines, nullopt if the command's lines are not (or no longer completely) held
+     */
+    std::optional<std::vector<std::vector<StyledSegment>>> commandLines(uint64_t commandId) const;
+
+    /**
+     * Change limits, evicting right away if the buffer is over them
+     */
+    void setLimits(Limits limits);
+
+    const Limits& limits() const { return this->currentLimits; }
+
+    /**
+     * Drop all lines
+     */
+    void clear();
+
+    /**
+     * Number of lines held
+     */
+    size_t lineCount() const { return static_cast<size_t>(this->nextLine - this->firstLine()); }
+
+    /**
+     * Bytes of packed line data held (what the byte limit applies to)
+     */
+    size_t payloadBytes() const { return this->totalPayloadBytes; }
+
+    /**
+     * Approximate heap memory used, including page and style table overhead
+     */
+    size_t memoryUsage() const;
+
+private:
+    /**
+     * Run of packed lines; bytes hold lines back to back, lineOffsets where each starts
+     */
+    struct Page {
+        uint64_t firstLine = 0;
+        std::string bytes;
+        std::vector<uint32_t> lineOffsets;
+    };
+
+    /**
+     * Numbers of the first and last line of a command
+     */
+    struct CommandSpan {
+        uint64_t firstLine = 0;
+        uint64_t lastLine = 0;
+    };
+
+    /**
+     * Style run of a packed line (text points into page bytes)
+     */
+    struct PackedRun {
+        StyleId styleId = 0;
+        std::string_view text;
+    };
+
+    uint64_t firstLine() const { return this->pages.empty() ? this->nextLine : this->pages.front().firstLine; }
+    const Page* pageOf(uint64_t line) const;
+    static std::string_view lineBytes(const Page& page, size_t index);
+    static uint64_t readCommandId(std::string_view& bytes);
+    static std::vector<PackedRun> readRuns(std::string_view bytes);
+    void appendPacked(uint64_t commandId, const std::vector<PackedRun>& runs);
+    StyleId internStyle(const TextStyle& style);
+    void compactStyles();
+    void evict();
+
+private:
+    Limits currentLimits;
+    termihui::StyleTable styleTable;
+    std::deque<Page> pages;
+    std::unordered_map<uint64_t, CommandSpan> commands;
+    uint64_t nextLine = 0;
+    size_t totalPayloadBytes = 0;
+};
@@ -1,6 +1,6 @@
 #include "SessionStorage.h"
+#include "Logger.h"
 #include <chrono>
-#include <fmt/format.h>
 
 using namespace sqlite_orm;
 
@@ -8,13 +8,13 @@ SessionStorage::SessionStorage(std::filesystem::path dbPath)
     : dbPath(std::move(dbPath))
     , storage(makeSessionStorage(this->dbPath.string()))
 {
-    fmt::print("[SessionStorage] Created with path: {}\n", this->dbPath.string());
+    LOG_DEBUG(LogCategory::Storage, "Created with path: {}", this->dbPath.string());
 }
 
 void SessionStorage::initialize() {
     this->storage.sync_schema();
     auto count = this->storage.count<SessionCommand>();
-    fmt::print("[SessionStorage] Commands count: {}\n", count);
+    LOG_DEBUG(LogCategory::Storage, "Commands count: {}", count);
 }
 
 uint64_t SessionStorage::addCommand(uint64_t serverRunId, const std::string& command, const std::string& cwdStart) {
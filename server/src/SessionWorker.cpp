@@ -0,0 +1,241 @@
+#include "SessionWorker.h"
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <optional>
+
+SessionWorker::SessionWorker(OutputHandler outputHandler, FlushHandler flushHandler)
+    : outputHandler(std::move(outputHandler))
+    , flushHandler(std::move(flushHandler))
+    , ownedEventLoop(std::make_unique<EventLoop>())
+    , eventLoop(this->ownedEventLoop.get())
+    , processReaper(*this->eventLoop)
+{
+}
+
+SessionWorker::SessionWorker(EventLoop& eventLoop, OutputHandler outputHandler, FlushHandler flushHandler)
+    : outputHandler(std::move(outputHandler))
+    , flushHandler(std::move(flushHandler))
+    , eventLoop(&eventLoop)
+    , processReaper(eventLoop)
+{
+}
+
+SessionWorker::~SessionWorker() {
+    this->stop();
+}
+
+void SessionWorker::start() {
+    if (!this->ownedEventLoop || this->running.exchange(true)) {
+        return;
+    }
+    this->workerThread = std::make_unique<std::thread>([this]() {
+        this->run();
+    });
+}
+
+void SessionWorker::stop() {
+    if (this->running.exchange(false)) {
+        this->eventLoop->wakeup();
+        if (this->workerThread && this->workerThread->joinable()) {
+            this->workerThread->join();
+        }
+        this->workerThread.reset();
+    }
+
+    // Thread is gone: finish queued work here so handed-over sessions are not leaked
+    this->runPendingTasks();
+
+    // All shells get SIGHUP/SIGTERM at once; whoever is still alive when the worker
+    // is destroyed gets SIGKILL instead of being waited for one by one
+    for (auto& [sessionId, session] : this->sessions) {
+        this->retireSession(*session);
+    }
+    this->processReaper.processTimers();
+    this->sessions.clear();
+    this->writeWatchedSessions.clear();
+    this->sessionCount.store(0);
+}
+
+void SessionWorker::addSession(std::unique_ptr<TerminalSessionController> session) {
+    // std::function must be copyable, so hand the unique_ptr over through a shared holder
+    auto sessionHolder = std::make_shared<std::unique_ptr<TerminalSessionController>>(std::move(session));
+    this->post([this, sessionHolder]() {
+        auto& session = *sessionHolder;
+        uint64_t sessionId = session->getSessionId();
+        this->watchSession(*session);
+        this->sessions[sessionId] = std::move(session);
+        this->sessionCount.store(this->sessions.size());
+    });
+}
+
+void SessionWorker::removeSession(uint64_t sessionId) {
+    this->post([this, sessionId]() {
+        auto it = this->sessions.find(sessionId);
+        if (it == this->sessions.end()) {
+            return;
+        }
+        this->retireSession(*it->second);
+        this->sessions.erase(it);
+        this->writeWatchedSessions.erase(sessionId);
+        this->sessionCount.store(this->sessions.size());
+    });
+}
+
+void SessionWorker::post(uint64_t sessionId, SessionTask task) {
+    this->post([this, sessionId, task = std::move(task)]() {
+        auto it = this->sessions.find(sessionId);
+        if (it == this->sessions.end()) {
+            LOG_WARN(LogCategory::Session, "Session {} not owned by worker, task dropped", sessionId);
+            return;
+        }
+        task(*it->second);
+        this->updateWriteInterest(*it->second);
+    });
+}
+
+void SessionWorker::post(std::function<void()> task) {
+    if (!this->ownedEventLoop) {
+        // Inline worker: we are already on the owning thread
+        task();
+        return;
+    }
+    this->taskQueue.push(std::move(task));
+    this->eventLoop->wakeup();
+}
+
+int SessionWorker::nextTimeoutMs() const {
+    int flushTimeoutMs = this->nextFlushTimeoutMs();
+    int reaperTimeoutMs = this->processReaper.nextTimeoutMs();
+    if (flushTimeoutMs < 0) {
+        return reaperTimeoutMs;
+    }
+    if (reaperTimeoutMs < 0) {
+        return flushTimeoutMs;
+    }
+    return std::min(flushTimeoutMs, reaperTimeoutMs);
+}
+
+void SessionWorker::processTimers() {
+    this->flushDueSessions();
+    this->processReaper.processTimers();
+}
+
+int SessionWorker::nextFlushTimeoutMs() const {
+    if (!this->flushHandler) {
+        return -1;
+    }
+    std::optional<FramePacer::Clock::time_point> earliestDeadline;
+    for (const auto& [sessionId, session] : this->sessions) {
+        const auto& pendingDeadline = session->getFramePacer().getPendingDeadline();
+        if (pendingDeadline && (!earliestDeadline || *pendingDeadline < *earliestDeadline)) {
+            earliestDeadline = pendingDeadline;
+        }
+    }
+    if (!earliestDeadline) {
+        return -1;
+    }
+    auto remaining = *earliestDeadline - FramePacer::Clock::now();
+    if (remaining <= FramePacer::Clock::duration::zero()) {
+        return 0;
+    }
+    // Round up: waking before the deadline would just spin until it passes
+    return static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(remaining).count());
+}
+
+void SessionWorker::flushDueSessions() {
+    if (!this->flushHandler) {
+        return;
+    }
+    auto now = FramePacer::Clock::now();
+    for (auto& [sessionId, session] : this->sessions) {
+        const auto& pendingDeadline = session->getFramePacer().getPendingDeadline();
+        if (pendingDeadline && *pendingDeadline <= now) {
+            this->flushHandler(*session);
+        }
+    }
+}
+
+void SessionWorker::run() {
+    while (this->running.load()) {
+        this->eventLoop->wait(this->nextTimeoutMs());
+        this->runPendingTasks();
+        this->processTimers();
+    }
+}
+
+void SessionWorker::runPendingTasks() {
+    for (auto& task : this->taskQueue.takeAll()) {
+        task();
+    }
+}
+
+void SessionWorker::watchSession(TerminalSessionController& session) {
+    int ptyFd = session.getPtyFd();
+    uint64_t sessionId = session.getSessionId();
+    this->eventLoop->watch(ptyFd, EventLoop::Readable, [this, sessionId, ptyFd](uint32_t events) {
+        auto it = this->sessions.find(sessionId);
+        if (it == this->sessions.end()) {
+            this->eventLoop->unwatch(ptyFd);
+            return;
+        }
+        auto& session = *it->second;
+        if (events & EventLoop::Readable) {
+            // Read first: a shell blocked on echoing input can't accept more of it
+            this->outputHandler(session);
+        } else if (events & EventLoop::Hangup) {
+            // Shell side closed and everything is drained: level-triggered hangup
+            // would fire on every wait, so stop watching this PTY
+            LOG_INFO(LogCategory::Session, "Session {} PTY hung up", sessionId);
+            this->eventLoop->unwatch(ptyFd);
+            this->writeWatchedSessions.erase(sessionId);
+            return;
+        }
+        if (events & EventLoop::Writable) {
+            session.flushPendingInput();
+            this->updateWriteInterest(session);
+        }
+    });
+
+    int childExitFd = session.getChildExitFd();
+    if (childExitFd < 0) {
+        return;
+    }
+    this->eventLoop->watch(childExitFd, EventLoop::Readable, [this, sessionId, childExitFd](uint32_t) {
+        this->eventLoop->unwatch(childExitFd);
+        auto it = this->sessions.find(sessionId);
+        if (it == this->sessions.end()) {
+            return;
+        }
+        LOG_INFO(LogCategory::Session, "Session {} shell exited", sessionId);
+        it->second->handleChildExit();
+        // Report through the output path: remaining output and the finished state
+        this->outputHandler(*it->second);
+    });
+}
+
+void SessionWorker::retireSession(TerminalSessionController& session) {
+    this->eventLoop->unwatch(session.getPtyFd());
+    if (session.getChildExitFd() >= 0) {
+        this->eventLoop->unwatch(session.getChildExitFd());
+    }
+    this->writeWatchedSessions.erase(session.getSessionId());
+    auto child = session.releaseChild();
+    this->processReaper.terminate(child.pid, child.exitFd);
+}
+
+void SessionWorker::updateWriteInterest(TerminalSessionController& session) {
+    uint64_t sessionId = session.getSessionId();
+    bool wantsWrite = session.hasPendingInput();
+    if (wantsWrite == this->writeWatchedSessions.contains(sessionId)) {
+        return;
+    }
+    uint32_t events = EventLoop::Readable;
+    if (wantsWrite) {
+        events |= EventLoop::Writable;
+        this->writeWatchedSessions.insert(sessionId);
+    } else {
+        this->writeWatchedSessions.erase(sessionId);
+    }
+    this->eventLoop->modify(session.getPtyFd(), events);
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "EventLoop.h"
+#include "ProcessReaper.h"
+#include "TerminalSessionController.h"
+#include <termihui/thread_safe_queue.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * Owner of a shard of terminal sessions
+ *
+ * Features:
+ * - Owns PTY, emulator and storage of its sessions; all access happens on one thread
+ * - Threaded mode: private event loop on a dedicated thread, work is posted via task queue
+ * - Inline mode: shares the caller's event loop, tasks run immediately (no extra thread)
+ * - Input queued by a session (see TerminalSessionController::sendInput) is flushed
+ *   when its PTY becomes writable
+ * - Shell exit is an event on the loop; removed sessions are terminated asynchronously
+ *   (SIGTERM, SIGKILL after grace period) without blocking the loop
+ */
+class SessionWorker {
+public:
+    /**
+     * Called on the worker thread when a session PTY has output to process
+     */
+    using OutputHandler = std::function<void(TerminalSessionController&)>;
+
+    /**
+     * Work to run against a session on the worker thread
+     */
+    using SessionTask = std::function<void(TerminalSessionController&)>;
+
+    /**
+     * Called on the worker thread when a session's deferred frame is due
+     * (see FramePacer); must send or cancel the pending frame
+     */
+    using FlushHandler = std::function<void(TerminalSessionController&)>;
+
+    /**
+     * Create threaded worker (call start() to launch the thread)
+     * @param outputHandler PTY output handler
+     * @param flushHandler deferred frame handler (empty = frames are never deferred)
+     */
+    explicit SessionWorker(OutputHandler outputHandler, FlushHandler flushHandler = {});
+
+    /**
+     * Create inline worker that runs on the thread driving eventLoop
+     * Caller must fold nextFlushTimeoutMs() into its wait and call flushDueSessions() after it.
+     * @param eventLoop caller's event loop, must outlive the worker
+     * @param outputHandler PTY output handler
+     * @param flushHandler deferred frame handler (empty = frames are never deferred)
+     */
+    SessionWorker(EventLoop& eventLoop, OutputHandler outputHandler, FlushHandler flushHandler = {});
+
+    /**
+     * Destructor - stops thread, terminates owned sessions and kills shells still alive
+     */
+    ~SessionWorker();
+
+    // Disable copying and moving
+    SessionWorker(const SessionWorker&) = delete;
+    SessionWorker& operator=(const SessionWorker&) = delete;
+    SessionWorker(SessionWorker&&) = delete;
+    SessionWorker& operator=(SessionWorker&&) = delete;
+
+    /**
+     * Launch worker thread (no-op for inline worker)
+     */
+    void start();
+
+    /**
+     * Stop worker thread and terminate all owned sessions (doesn't wait for shells to exit)
+     */
+    void stop();
+
+    /**
+     * Take ownership of created session and start watching its PTY
+     * @param session session with already created PTY
+     */
+    void addSession(std::unique_ptr<TerminalSessionController> session);
+
+    /**
+     * Terminate and destroy session (shell is reaped asynchronously)
+     * @param sessionId session to remove (ignored if not owned)
+     */
+    void removeSession(uint64_t sessionId);
+
+    /**
+     * Run task against owned session on the worker thread
+     * Tasks for one worker run in posting order; task is dropped if session is gone by then
+     * @param sessionId target session
+     * @param task work to run
+     */
+    void post(uint64_t sessionId, SessionTask task);
+
+    /**
+     * Number of owned sessions (safe to call from any thread)
+     */
+    size_t getSessionCount() const { return this->sessionCount.load(); }
+
+    /**
+     * Check if worker runs on the caller's event loop
+     */
+    bool isInline() const { return !this->ownedEventLoop; }
+
+    /**
+     * Time until the earliest deferred frame or termination deadline is due (worker thread only)
+     * @return milliseconds to wait, -1 if nothing is pending
+     */
+    int nextTimeoutMs() const;
+
+    /**
+     * Flush due deferred frames and advance terminations of removed shells (worker thread only)
+     */
+    void processTimers();
+
+    /**
+     * Number of removed shells not reaped yet (worker thread only)
+     */
+    size_t getTerminatingCount() const { return this->processReaper.getPendingCount(); }
+
+private:
+    /**
+     * Queue task for the worker thread (runs immediately in inline mode)
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * Worker thread body
+     */
+    void run();
+
+    /**
+     * Execute all queued tasks
+     */
+    void runPendingTasks();
+
+    /**
+     * Time until the earliest deferred frame of owned sessions is due
+     * @return milliseconds to wait, -1 if no frame is pending
+     */
+    int nextFlushTimeoutMs() const;
+
+    /**
+     * Invoke flush handler for sessions whose deferred frame is due
+     */
+    void flushDueSessions();
+
+    /**
+     * Register session PTY and child exit descriptor with event loop
+     */
+    void watchSession(TerminalSessionController& session);
+
+    /**
+     * Stop watching session and hand its shell over to the reaper
+     */
+    void retireSession(TerminalSessionController& session);
+
+    /**
+     * Watch session PTY for writability while it has queued input
+     */
+    void updateWriteInterest(TerminalSessionController& session);
+
+private:
+    OutputHandler outputHandler;
+    FlushHandler flushHandler;
+
+    // Event loop used for session PTYs (owned in threaded mode, borrowed in inline mode)
+    std::unique_ptr<EventLoop> ownedEventLoop;
+    EventLoop* eventLoop = nullptr;
+
+    // Shells of removed sessions until they exit (worker thread only)
+    ProcessReaper processReaper;
+
+    std::unique_ptr<std::thread> workerThread;
+    std::atomic<bool> running{false};
+    termihui::ThreadSafeQueue<std::function<void()>> taskQueue;
+
+    // Owned sessions (accessed on worker thread only)
+    std::unordered_map<uint64_t, std::unique_ptr<TerminalSessionController>> sessions;
+    std::atomic<size_t> sessionCount{0};
+
+    // Sessions whose PTY is watched for writability (worker thread only)
+    std::unordered_set<uint64_t> writeWatchedSessions;
+};
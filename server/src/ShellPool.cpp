@@ -0,0 +1,146 @@
+#include "ShellPool.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr std::string_view promptMarker = "\x1b]133;B";
+
+} // anonymous namespace
+
+ShellPool::ShellPool(EventLoop& eventLoop)
+    : eventLoop(eventLoop)
+    , processReaper(eventLoop)
+{
+}
+
+ShellPool::~ShellPool() {
+    while (!this->shells.empty()) {
+        this->discard(this->shells.size() - 1);
+    }
+}
+
+void ShellPool::setSize(size_t size) {
+    this->size = size;
+    while (this->shells.size() > this->size) {
+        this->discard(this->shells.size() - 1);
+    }
+}
+
+std::optional<ShellPool::Shell> ShellPool::claim() {
+    for (size_t i = 0; i < this->shells.size();) {
+        if (!this->shells[i].ready) {
+            ++i;
+            continue;
+        }
+        if (!isAlive(this->shells[i].shell)) {
+            LOG_WARN(LogCategory::Pty, "Pooled shell {} exited, discarding", this->shells[i].shell.pid);
+            this->discard(i);
+            continue;
+        }
+        Shell shell = this->shells[i].shell;
+        this->shells.erase(this->shells.begin() + static_cast<std::ptrdiff_t>(i));
+        return shell;
+    }
+    return std::nullopt;
+}
+
+int ShellPool::nextTimeoutMs() const {
+    if (this->shells.size() < this->size) {
+        return 0;
+    }
+    return this->processReaper.nextTimeoutMs();
+}
+
+void ShellPool::processTimers() {
+    this->processReaper.processTimers();
+    if (this->shells.size() >= this->size) {
+        return;
+    }
+
+    std::string home;
+    if (const char* homeEnv = getenv("HOME")) {
+        home = homeEnv;
+    }
+    auto shell = TerminalSessionController::spawnShell(home);
+    if (!shell) {
+        // Don't retry in a tight loop: pool is best effort, sessions fall back to spawning
+        this->size = this->shells.size();
+        LOG_WARN(LogCategory::Pty, "Shell pool limited to {} shells after spawn failure", this->size);
+        return;
+    }
+
+    int ptyFd = shell->ptyFd;
+    this->shells.push_back(PooledShell{*shell, false, {}});
+    this->eventLoop.watch(ptyFd, EventLoop::Readable, [this, ptyFd](uint32_t) {
+        this->handleStartupOutput(ptyFd);
+    });
+}
+
+size_t ShellPool::getReadyCount() const {
+    return static_cast<size_t>(std::count_if(this->shells.begin(), this->shells.end(), [](const PooledShell& pooledShell) {
+        return pooledShell.ready;
+    }));
+}
+
+void ShellPool::handleStartupOutput(int ptyFd) {
+    auto it = std::find_if(this->shells.begin(), this->shells.end(), [ptyFd](const PooledShell& pooledShell) {
+        return pooledShell.shell.ptyFd == ptyFd;
+    });
+    if (it == this->shells.end()) {
+        this->eventLoop.unwatch(ptyFd);
+        return;
+    }
+    size_t index = static_cast<size_t>(it - this->shells.begin());
+    auto& pooledShell = *it;
+
+    char buffer[4096];
+    for (;;) {
+        ssize_t bytesRead = read(ptyFd, buffer, sizeof(buffer));
+        if (bytesRead > 0) {
+            // Only the marker matters: keep its possible beginning, drop the rest
+            pooledShell.markerTail.append(buffer, static_cast<size_t>(bytesRead));
+            if (pooledShell.markerTail.find(promptMarker) != std::string::npos) {
+                pooledShell.ready = true;
+                pooledShell.markerTail.clear();
+                this->eventLoop.unwatch(ptyFd);
+                return;
+            }
+            if (pooledShell.markerTail.size() >= promptMarker.size()) {
+                pooledShell.markerTail.erase(0, pooledShell.markerTail.size() - (promptMarker.size() - 1));
+            }
+        } else if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        } else if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        } else {
+            // EOF/EIO: shell died during startup
+            LOG_WARN(LogCategory::Pty, "Pooled shell {} exited during startup", pooledShell.shell.pid);
+            this->discard(index);
+            return;
+        }
+    }
+}
+
+bool ShellPool::isAlive(const Shell& shell) {
+    // WNOWAIT: leave the zombie for the reaper
+    siginfo_t info{};
+    if (waitid(P_PID, static_cast<id_t>(shell.pid), &info, WEXITED | WNOHANG | WNOWAIT) != 0) {
+        return false;
+    }
+    return info.si_pid == 0;
+}
+
+void ShellPool::discard(size_t index) {
+    Shell shell = this->shells[index].shell;
+    this->shells.erase(this->shells.begin() + static_cast<std::ptrdiff_t>(index));
+    this->eventLoop.unwatch(shell.ptyFd);
+    close(shell.ptyFd);
+    this->processReaper.terminate(shell.pid, shell.exitFd);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "EventLoop.h"
+#include "ProcessReaper.h"
+#include "TerminalSessionController.h"
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Pool of pre-spawned shells for instant session creation
+ *
+ * Features:
+ * - Shells are spawned in HOME ahead of time, one per processTimers() call, so the loop stays responsive
+ * - A shell is ready once it printed its first prompt (OSC 133;B): bash startup and rcfile are done
+ * - Startup output is read and discarded while warming; ready shells are not watched
+ * - Dead or surplus shells are terminated through a ProcessReaper
+ *
+ * Main thread only. Fold nextTimeoutMs() into the loop wait and call processTimers() after it.
+ */
+class ShellPool {
+public:
+    using Shell = TerminalSessionController::Shell;
+
+    /**
+     * Constructor
+     * @param eventLoop loop to watch warming shells on, must outlive the pool
+     */
+    explicit ShellPool(EventLoop& eventLoop);
+
+    /**
+     * Destructor - terminates pooled shells
+     */
+    ~ShellPool();
+
+    // Disable copying and moving
+    ShellPool(const ShellPool&) = delete;
+    ShellPool& operator=(const ShellPool&) = delete;
+    ShellPool(ShellPool&&) = delete;
+    ShellPool& operator=(ShellPool&&) = delete;
+
+    /**
+     * Set number of shells to keep ready (0 = pool disabled, surplus shells are terminated)
+     */
+    void setSize(size_t size);
+
+    /**
+     * Take a ready shell out of the pool
+     * Shell sits at its first prompt in HOME; its pending output ends with that prompt.
+     * @return shell, nullopt if none is ready
+     */
+    std::optional<Shell> claim();
+
+    /**
+     * Time until pool wants processTimers() again
+     * @return milliseconds to wait, 0 if pool has to be refilled, -1 if nothing is pending
+     */
+    int nextTimeoutMs() const;
+
+    /**
+     * Spawn one shell if the pool is below its size, advance terminations
+     */
+    void processTimers();
+
+    /**
+     * Number of shells that finished startup
+     */
+    size_t getReadyCount() const;
+
+    /**
+     * Number of shells in the pool (ready and warming)
+     */
+    size_t getShellCount() const { return this->shells.size(); }
+
+private:
+    struct PooledShell {
+        Shell shell;
+        bool ready = false;
+        std::string markerTail;  // Last bytes of startup output (prompt marker split across reads)
+    };
+
+    /**
+     * Read startup output of warming shell, mark it ready once it printed a prompt
+     */
+    void handleStartupOutput(int ptyFd);
+
+    /**
+     * Check if pooled shell process is still alive
+     */
+    static bool isAlive(const Shell& shell);
+
+    /**
+     * Remove shell at index from pool and terminate it
+     */
+    void discard(size_t index);
+
+private:
+    EventLoop& eventLoop;
+    ProcessReaper processReaper;
+    size_t size = 0;
+    std::vector<PooledShell> shells;  // In spawn order: oldest ready shell is claimed first
+};
@@ -1,9 +1,11 @@
 #include "TermihuiServerController.h"
 #include "ServerStorageImpl.h"
 #include "JsonHelper.h"
+#include "Logger.h"
 #include <termihui/protocol/protocol.h>
+#include <termihui/utf8.h>
 #include <fmt/core.h>
-#include <thread>
+#include <algorithm>
 #include <type_traits>
 
 using json = nlohmann::json;
@@ -11,53 +13,68 @@ using json = nlohmann::json;
 namespace {
 
 /**
- * Find byte offset where complete UTF-8 ends in buffer.
- * Returns position after last complete UTF-8 character.
+ * Get JSON encoding of whole (trimmed) row, reused until the row changes
  */
-size_t findCompleteUtf8End(const std::string& data) {
-    if (data.empty()) {
-        return 0;
+const std::string& encodedRow(const termihui::VirtualScreen& screen, size_t row) {
+    return screen.encodedRow(row, encodeSegments);
+}
+
+/**
+ * Serialize full interactive screen snapshot
+ */
+std::string serializeScreenSnapshot(uint64_t sessionId, const termihui::VirtualScreen& screen) {
+    ScreenSnapshotMessage screenSnapshotMessage;
+    screenSnapshotMessage.sessionId = sessionId;
+    screenSnapshotMessage.cursorRow = screen.cursorRow();
+    screenSnapshotMessage.cursorColumn = screen.cursorColumn();
+    std::vector<std::string_view> lines;
+    lines.reserve(screen.rows());
+    for (size_t row = 0; row < screen.rows(); ++row) {
+        lines.push_back(encodedRow(screen, row));
     }
-    
-    // Scan backwards from end to find incomplete UTF-8 sequence
-    // Max UTF-8 sequence is 4 bytes, so check up to last 4 bytes
-    size_t pos = data.size();
-    
-    while (pos > 0 && pos > data.size() - 4) {
-        --pos;
-        unsigned char byte = static_cast<unsigned char>(data[pos]);
-        
-        // ASCII byte - we're at a complete character boundary
-        if (byte < 0x80) {
-            return data.size();
-        }
-        
-        // Continuation byte (10xxxxxx) - keep scanning backwards
-        if ((byte & 0xC0) == 0x80) {
-            continue;
-        }
-        
-        // Found a start byte - check if sequence is complete
-        int expectedLength = 0;
-        if ((byte & 0xE0) == 0xC0) expectedLength = 2;      // 110xxxxx
-        else if ((byte & 0xF0) == 0xE0) expectedLength = 3; // 1110xxxx
-        else if ((byte & 0xF8) == 0xF0) expectedLength = 4; // 11110xxx
-        else {
-            // Invalid start byte - treat as complete to avoid infinite buffering
-            return data.size();
-        }
-        
-        size_t availableLength = data.size() - pos;
-        if (availableLength < static_cast<size_t>(expectedLength)) {
-            // Incomplete sequence - truncate here
-            return pos;
+    return serialize(screenSnapshotMessage, lines);
+}
+
+/**
+ * Build update for a dirty row: only the damaged columns when they lie inside the row,
+ * the whole (trimmed) row when the damage touches either edge or the row held wide
+ * characters or clusters since it was last sent whole (clients splice partial updates
+ * one codepoint per cell, so their copy must have no such cells either)
+ */
+EncodedRowUpdate makeDirtyRowUpdate(termihui::VirtualScreen& screen, size_t row) {
+    auto columns = screen.dirtyColumns(row);
+    if (columns.begin > 0 && columns.end < screen.columns() && !screen.heldWideCells(row)) {
+        return EncodedRowUpdate{row, encodeSegments(screen.getRowSegments(row, columns.begin, columns.end)), columns.begin};
+    }
+    screen.markRowSentWhole(row);
+    return EncodedRowUpdate{row, encodedRow(screen, row)};
+}
+
+/**
+ * Build updates for all dirty rows of screen
+ */
+std::vector<EncodedRowUpdate> makeDirtyRowUpdates(termihui::VirtualScreen& screen) {
+    std::vector<EncodedRowUpdate> updates;
+    updates.reserve(screen.dirtyRowCount());
+    screen.forEachDirtyRow([&screen, &updates](size_t row) {
+        updates.push_back(makeDirtyRowUpdate(screen, row));
+    });
+    return updates;
+}
+
+/**
+ * Extract path from window title in "user@host:path" format
+ * @return path, empty if title has no such form
+ */
+std::string extractPathFromTitle(const std::string& title) {
+    size_t colonPos = title.rfind(':');
+    if (colonPos != std::string::npos && colonPos < title.length() - 1) {
+        size_t atPos = title.find('@');
+        if (atPos != std::string::npos && atPos < colonPos) {
+            return title.substr(colonPos + 1);
         }
-        
-        // Complete sequence
-        return data.size();
     }
-    
-    return data.size();
+    return "";
 }
 
 } // anonymous namespace
@@ -67,12 +84,28 @@ std::atomic<bool> TermihuiServerController::shouldExit{false};
 
 TermihuiServerController::TermihuiServerController(std::unique_ptr<WebSocketServer> webSocketServer,
                                                    std::unique_ptr<AIAgentController> aiAgentController,
-                                                   std::unique_ptr<ServerStorage> serverStorage)
+                                                   std::unique_ptr<ServerStorage> serverStorage,
+                                                   size_t sessionWorkerCount)
     : serverStorage(std::move(serverStorage))
     , webSocketServer(std::move(webSocketServer))
     , aiAgentController(std::move(aiAgentController))
+    , shellPool(this->eventLoop)
     , lastStatsTime(std::chrono::steady_clock::now())
 {
+    auto outputHandler = [this](TerminalSessionController& session) {
+        this->handleSessionOutput(session);
+    };
+    auto flushHandler = [this](TerminalSessionController& session) {
+        this->flushScreenChanges(session);
+    };
+    if (sessionWorkerCount == 0) {
+        // Sessions live on the thread calling update() and share its event loop
+        this->sessionWorkers.push_back(std::make_unique<SessionWorker>(this->eventLoop, outputHandler, flushHandler));
+    } else {
+        for (size_t i = 0; i < sessionWorkerCount; ++i) {
+            this->sessionWorkers.push_back(std::make_unique<SessionWorker>(outputHandler, flushHandler));
+        }
+    }
 }
 
 TermihuiServerController::~TermihuiServerController() {
@@ -108,8 +141,20 @@ bool TermihuiServerController::start() {
     fmt::print("🚀 Server run ID: {}\n", this->currentRunId);
     
     // AI agent will be configured per-request based on selected provider
+    this->aiAgentController->attachEventLoop(this->eventLoop);
     fmt::print("🤖 AI Agent ready (provider configured per-request)\n");
     
+    // Wake up main loop when WebSocket thread queues events or we queue outgoing messages
+    this->webSocketServer->setWakeupHandler([this]() {
+        this->eventLoop.wakeup();
+    });
+    
+    // Start session workers
+    for (auto& sessionWorker : this->sessionWorkers) {
+        sessionWorker->start();
+    }
+    fmt::print("Session workers: {}\n", this->sessionWorkers.size());
+    
     // Start WebSocket server
     if (!this->webSocketServer->start()) {
         fmt::print(stderr, "Failed to start WebSocket server on {}:{}\n", 
@@ -124,10 +169,11 @@ bool TermihuiServerController::start() {
 
 void TermihuiServerController::stop() {
     // Terminate all sessions
-    for (auto& [sessionId, controller] : this->sessions) {
-        controller->terminate();
+    for (auto& sessionWorker : this->sessionWorkers) {
+        sessionWorker->stop();
     }
-    this->sessions.clear();
+    this->sessionIds.clear();
+    this->shellPool.setSize(0);
     
     this->webSocketServer->stop();
     
@@ -139,10 +185,46 @@ void TermihuiServerController::stop() {
     fmt::print("Server stopped\n");
 }
 
-void TermihuiServerController::update() {
+void TermihuiServerController::update(int timeoutMs) {
+    // AI transfers may need a call before anything becomes ready (curl timeouts)
+    int aiTimeoutMs = this->aiAgentController->nextTimeoutMs();
+    if (aiTimeoutMs >= 0 && (timeoutMs < 0 || aiTimeoutMs < timeoutMs)) {
+        timeoutMs = aiTimeoutMs;
+    }
+    
+    int shellPoolTimeoutMs = this->shellPool.nextTimeoutMs();
+    if (shellPoolTimeoutMs >= 0 && (timeoutMs < 0 || shellPoolTimeoutMs < timeoutMs)) {
+        timeoutMs = shellPoolTimeoutMs;
+    }
+    
+    // Inline worker shares our loop, so its deferred frames and shell terminations bound the wait too
+    for (auto& sessionWorker : this->sessionWorkers) {
+        if (!sessionWorker->isInline()) {
+            continue;
+        }
+        int workerTimeoutMs = sessionWorker->nextTimeoutMs();
+        if (workerTimeoutMs >= 0 && (timeoutMs < 0 || workerTimeoutMs < timeoutMs)) {
+            timeoutMs = workerTimeoutMs;
+        }
+    }
+    
+    // Wait for readiness: PTY output is processed from session callbacks,
+    // AI sockets are driven from curl callbacks, WebSocket wakeups just return
+    this->eventLoop.wait(timeoutMs);
+    
+    for (auto& sessionWorker : this->sessionWorkers) {
+        if (sessionWorker->isInline()) {
+            sessionWorker->processTimers();
+        }
+    }
+    
     // Get events from WebSocket server
     auto updateResult = this->webSocketServer->update();
     
+    // Refill shell pool after queued replies went out, so a claimed shell's
+    // replacement doesn't delay the session_created it made possible
+    this->shellPool.processTimers();
+    
     // Handle connection/disconnection events
     for (const auto& connectionEvent : updateResult.connectionEvents) {
         if (connectionEvent.connected) {
@@ -157,16 +239,15 @@ void TermihuiServerController::update() {
         this->handleMessage(incomingMessage);
     }
     
-    // Process terminal output for all sessions
-    for (auto& [sessionId, controller] : this->sessions) {
-        this->processTerminalOutput(*controller);
-    
-    // Check session status and send completion notification
-        if (controller->didJustFinishRunning()) {
-            fmt::print("Session {} command completed\n", sessionId);
-            StatusMessage statusMessage{sessionId, false};
-            this->webSocketServer->broadcastMessage(serialize(statusMessage));
+    // Resend screens to clients that dropped updates and have caught up
+    for (const auto& resyncRequest : updateResult.resyncRequests) {
+        if (!this->sessionIds.contains(resyncRequest.sessionId)) {
+            continue;
         }
+        int clientId = resyncRequest.clientId;
+        this->workerFor(resyncRequest.sessionId).post(resyncRequest.sessionId, [this, clientId](TerminalSessionController& session) {
+            this->sendScreenResync(clientId, session);
+        });
     }
     
     // Process AI agent events
@@ -174,32 +255,44 @@ void TermihuiServerController::update() {
     for (auto& event : aiEvents) {
         switch (event.type) {
             case AIEvent::Type::Chunk:
-                this->webSocketServer->broadcastMessage(serialize(AIChunkMessage{event.sessionId, std::move(event.content)}));
+                this->broadcastToSubscribers(event.sessionId, serialize(AIChunkMessage{event.sessionId, std::move(event.content)}));
                 break;
             case AIEvent::Type::Done:
                 // Save assistant message to DB (content contains full response)
                 if (!event.content.empty()) {
                     this->serverStorage->saveChatMessage(event.sessionId, "assistant", event.content);
                 }
-                this->webSocketServer->broadcastMessage(serialize(AIDoneMessage{event.sessionId}));
+                this->broadcastToSubscribers(event.sessionId, serialize(AIDoneMessage{event.sessionId}));
                 break;
             case AIEvent::Type::Error:
                 // Save error message to DB so history is consistent after restart
                 this->serverStorage->saveChatMessage(event.sessionId, "error", event.content);
-                this->webSocketServer->broadcastMessage(serialize(AIErrorMessage{event.sessionId, std::move(event.content)}));
+                this->broadcastToSubscribers(event.sessionId, serialize(AIErrorMessage{event.sessionId, std::move(event.content)}));
                 break;
         }
     }
     
     // Print statistics every 30 seconds
     this->printStats();
+}
+
+void TermihuiServerController::broadcastToSubscribers(uint64_t sessionId, std::string message) {
+    this->webSocketServer->broadcastSessionMessage(sessionId, WebSocketServer::MessageClass::Control, std::move(message));
+}
+
+void TermihuiServerController::handleSessionOutput(TerminalSessionController& session) {
+    this->processTerminalOutput(session);
     
-    // Small pause to avoid CPU overload
-    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    // Check session status and send completion notification
+    if (session.didJustFinishRunning()) {
+        LOG_INFO(LogCategory::Session, "Session {} command completed", session.getSessionId());
+        StatusMessage statusMessage{session.getSessionId(), false};
+        this->broadcastToSubscribers(session.getSessionId(), serialize(statusMessage));
+    }
 }
 
 void TermihuiServerController::handleNewConnection(int clientId) {
-    fmt::print("Client connected: {}\n", clientId);
+    LOG_INFO(LogCategory::Ws, "Client connected: {}", clientId);
     
     ConnectedMessage connectedMessage;
     connectedMessage.serverVersion = "1.0.0";
@@ -213,11 +306,11 @@ void TermihuiServerController::handleNewConnection(int clientId) {
 }
 
 void TermihuiServerController::handleDisconnection(int clientId) {
-    fmt::print("Client disconnected: {}\n", clientId);
+    LOG_INFO(LogCategory::Ws, "Client disconnected: {}", clientId);
 }
 
 void TermihuiServerController::handleMessage(const WebSocketServer::IncomingMessage& incomingMessage) {
-    fmt::print("Processing message from {}: {}\n", incomingMessage.clientId, incomingMessage.text);
+    LOG_TRACE(LogCategory::Ws, "Processing message from {}: {}", incomingMessage.clientId, incomingMessage.text);
     
     try {
         ClientMessage clientMessage = parseClientMessage(incomingMessage.text);
@@ -227,101 +320,115 @@ void TermihuiServerController::handleMessage(const WebSocketServer::IncomingMess
         }, clientMessage);
         
     } catch (const std::exception& e) {
-        fmt::print(stderr, "Message parsing error: {}\n", e.what());
+        LOG_WARN(LogCategory::Ws, "Message parsing error: {}", e.what());
         ErrorMessage errorMessage{std::string("Invalid message: ") + e.what(), "PARSE_ERROR"};
         this->webSocketServer->sendMessage(incomingMessage.clientId, serialize(errorMessage));
     }
 }
 
-TerminalSessionController* TermihuiServerController::findSession(uint64_t sessionId) {
-    auto it = this->sessions.find(sessionId);
-    if (it != this->sessions.end()) {
-        return it->second.get();
-    }
-    
-    // Lazy initialization: check if session exists in DB
-    if (!this->serverStorage->isActiveTerminalSession(sessionId)) {
-        return nullptr;
-    }
-    
-    // Create controller on-demand
-    auto sessionDbPath = this->fileSystemManager.getWritablePath() / fmt::format("session_{}.sqlite", sessionId);
-    auto controller = std::make_unique<TerminalSessionController>(
-        sessionDbPath, sessionId, this->currentRunId);
-    
-    if (!controller->createSession()) {
-        fmt::print(stderr, "Failed to lazily create session {}\n", sessionId);
-        return nullptr;
+SessionWorker& TermihuiServerController::workerFor(uint64_t sessionId) {
+    return *this->sessionWorkers[sessionId % this->sessionWorkers.size()];
+}
+
+bool TermihuiServerController::withSession(uint64_t sessionId, SessionWorker::SessionTask task) {
+    if (this->sessionIds.count(sessionId) == 0) {
+        // Lazy initialization: check if session exists in DB
+        if (!this->serverStorage->isActiveTerminalSession(sessionId)) {
+            return false;
+        }
+        
+        // Create controller on-demand, then hand it over to its worker
+        auto openStart = std::chrono::steady_clock::now();
+        auto sessionDbPath = this->fileSystemManager.getWritablePath() / fmt::format("session_{}.sqlite", sessionId);
+        auto controller = std::make_unique<TerminalSessionController>(
+            sessionDbPath, sessionId, this->currentRunId);
+        controller->getScrollback().setLimits(this->scrollbackLimits);
+        
+        if (!controller->createSession(&this->shellPool)) {
+            LOG_ERROR(LogCategory::Session, "Failed to lazily create session {}", sessionId);
+            return false;
+        }
+        
+        this->startSessionRecording(*controller);
+        this->recordSessionOpenLatency(openStart);
+        LOG_INFO(LogCategory::Session, "Lazily created session controller for session {}", sessionId);
+        this->workerFor(sessionId).addSession(std::move(controller));
+        this->sessionIds.insert(sessionId);
     }
     
-    fmt::print("Lazily created session controller for session {}\n", sessionId);
-    auto* ptr = controller.get();
-    this->sessions[sessionId] = std::move(controller);
-    return ptr;
+    this->workerFor(sessionId).post(sessionId, std::move(task));
+    return true;
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const ExecuteMessage& message) {
-    auto* terminalSessionController = this->findSession(message.sessionId);
-    if (!terminalSessionController) {
+    bool found = this->withSession(message.sessionId, [this, clientId, message](TerminalSessionController& terminalSessionController) {
+        terminalSessionController.setPendingCommand(message.command);
+        terminalSessionController.getFramePacer().requestImmediateFrame();
+        
+        using ExecuteCommandResult = TerminalSessionController::ExecuteCommandResult;
+        const ExecuteCommandResult executeCommandResult = terminalSessionController.executeCommand(message.command);
+        
+        if (executeCommandResult.isOk()) {
+            LOG_DEBUG(LogCategory::Pty, "Session {}: Executed command: {}", message.sessionId, message.command);
+        } else {
+            ErrorMessage errorMessage{fmt::format("Failed to execute command *{}*: {}", message.command, executeCommandResult.errorText()), "COMMAND_FAILED"};
+            this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
+        }
+    });
+    if (!found) {
         ErrorMessage errorMessage{fmt::format("Session {} not found", message.sessionId), "SESSION_NOT_FOUND"};
         this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
-        return;
-    }
-    
-    terminalSessionController->setPendingCommand(message.command);
-    
-    using ExecuteCommandResult = TerminalSessionController::ExecuteCommandResult;
-    const ExecuteCommandResult executeCommandResult = terminalSessionController->executeCommand(message.command);
-    
-    if (executeCommandResult.isOk()) {
-        fmt::print("Session {}: Executed command: {}\n", message.sessionId, message.command);
-    } else {
-        ErrorMessage errorMessage{fmt::format("Failed to execute command *{}*: {}", message.command, executeCommandResult.errorText()), "COMMAND_FAILED"};
-        this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
     }
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const InputMessage& message) {
-    auto* terminalSessionController = this->findSession(message.sessionId);
-    if (!terminalSessionController) {
+    bool found = this->withSession(message.sessionId, [this, clientId, message](TerminalSessionController& terminalSessionController) {
+        // Echo of a keystroke must not wait for the frame interval
+        terminalSessionController.getFramePacer().requestImmediateFrame();
+        ssize_t bytes = message.paste ? terminalSessionController.sendPaste(message.text)
+                                      : terminalSessionController.sendInput(message.text);
+        if (bytes >= 0) {
+            InputSentMessage inputSentMessage{static_cast<int>(bytes)};
+            this->webSocketServer->sendMessage(clientId, serialize(inputSentMessage));
+        } else {
+            ErrorMessage errorMessage{"Failed to send input", "INPUT_FAILED"};
+            this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
+        }
+    });
+    if (!found) {
         ErrorMessage errorMessage{fmt::format("Session {} not found", message.sessionId), "SESSION_NOT_FOUND"};
         this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
-        return;
-    }
-    
-    ssize_t bytes = terminalSessionController->sendInput(message.text);
-    if (bytes >= 0) {
-        InputSentMessage inputSentMessage{static_cast<int>(bytes)};
-        this->webSocketServer->sendMessage(clientId, serialize(inputSentMessage));
-    } else {
-        ErrorMessage errorMessage{"Failed to send input", "INPUT_FAILED"};
-        this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
     }
 }
             
 void TermihuiServerController::handleMessageFromClient(int clientId, const CompletionMessage& message) {
-    fmt::print("Completion request for session {}: '{}' (position: {})\n", message.sessionId, message.text, message.cursorPosition);
+    LOG_DEBUG(LogCategory::Session, "Completion request for session {}: '{}' (position: {})", message.sessionId, message.text, message.cursorPosition);
     
-    auto* terminalSessionController = this->findSession(message.sessionId);
-    std::string currentDir = ".";
-    if (terminalSessionController) {
-        currentDir = terminalSessionController->getLastKnownCwd();
+    auto sendCompletions = [this, clientId, message](std::string currentDir) {
         if (currentDir.empty()) {
-            currentDir = terminalSessionController->getCurrentWorkingDirectory();
+            currentDir = ".";
         }
-    }
-    if (currentDir.empty()) {
-        currentDir = ".";
-    }
-    
-    auto completions = this->completionManager.getCompletions(message.text, message.cursorPosition, currentDir);
-    
-    CompletionResultMessage completionResultMessage{
-        std::move(completions),
-        message.text,
-        message.cursorPosition
+        
+        auto completions = this->completionManager.getCompletions(message.text, message.cursorPosition, currentDir);
+        
+        CompletionResultMessage completionResultMessage{
+            std::move(completions),
+            message.text,
+            message.cursorPosition
+        };
+        this->webSocketServer->sendMessage(clientId, serialize(completionResultMessage));
     };
-    this->webSocketServer->sendMessage(clientId, serialize(completionResultMessage));
+    
+    bool found = this->withSession(message.sessionId, [sendCompletions](TerminalSessionController& terminalSessionController) {
+        std::string currentDir = terminalSessionController.getLastKnownCwd();
+        if (currentDir.empty()) {
+            currentDir = terminalSessionController.getCurrentWorkingDirectory();
+        }
+        sendCompletions(std::move(currentDir));
+    });
+    if (!found) {
+        sendCompletions(".");
+    }
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const ResizeMessage& message) {
@@ -331,19 +438,18 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const Resiz
         return;
     }
     
-    auto* terminalSessionController = this->findSession(message.sessionId);
-    if (!terminalSessionController) {
+    bool found = this->withSession(message.sessionId, [this, clientId, message](TerminalSessionController& terminalSessionController) {
+        if (terminalSessionController.setWindowSize(static_cast<unsigned short>(message.cols), static_cast<unsigned short>(message.rows))) {
+            ResizeAckMessage resizeAckMessage{message.cols, message.rows};
+            this->webSocketServer->sendMessage(clientId, serialize(resizeAckMessage));
+        } else {
+            ErrorMessage errorMessage{"Failed to set terminal size", "RESIZE_FAILED"};
+            this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
+        }
+    });
+    if (!found) {
         ErrorMessage errorMessage{fmt::format("Session {} not found", message.sessionId), "SESSION_NOT_FOUND"};
         this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
-        return;
-    }
-    
-    if (terminalSessionController->setWindowSize(static_cast<unsigned short>(message.cols), static_cast<unsigned short>(message.rows))) {
-        ResizeAckMessage resizeAckMessage{message.cols, message.rows};
-        this->webSocketServer->sendMessage(clientId, serialize(resizeAckMessage));
-    } else {
-        ErrorMessage errorMessage{"Failed to set terminal size", "RESIZE_FAILED"};
-        this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
     }
 }
 
@@ -357,10 +463,12 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const ListS
     }
     
     this->webSocketServer->sendMessage(clientId, serialize(sessionsListMessage));
-    fmt::print("Sent sessions list ({} sessions) to client {}\n", storageSessions.size(), clientId);
+    LOG_INFO(LogCategory::Session, "Sent sessions list ({} sessions) to client {}", storageSessions.size(), clientId);
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const CreateSessionMessage&) {
+    auto openStart = std::chrono::steady_clock::now();
+    
     // Create session record in DB
     uint64_t sessionId = this->serverStorage->createTerminalSession(this->currentRunId);
     
@@ -368,73 +476,79 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const Creat
     auto sessionDbPath = this->fileSystemManager.getWritablePath() / fmt::format("session_{}.sqlite", sessionId);
     auto controller = std::make_unique<TerminalSessionController>(
         sessionDbPath, sessionId, this->currentRunId);
+    controller->getScrollback().setLimits(this->scrollbackLimits);
     
-    if (!controller->createSession()) {
+    if (!controller->createSession(&this->shellPool)) {
         ErrorMessage errorMessage{"Failed to create terminal session", "SESSION_CREATE_FAILED"};
         this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
         // TODO: cleanup DB record
         return;
     }
+    this->startSessionRecording(*controller);
     
-    this->sessions[sessionId] = std::move(controller);
+    // From here on the session is owned (and only touched) by its worker
+    this->workerFor(sessionId).addSession(std::move(controller));
+    this->sessionIds.insert(sessionId);
     
     SessionCreatedMessage sessionCreatedMessage{sessionId};
     this->webSocketServer->sendMessage(clientId, serialize(sessionCreatedMessage));
-    fmt::print("Created session {} for client {}\n", sessionId, clientId);
+    this->recordSessionOpenLatency(openStart);
+    LOG_INFO(LogCategory::Session, "Created session {} for client {}", sessionId, clientId);
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const CloseSessionMessage& message) {
-    auto it = this->sessions.find(message.sessionId);
-    if (it == this->sessions.end()) {
+    if (this->sessionIds.erase(message.sessionId) == 0) {
         ErrorMessage errorMessage{fmt::format("Session {} not found", message.sessionId), "SESSION_NOT_FOUND"};
         this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
         return;
     }
     
     // Terminate and remove session
-    it->second->terminate();
-    this->sessions.erase(it);
+    this->workerFor(message.sessionId).removeSession(message.sessionId);
     
     // Mark as deleted in DB
     this->serverStorage->markTerminalSessionAsDeleted(message.sessionId);
     
     SessionClosedMessage sessionClosedMessage{message.sessionId};
     this->webSocketServer->sendMessage(clientId, serialize(sessionClosedMessage));
-    fmt::print("Closed session {} for client {}\n", message.sessionId, clientId);
+    LOG_INFO(LogCategory::Session, "Closed session {} for client {}", message.sessionId, clientId);
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const GetHistoryMessage& message) {
-    auto* terminalSessionController = this->findSession(message.sessionId);
-    if (!terminalSessionController) {
+    bool found = this->withSession(message.sessionId, [this, clientId, message](TerminalSessionController& terminalSessionController) {
+        this->sendSessionHistory(clientId, message.sessionId, terminalSessionController);
+    });
+    if (!found) {
         ErrorMessage errorMessage{fmt::format("Session {} not found", message.sessionId), "SESSION_NOT_FOUND"};
         this->webSocketServer->sendMessage(clientId, serialize(errorMessage));
-        return;
     }
-    
-    auto commandHistory = terminalSessionController->getCommandHistory();
-    auto& sessionStorage = terminalSessionController->getSessionStorage();
+}
+
+void TermihuiServerController::sendSessionHistory(int clientId, uint64_t sessionId, TerminalSessionController& terminalSessionController) {
+    auto commandHistory = terminalSessionController.getCommandHistory();
+    auto& sessionStorage = terminalSessionController.getSessionStorage();
+    const auto& scrollback = terminalSessionController.getScrollback();
     
     HistoryMessage historyMessage;
-    historyMessage.sessionId = message.sessionId;
+    historyMessage.sessionId = sessionId;
     historyMessage.commands.reserve(commandHistory.size());
     for (const auto& record : commandHistory) {
         std::vector<StyledSegment> segments;
         
-        if (!record.isFinished && record.id == terminalSessionController->getCurrentCommandId()) {
-            // Running command: only include committed (scrolled-off) lines from SQLite.
-            // Active screen rows will arrive via block_screen_update messages.
-            auto outputLineJsons = sessionStorage.getOutputLines(record.id);
-            for (size_t i = 0; i < outputLineJsons.size(); ++i) {
+        // Committed (scrolled-off) lines: from memory while the scrollback still holds all of them,
+        // otherwise the rendered output stored in SQLite.
+        // For a running command active screen rows will arrive via block_screen_update messages.
+        if (auto lines = scrollback.commandLines(record.id)) {
+            for (size_t i = 0; i < lines->size(); ++i) {
                 if (i > 0) {
                     segments.push_back(StyledSegment{"\n", {}});
                 }
-                auto lineSegments = json::parse(outputLineJsons[i]).get<std::vector<StyledSegment>>();
+                auto& lineSegments = (*lines)[i];
                 segments.insert(segments.end(),
                     std::make_move_iterator(lineSegments.begin()),
                     std::make_move_iterator(lineSegments.end()));
             }
         } else {
-            // Finished command: load rendered output from SQLite
             auto outputLineJsons = sessionStorage.getOutputLines(record.id);
             for (size_t i = 0; i < outputLineJsons.size(); ++i) {
                 if (i > 0) {
@@ -445,10 +559,14 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const GetHi
                     std::make_move_iterator(lineSegments.begin()),
                     std::make_move_iterator(lineSegments.end()));
             }
+        }
+        
+        bool isRunning = !record.isFinished && record.id == terminalSessionController.getCurrentCommandId();
+        if (!isRunning && segments.empty() && !record.output.empty()) {
             // Fallback to OutputParser for pre-migration data
-            if (segments.empty() && !record.output.empty()) {
-                segments = this->outputParser.parse(record.output);
-            }
+            // (parser is stateful, so use a local one - this may run on any session worker)
+            termihui::OutputParser outputParser;
+            segments = outputParser.parse(record.output);
         }
         
         historyMessage.commands.push_back(CommandRecord{
@@ -463,49 +581,55 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const GetHi
     }
     
     this->webSocketServer->sendMessage(clientId, serialize(historyMessage));
-    fmt::print("Sent history for session {} ({} commands) to client {}\n", message.sessionId, commandHistory.size(), clientId);
+    LOG_INFO(LogCategory::Session, "Sent history for session {} ({} commands) to client {}", sessionId, commandHistory.size(), clientId);
     
     // If session has a running command, send current VirtualScreen as block_screen_update
-    if (terminalSessionController->hasActiveCommand() && !terminalSessionController->isInInteractiveMode()) {
-        auto& screen = terminalSessionController->getVirtualScreen();
+    if (terminalSessionController.hasActiveCommand() && !terminalSessionController.isInInteractiveMode()) {
+        auto& screen = terminalSessionController.getVirtualScreen();
         BlockScreenUpdateMessage blockScreenUpdateMessage;
-        blockScreenUpdateMessage.sessionId = message.sessionId;
+        blockScreenUpdateMessage.sessionId = sessionId;
         blockScreenUpdateMessage.cursorRow = screen.cursorRow();
         blockScreenUpdateMessage.cursorColumn = screen.cursorColumn();
+        std::vector<EncodedRowUpdate> updates;
         for (size_t row = 0; row < screen.rows(); ++row) {
-            auto rowSegments = screen.getRowSegments(row);
-            if (!rowSegments.empty()) {
-                blockScreenUpdateMessage.updates.push_back(
-                    ScreenRowUpdate{row, std::move(rowSegments)});
+            if (!screen.rowSegments(row).empty()) {
+                updates.push_back(EncodedRowUpdate{row, encodedRow(screen, row)});
             }
         }
-        if (!blockScreenUpdateMessage.updates.empty()) {
-            this->webSocketServer->sendMessage(clientId, serialize(blockScreenUpdateMessage));
+        if (!updates.empty()) {
+            this->webSocketServer->sendSessionMessage(clientId, sessionId, WebSocketServer::MessageClass::ScreenSnapshot,
+                                                      serialize(blockScreenUpdateMessage, updates));
         }
     }
     
     // If session is in interactive mode, send interactive mode start and screen snapshot
-    if (terminalSessionController->isInInteractiveMode()) {
-        auto& screen = terminalSessionController->getVirtualScreen();
+    if (terminalSessionController.isInInteractiveMode()) {
+        auto& screen = terminalSessionController.getVirtualScreen();
         this->webSocketServer->sendMessage(clientId, serialize(InteractiveModeStartMessage{
+            sessionId,
             screen.rows(),
             screen.columns()
         }));
         
-        ScreenSnapshotMessage screenSnapshotMessage;
-        screenSnapshotMessage.cursorRow = screen.cursorRow();
-        screenSnapshotMessage.cursorColumn = screen.cursorColumn();
-        screenSnapshotMessage.lines.reserve(screen.rows());
-        for (size_t row = 0; row < screen.rows(); ++row) {
-            screenSnapshotMessage.lines.push_back(screen.getRowSegments(row));
-        }
-        this->webSocketServer->sendMessage(clientId, serialize(screenSnapshotMessage));
-        fmt::print("Sent interactive mode state to client {} (session {})\n", clientId, message.sessionId);
+        this->webSocketServer->sendSessionMessage(clientId, sessionId, WebSocketServer::MessageClass::ScreenSnapshot,
+                                                  serializeScreenSnapshot(sessionId, screen));
+        LOG_INFO(LogCategory::Session, "Sent interactive mode state to client {} (session {})", clientId, sessionId);
     }
 }
 
+void TermihuiServerController::handleMessageFromClient(int clientId, const SubscribeMessage& message) {
+    // Current state of the session is fetched separately with get_history
+    this->webSocketServer->subscribe(clientId, message.sessionId);
+    LOG_INFO(LogCategory::Ws, "Client {} subscribed to session {}", clientId, message.sessionId);
+}
+
+void TermihuiServerController::handleMessageFromClient(int clientId, const UnsubscribeMessage& message) {
+    this->webSocketServer->unsubscribe(clientId, message.sessionId);
+    LOG_INFO(LogCategory::Ws, "Client {} unsubscribed from session {}", clientId, message.sessionId);
+}
+
 void TermihuiServerController::handleMessageFromClient(int clientId, const AIChatMessage& message) {
-    fmt::print("AI chat message for session {}, provider {}: {}\n", message.sessionId, message.providerId, message.message);
+    LOG_DEBUG(LogCategory::Ai, "Chat message for session {}, provider {}: {}", message.sessionId, message.providerId, message.message);
 
     // Get provider from storage
     auto provider = this->serverStorage->getLLMProvider(message.providerId);
@@ -528,7 +652,7 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const AICha
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const GetChatHistoryMessage& message) {
-    fmt::print("Get chat history for session {}\n", message.sessionId);
+    LOG_DEBUG(LogCategory::Ai, "Get chat history for session {}", message.sessionId);
 
     auto messages = this->serverStorage->getChatHistory(message.sessionId);
 
@@ -542,7 +666,7 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const GetCh
     }
 
     this->webSocketServer->sendMessage(clientId, serialize(response));
-    fmt::print("Sent chat history ({} messages) for session {} to client {}\n", messages.size(), message.sessionId, clientId);
+    LOG_INFO(LogCategory::Ai, "Sent chat history ({} messages) for session {} to client {}", messages.size(), message.sessionId, clientId);
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const ListLLMProvidersMessage&) {
@@ -557,7 +681,7 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const ListL
     }
     
     this->webSocketServer->sendMessage(clientId, serialize(response));
-    fmt::print("Sent LLM providers list ({} providers) to client {}\n", providers.size(), clientId);
+    LOG_INFO(LogCategory::Ai, "Sent LLM providers list ({} providers) to client {}", providers.size(), clientId);
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const AddLLMProviderMessage& message) {
@@ -566,7 +690,7 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const AddLL
     
     LLMProviderAddedMessage response{id};
     this->webSocketServer->sendMessage(clientId, serialize(response));
-    fmt::print("Added LLM provider {} (id={}) for client {}\n", message.name, id, clientId);
+    LOG_INFO(LogCategory::Ai, "Added LLM provider {} (id={}) for client {}", message.name, id, clientId);
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const UpdateLLMProviderMessage& message) {
@@ -574,7 +698,7 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const Updat
     
     LLMProviderUpdatedMessage response{message.id};
     this->webSocketServer->sendMessage(clientId, serialize(response));
-    fmt::print("Updated LLM provider {} for client {}\n", message.id, clientId);
+    LOG_INFO(LogCategory::Ai, "Updated LLM provider {} for client {}", message.id, clientId);
 }
 
 void TermihuiServerController::handleMessageFromClient(int clientId, const DeleteLLMProviderMessage& message) {
@@ -582,62 +706,30 @@ void TermihuiServerController::handleMessageFromClient(int clientId, const Delet
     
     LLMProviderDeletedMessage response{message.id};
     this->webSocketServer->sendMessage(clientId, serialize(response));
-    fmt::print("Deleted LLM provider {} for client {}\n", message.id, clientId);
-}
-
-
-// Helper: escape string for logging (show control chars)
-static std::string escapeForLog(const std::string& s) {
-    std::string result;
-    for (char c : s) {
-        if (c == '\x1b') {
-            result += "\\e";
-        } else if (c == '\x07') {
-            result += "\\a";
-        } else if (c == '\n') {
-            result += "\\n";
-        } else if (c == '\r') {
-            result += "\\r";
-        } else if (c < 32) {
-            result += fmt::format("\\x{:02x}", static_cast<unsigned char>(c));
-        } else {
-            result += c;
-        }
-    }
-    return result;
+    LOG_INFO(LogCategory::Ai, "Deleted LLM provider {} for client {}", message.id, clientId);
 }
 
+
 void TermihuiServerController::processTerminalOutput(TerminalSessionController& session) {
-    if (!session.hasData()) {
-        return;
-    }
-    
-    std::string output = session.readOutput();
+    // View into the session read buffer (already prefixed with any retained UTF-8 tail)
+    std::string_view output = session.drainOutput();
     if (output.empty()) {
         return;
     }
     
-    // Prepend any pending incomplete UTF-8 from previous read
-    uint64_t sessionId = session.getSessionId();
-    auto& pendingBuffer = this->utf8PendingBuffers[sessionId];
-    if (!pendingBuffer.empty()) {
-        output = pendingBuffer + output;
-        pendingBuffer.clear();
-    }
-    
     // Handle incomplete UTF-8 at end of buffer
-    size_t completeEnd = findCompleteUtf8End(output);
+    size_t completeEnd = termihui::utf8::completeLength(output);
     if (completeEnd < output.size()) {
-        // Save incomplete UTF-8 sequence for next read
-        pendingBuffer = output.substr(completeEnd);
-        output.resize(completeEnd);
+        // Keep incomplete UTF-8 sequence in the read buffer for next read
+        session.retainOutputTail(output.size() - completeEnd);
+        output = output.substr(0, completeEnd);
     }
     
     if (output.empty()) {
         return;
     }
     
-    fmt::print("[PTY] Raw output ({} bytes): {}\n", output.size(), escapeForLog(output));
+    LOG_TRACE(LogCategory::Pty, "Raw output ({} bytes): {}", output.size(), Logger::escape(output));
     
     if (session.isInInteractiveMode()) {
         // Interactive mode: process all at once, send screen diff
@@ -648,65 +740,115 @@ void TermihuiServerController::processTerminalOutput(TerminalSessionController&
             // Switched back to block mode mid-output; remaining will be handled next call
             return;
         }
-        this->sendScreenDiff(session);
+        this->paceScreenChanges(session);
         return;
     }
     
     // Block mode: chunked processing through VirtualScreen
-    // Clear tracking state so we capture changes per-chunk
-    session.getVirtualScreen().clearDirtyRows();
-    session.getVirtualScreen().takeScrolledOffRows();
+    // Clear stale tracking state, unless it belongs to a deferred frame that is still to be sent
+    if (!session.getFramePacer().getPendingDeadline()) {
+        session.getVirtualScreen().clearDirtyRows();
+        session.getVirtualScreen().takeScrolledOffRows();
+    }
     
     bool skipOutputRecording = session.hasJustExitedInteractiveMode();
     if (skipOutputRecording) {
-        fmt::print("[INTERACTIVE] Skipping output recording (just exited interactive mode), {} bytes\n", output.size());
+        LOG_DEBUG(LogCategory::Pty, "Skipping output recording (just exited interactive mode), {} bytes", output.size());
     }
     this->processBlockModeOutput(session, output, skipOutputRecording);
 }
 
 void TermihuiServerController::sendScreenSnapshot(TerminalSessionController& session) {
     auto& screen = session.getVirtualScreen();
-    
-    ScreenSnapshotMessage screenSnapshotMessage;
-    screenSnapshotMessage.cursorRow = screen.cursorRow();
-    screenSnapshotMessage.cursorColumn = screen.cursorColumn();
-    screenSnapshotMessage.lines.reserve(screen.rows());
-    
+    std::string screenSnapshot = serializeScreenSnapshot(session.getSessionId(), screen);
     for (size_t row = 0; row < screen.rows(); ++row) {
-        screenSnapshotMessage.lines.push_back(screen.getRowSegments(row));
+        screen.markRowSentWhole(row);
     }
-    
     screen.clearDirtyRows();
-    this->webSocketServer->broadcastMessage(serialize(screenSnapshotMessage));
+    this->webSocketServer->broadcastSessionMessage(session.getSessionId(), WebSocketServer::MessageClass::ScreenSnapshot,
+                                                   std::move(screenSnapshot));
 }
 
-void TermihuiServerController::sendScreenDiff(TerminalSessionController& session) {
+void TermihuiServerController::sendScreenResync(int clientId, TerminalSessionController& session) {
+    const auto& screen = session.getVirtualScreen();
+    uint64_t sessionId = session.getSessionId();
+    
+    // Pending scrolls would be applied twice on top of the snapshot: send them out first
+    if (session.isInInteractiveMode() && screen.hasScrollOperations()) {
+        this->flushScreenChanges(session);
+    }
+    
+    // Pending dirty rows stay untouched: other clients still expect them as a diff
+    if (session.isInInteractiveMode()) {
+        this->webSocketServer->sendSessionMessage(clientId, sessionId, WebSocketServer::MessageClass::ScreenSnapshot,
+                                                  serializeScreenSnapshot(sessionId, screen));
+    } else {
+        // Every row, so rows changed by the dropped updates are overwritten too
+        BlockScreenUpdateMessage blockScreenUpdateMessage;
+        blockScreenUpdateMessage.sessionId = sessionId;
+        blockScreenUpdateMessage.cursorRow = screen.cursorRow();
+        blockScreenUpdateMessage.cursorColumn = screen.cursorColumn();
+        std::vector<EncodedRowUpdate> updates;
+        updates.reserve(screen.rows());
+        for (size_t row = 0; row < screen.rows(); ++row) {
+            updates.push_back(EncodedRowUpdate{row, encodedRow(screen, row)});
+        }
+        this->webSocketServer->sendSessionMessage(clientId, sessionId, WebSocketServer::MessageClass::ScreenSnapshot,
+                                                  serialize(blockScreenUpdateMessage, updates));
+    }
+    LOG_INFO(LogCategory::Session, "Resynced screen of session {} for client {}", sessionId, clientId);
+}
+
+bool TermihuiServerController::sendScreenDiff(TerminalSessionController& session) {
     auto& screen = session.getVirtualScreen();
-    const auto& dirtyRows = screen.dirtyRows();
     bool cursorMoved = screen.isCursorDirty();
     
     // Nothing changed - no need to send anything
-    if (dirtyRows.empty() && !cursorMoved) {
-        return;
+    if (!screen.hasDirtyRows() && !screen.hasScrollOperations() && !cursorMoved) {
+        return false;
     }
     
-    // If more than half the screen is dirty, send full snapshot instead
-    if (dirtyRows.size() > screen.rows() / 2) {
+    // If more than half the screen is dirty even after scrolls, send full snapshot instead
+    if (screen.dirtyRowCount() > screen.rows() / 2) {
         this->sendScreenSnapshot(session);
-        return;
+        return true;
+    }
+    
+    // Scrolls first: client shifts its rows, dirty rows below are relative to the shifted screen
+    for (const auto& scroll : screen.takeScrollOperations()) {
+        this->webSocketServer->broadcastSessionMessage(session.getSessionId(), WebSocketServer::MessageClass::ScreenUpdate,
+                                                       serialize(ScreenScrollMessage{session.getSessionId(), scroll.top,
+                                                                                     scroll.bottom, scroll.count}));
     }
     
     ScreenDiffMessage screenDiffMessage;
+    screenDiffMessage.sessionId = session.getSessionId();
     screenDiffMessage.cursorRow = screen.cursorRow();
     screenDiffMessage.cursorColumn = screen.cursorColumn();
-    screenDiffMessage.updates.reserve(dirtyRows.size());
-    
-    for (size_t row : dirtyRows) {
-        screenDiffMessage.updates.push_back(ScreenRowUpdate{row, screen.getRowSegments(row)});
-    }
+    std::string screenDiff = serialize(screenDiffMessage, makeDirtyRowUpdates(screen));
     
     screen.clearDirtyRows();
-    this->webSocketServer->broadcastMessage(serialize(screenDiffMessage));
+    this->webSocketServer->broadcastSessionMessage(session.getSessionId(), WebSocketServer::MessageClass::ScreenUpdate,
+                                                   std::move(screenDiff));
+    return true;
+}
+
+void TermihuiServerController::flushScreenChanges(TerminalSessionController& session) {
+    bool sent = session.isInInteractiveMode() ? this->sendScreenDiff(session)
+                                              : this->sendBlockScreenChanges(session);
+    auto& framePacer = session.getFramePacer();
+    if (sent) {
+        framePacer.frameSent(FramePacer::Clock::now());
+    } else {
+        // Nothing to send doesn't count as a frame: next change may go out right away
+        framePacer.cancelPendingFrame();
+    }
+}
+
+void TermihuiServerController::paceScreenChanges(TerminalSessionController& session) {
+    if (session.getFramePacer().shouldSendFrame(FramePacer::Clock::now(), this->frameInterval)) {
+        this->flushScreenChanges(session);
+    }
 }
 
 void TermihuiServerController::handleAnsiEvents(const std::vector<termihui::AnsiEventVariant>& events, TerminalSessionController& session) {
@@ -714,257 +856,249 @@ void TermihuiServerController::handleAnsiEvents(const std::vector<termihui::Ansi
         std::visit([this, &session](const auto& e) {
             using T = std::decay_t<decltype(e)>;
             if constexpr (std::is_same_v<T, termihui::AnsiEvent::InteractiveModeChanged>) {
+                // Deferred frame belongs to the previous mode: snapshot / mode end supersedes it
+                session.getFramePacer().cancelPendingFrame();
                 session.setInteractiveMode(e.entered);
                 if (e.entered) {
-                    fmt::print("[INTERACTIVE] Entered interactive mode\n");
+                    LOG_DEBUG(LogCategory::Pty, "Entered interactive mode");
                     auto& screen = session.getVirtualScreen();
-                    this->webSocketServer->broadcastMessage(serialize(InteractiveModeStartMessage{
+                    this->broadcastToSubscribers(session.getSessionId(), serialize(InteractiveModeStartMessage{
+                        session.getSessionId(),
                         screen.rows(),
                         screen.columns()
                     }));
                     this->sendScreenSnapshot(session);
                 } else {
-                    fmt::print("[INTERACTIVE] Exited interactive mode\n");
-                    this->webSocketServer->broadcastMessage(serialize(InteractiveModeEndMessage{}));
+                    LOG_DEBUG(LogCategory::Pty, "Exited interactive mode");
+                    this->broadcastToSubscribers(session.getSessionId(), serialize(InteractiveModeEndMessage{session.getSessionId()}));
+                    // Primary screen is back as it was left: its rows go out from their cached encodings
+                    this->sendBlockScreenChanges(session);
                 }
             } else if constexpr (std::is_same_v<T, termihui::AnsiEvent::TitleChanged>) {
-                fmt::print("[ANSI] Title changed: {}\n", e.title);
+                LOG_DEBUG(LogCategory::Pty, "Title changed: {}", e.title);
             } else if constexpr (std::is_same_v<T, termihui::AnsiEvent::Bell>) {
-                fmt::print("[ANSI] Bell\n");
+                LOG_DEBUG(LogCategory::Pty, "Bell");
             }
         }, event);
     }
 }
 
-void TermihuiServerController::sendBlockScreenChanges(TerminalSessionController& session) {
+bool TermihuiServerController::sendBlockScreenChanges(TerminalSessionController& session) {
     auto& screen = session.getVirtualScreen();
     
     // 1. Send committed (scrolled-off) lines as OutputMessage
     auto scrolledOff = screen.takeScrolledOffRows();
+    bool sent = !scrolledOff.empty();
     for (auto& lineSegments : scrolledOff) {
-        // Store rendered line in SQLite for history
+        // Store rendered line in SQLite for history, keep recent lines in memory too
         if (session.hasActiveCommand()) {
-            json segmentsJson = lineSegments;
             session.getSessionStorage().addOutputLine(
-                session.getCurrentCommandId(), segmentsJson.dump());
+                session.getCurrentCommandId(), encodeSegments(lineSegments));
+            session.getScrollback().append(session.getCurrentCommandId(), lineSegments);
         }
-        this->webSocketServer->broadcastMessage(serialize(OutputMessage{session.getSessionId(), std::move(lineSegments)}));
+        this->webSocketServer->broadcastSessionMessage(session.getSessionId(), WebSocketServer::MessageClass::OutputLine,
+                                                       serialize(OutputMessage{session.getSessionId(), std::move(lineSegments)}));
     }
     
     // 2. Send dirty rows as BlockScreenUpdate
-    const auto& dirtyRows = screen.dirtyRows();
-    if (!dirtyRows.empty() || screen.isCursorDirty()) {
+    // Block clients don't shift rows: a scroll resends every row, the lines above went out in step 1
+    if (screen.hasScrollOperations()) {
+        screen.markAllDirty();
+    }
+    if (screen.hasDirtyRows() || screen.isCursorDirty()) {
         BlockScreenUpdateMessage blockScreenUpdateMessage;
         blockScreenUpdateMessage.sessionId = session.getSessionId();
         blockScreenUpdateMessage.cursorRow = screen.cursorRow();
         blockScreenUpdateMessage.cursorColumn = screen.cursorColumn();
-        blockScreenUpdateMessage.updates.reserve(dirtyRows.size());
         
-        for (size_t row : dirtyRows) {
-            blockScreenUpdateMessage.updates.push_back(
-                ScreenRowUpdate{row, screen.getRowSegments(row)});
-        }
-        
-        this->webSocketServer->broadcastMessage(serialize(blockScreenUpdateMessage));
+        this->webSocketServer->broadcastSessionMessage(session.getSessionId(), WebSocketServer::MessageClass::ScreenUpdate,
+                                                       serialize(blockScreenUpdateMessage, makeDirtyRowUpdates(screen)));
+        sent = true;
     }
     
     screen.clearDirtyRows();
+    return sent;
 }
 
-void TermihuiServerController::processBlockModeOutput(TerminalSessionController& session, const std::string& output, bool skipOutputRecording) {
-    // Helper: find next OSC sequence (any type)
-    auto findNextOSC = [&output](size_t from) -> size_t {
-        return output.find("\x1b]", from);
-    };
-    
-    // Helper: extract path from "user@host:path" format
-    auto extractPathFromTitle = [](const std::string& title) -> std::string {
-        size_t colonPos = title.rfind(':');
-        if (colonPos != std::string::npos && colonPos < title.length() - 1) {
-            size_t atPos = title.find('@');
-            if (atPos != std::string::npos && atPos < colonPos) {
-                return title.substr(colonPos + 1);
+void TermihuiServerController::processBlockModeOutput(TerminalSessionController& session, std::string_view output, bool skipOutputRecording) {
+    // Single pass: the processor stops right after each OSC sequence, so screen changes preceding
+    // a marker are flushed before the event it triggers; otherwise they merge into one paced frame
+    auto& processor = session.getAnsiProcessor();
+    std::vector<termihui::AnsiEventVariant> events;
+    while (!output.empty()) {
+        events.clear();
+        bool escapeHeld = processor.endsWithEscape();
+        size_t consumed = processor.processUntilOsc(output, events);
+        const termihui::AnsiEvent::ByteRange* osc = events.empty() ? nullptr : termihui::oscRange(events.back());
+        
+        // Raw output is recorded without OSC sequences (an unfinished one is completed by a later read).
+        // ESC held back at the end of the previous read is text unless it started an OSC here.
+        size_t textEnd = osc ? osc->begin : processor.pendingOscStart().value_or(consumed);
+        if (textEnd > 0 && !skipOutputRecording) {
+            std::string_view text = output.substr(0, textEnd);
+            std::string heldText;
+            if (escapeHeld) {
+                heldText = "\x1b";
+                heldText += text;
+                text = heldText;
             }
+            LOG_TRACE(LogCategory::Osc, "Text chunk: {}", Logger::escape(text));
+            session.appendOutputToCurrentCommand(text);
         }
-        return "";
-    };
-    
-    // Streaming parser: preserve order "text → event → text"
-    // Text chunks are processed through AnsiProcessor → VirtualScreen, then changes are sent.
-    size_t i = 0;
-    int iteration = 0;
-    while (true) {
-        iteration++;
-        size_t oscPos = findNextOSC(i);
-        fmt::print("[OSC-PARSE] Iteration {}: i={}, oscPos={}\n", iteration, i, 
-                   oscPos == std::string::npos ? -1 : static_cast<int>(oscPos));
+        output.remove_prefix(consumed);
         
-        if (oscPos == std::string::npos) {
-            // Remainder as regular output
-            if (i < output.size() && !skipOutputRecording) {
-                std::string chunk = output.substr(i);
-                if (!chunk.empty()) {
-                    fmt::print("[OSC-PARSE] Final text chunk: {}\n", escapeForLog(chunk));
-                    session.appendOutputToCurrentCommand(chunk);
-                    auto events = session.getAnsiProcessor().process(chunk);
-                    this->handleAnsiEvents(events, session);
-                    if (session.isInInteractiveMode()) return;
-                    this->sendBlockScreenChanges(session);
-                }
-            }
-            break;
-        }
-
-        // Process text before OSC marker through VirtualScreen
-        if (oscPos > i && !skipOutputRecording) {
-            std::string chunk = output.substr(i, oscPos - i);
-            if (!chunk.empty()) {
-                fmt::print("[OSC-PARSE] Text before OSC: {}\n", escapeForLog(chunk));
-                session.appendOutputToCurrentCommand(chunk);
-                auto events = session.getAnsiProcessor().process(chunk);
-                this->handleAnsiEvents(events, session);
-                if (session.isInInteractiveMode()) return;
-                this->sendBlockScreenChanges(session);
-            }
+        std::optional<termihui::AnsiEventVariant> oscEvent;
+        if (osc) {
+            oscEvent = std::move(events.back());
+            events.pop_back();
         }
-
-        // Find OSC end (BEL or ST)
-        size_t oscEnd = output.find('\x07', oscPos);
-        size_t stPos = output.find("\x1b\\", oscPos);
-        if (stPos != std::string::npos && (oscEnd == std::string::npos || stPos < oscEnd)) {
-            oscEnd = stPos + 1;
+        this->handleAnsiEvents(events, session);
+        if (session.isInInteractiveMode()) {
+            // Full-screen application started: the rest goes the interactive way, markers included
+            if (!output.empty()) {
+                this->handleAnsiEvents(processor.process(output), session);
+                this->paceScreenChanges(session);
+            }
+            return;
         }
         
-        fmt::print("[OSC-PARSE] OSC boundaries: start={}, end={}\n", oscPos, 
-                   oscEnd == std::string::npos ? -1 : static_cast<int>(oscEnd));
-        
-        if (oscEnd == std::string::npos) {
-            if (!skipOutputRecording) {
-                std::string chunk = output.substr(oscPos);
-                if (!chunk.empty()) {
-                    fmt::print("[OSC-PARSE] Incomplete OSC, treating as text: {}\n", escapeForLog(chunk));
-                    session.appendOutputToCurrentCommand(chunk);
-                    auto events = session.getAnsiProcessor().process(chunk);
-                    this->handleAnsiEvents(events, session);
-                    if (session.isInInteractiveMode()) return;
-                    this->sendBlockScreenChanges(session);
-                }
-            }
-            break;
+        if (oscEvent) {
+            // Screen changes preceding the marker must reach clients before the event it triggers
+            this->flushScreenChanges(session);
+            this->handleOscEvent(*oscEvent, session);
         }
+    }
+    
+    this->paceScreenChanges(session);
+}
 
-        std::string osc = output.substr(oscPos, oscEnd - oscPos + 1);
-        fmt::print("[OSC-PARSE] Found OSC sequence: {}\n", escapeForLog(osc));
-        
-        // Process OSC through AnsiProcessor for state consistency (title changes etc.)
-        session.getAnsiProcessor().process(osc);
-        
-        auto extractParam = [&osc](const std::string& key) -> std::string {
-            auto pos = osc.find(key + "=");
-            if (pos == std::string::npos) return "";
-            size_t start = pos + key.length() + 1;
-            size_t end = osc.find_first_of(";\x07", start);
-            if (end == std::string::npos) end = osc.length();
-            return osc.substr(start, end - start);
-        };
-        
-        // Process OSC based on type
-        if (osc.rfind("\x1b]133;A", 0) == 0) {
-            std::string cwd = extractParam("cwd");
-            fmt::print("[OSC-PARSE] >>> OSC 133;A (command_start) cwd={}\n", cwd);
-            if (!cwd.empty()) {
-                session.setLastKnownCwd(cwd);
-            }
-            session.startCommandInHistory(cwd);
-            if (session.hasActiveCommand()) {
-                CommandStartMessage msg;
-                msg.sessionId = session.getSessionId();
-                if (!cwd.empty()) msg.cwd = this->shortenHomePath(cwd);
-                this->webSocketServer->broadcastMessage(serialize(msg));
-            }
-        } else if (osc.rfind("\x1b]133;B", 0) == 0) {
-            int exitCode = 0;
-            auto k = osc.find("exit=");
-            if (k != std::string::npos) exitCode = std::atoi(osc.c_str() + k + 5);
-            std::string cwd = extractParam("cwd");
-            fmt::print("[OSC-PARSE] >>> OSC 133;B (command_end) exit={}, cwd={}\n", exitCode, cwd);
-            if (!cwd.empty()) {
-                session.setLastKnownCwd(cwd);
-            }
-            if (session.hasActiveCommand()) {
-                // Store remaining active screen rows before finishing
-                auto& screen = session.getVirtualScreen();
-                for (size_t row = 0; row < screen.rows(); ++row) {
-                    auto segments = screen.getRowSegments(row);
-                    if (!segments.empty()) {
-                        json segmentsJson = segments;
-                        session.getSessionStorage().addOutputLine(
-                            session.getCurrentCommandId(), segmentsJson.dump());
+void TermihuiServerController::handleOscEvent(const termihui::AnsiEventVariant& event, TerminalSessionController& session) {
+    using CommandMarker = termihui::AnsiEvent::CommandMarker;
+    std::visit([this, &session](const auto& e) {
+        using T = std::decay_t<decltype(e)>;
+        if constexpr (std::is_same_v<T, CommandMarker>) {
+            switch (e.kind) {
+                case CommandMarker::Kind::CommandStart:
+                    LOG_DEBUG(LogCategory::Osc, "OSC 133;A (command_start) cwd={}", e.cwd);
+                    if (!e.cwd.empty()) {
+                        session.setLastKnownCwd(e.cwd);
                     }
-                }
-                
-                session.finishCurrentCommand(exitCode, cwd);
-                CommandEndMessage msg;
-                msg.sessionId = session.getSessionId();
-                msg.exitCode = exitCode;
-                if (!cwd.empty()) msg.cwd = this->shortenHomePath(cwd);
-                this->webSocketServer->broadcastMessage(serialize(msg));
-            }
-            // Clear the flag - we've processed command_end, output recording can resume
-            if (session.hasJustExitedInteractiveMode()) {
-                fmt::print("[INTERACTIVE] Clearing justExitedInteractiveMode flag after command_end\n");
-                session.clearJustExitedInteractiveMode();
-            }
-        } else if (osc.rfind("\x1b]133;C", 0) == 0) {
-            fmt::print("[OSC-PARSE] >>> OSC 133;C (prompt_start)\n");
-            this->webSocketServer->broadcastMessage(serialize(PromptStartMessage{session.getSessionId()}));
-        } else if (osc.rfind("\x1b]133;D", 0) == 0) {
-            fmt::print("[OSC-PARSE] >>> OSC 133;D (prompt_end)\n");
-            this->webSocketServer->broadcastMessage(serialize(PromptEndMessage{session.getSessionId()}));
-        } else if (osc.rfind("\x1b]2;", 0) == 0) {
-            size_t titleStart = 4;
-            size_t titleEnd = osc.find_first_of("\x07\x1b", titleStart);
-            if (titleEnd != std::string::npos) {
-                std::string title = osc.substr(titleStart, titleEnd - titleStart);
-                std::string path = extractPathFromTitle(title);
-                fmt::print("[OSC-PARSE] >>> OSC 2 (window_title) title={}, extracted_path={}\n", title, path);
-                if (!path.empty()) {
-                    session.setLastKnownCwd(path);
-                    this->webSocketServer->broadcastMessage(serialize(CwdUpdateMessage{this->shortenHomePath(path)}));
-                }
-            }
-        } else if (osc.rfind("\x1b]7;", 0) == 0) {
-            size_t pathStart = osc.find("file://");
-            if (pathStart != std::string::npos) {
-                pathStart += 7;
-                size_t slashPos = osc.find('/', pathStart);
-                if (slashPos != std::string::npos) {
-                    size_t pathEnd = osc.find_first_of("\x07\x1b", slashPos);
-                    if (pathEnd != std::string::npos) {
-                        std::string path = osc.substr(slashPos, pathEnd - slashPos);
-                        fmt::print("[OSC-PARSE] >>> OSC 7 (cwd) path={}\n", path);
-                        session.setLastKnownCwd(path);
-                        this->webSocketServer->broadcastMessage(serialize(CwdUpdateMessage{this->shortenHomePath(path)}));
+                    session.startCommandInHistory(e.cwd);
+                    if (session.hasActiveCommand()) {
+                        CommandStartMessage msg;
+                        msg.sessionId = session.getSessionId();
+                        if (!e.cwd.empty()) msg.cwd = this->shortenHomePath(e.cwd);
+                        this->broadcastToSubscribers(session.getSessionId(), serialize(msg));
                     }
-                }
-            } else {
-                fmt::print("[OSC-PARSE] >>> OSC 7 (cwd) - no file:// found\n");
+                    break;
+                case CommandMarker::Kind::CommandEnd:
+                    LOG_DEBUG(LogCategory::Osc, "OSC 133;B (command_end) exit={}, cwd={}", e.exitCode, e.cwd);
+                    if (!e.cwd.empty()) {
+                        session.setLastKnownCwd(e.cwd);
+                    }
+                    if (session.hasActiveCommand()) {
+                        // Store remaining active screen rows before finishing (scrollback has to match SQLite)
+                        auto& screen = session.getVirtualScreen();
+                        for (size_t row = 0; row < screen.rows(); ++row) {
+                            const auto& segments = screen.rowSegments(row);
+                            if (!segments.empty()) {
+                                session.getSessionStorage().addOutputLine(
+                                    session.getCurrentCommandId(), encodedRow(screen, row));
+                                session.getScrollback().append(session.getCurrentCommandId(), segments);
+                            }
+                        }
+                        
+                        session.finishCurrentCommand(e.exitCode, e.cwd);
+                        CommandEndMessage msg;
+                        msg.sessionId = session.getSessionId();
+                        msg.exitCode = e.exitCode;
+                        if (!e.cwd.empty()) msg.cwd = this->shortenHomePath(e.cwd);
+                        this->broadcastToSubscribers(session.getSessionId(), serialize(msg));
+                    }
+                    // Clear the flag - we've processed command_end, output recording can resume
+                    if (session.hasJustExitedInteractiveMode()) {
+                        LOG_DEBUG(LogCategory::Pty, "Clearing justExitedInteractiveMode flag after command_end");
+                        session.clearJustExitedInteractiveMode();
+                    }
+                    break;
+                case CommandMarker::Kind::PromptStart:
+                    LOG_DEBUG(LogCategory::Osc, "OSC 133;C (prompt_start)");
+                    this->broadcastToSubscribers(session.getSessionId(), serialize(PromptStartMessage{session.getSessionId()}));
+                    break;
+                case CommandMarker::Kind::PromptEnd:
+                    LOG_DEBUG(LogCategory::Osc, "OSC 133;D (prompt_end)");
+                    this->broadcastToSubscribers(session.getSessionId(), serialize(PromptEndMessage{session.getSessionId()}));
+                    break;
+            }
+        } else if constexpr (std::is_same_v<T, termihui::AnsiEvent::CwdChanged>) {
+            LOG_DEBUG(LogCategory::Osc, "OSC 7 (cwd) path={}", e.path);
+            session.setLastKnownCwd(e.path);
+            this->broadcastToSubscribers(session.getSessionId(), serialize(CwdUpdateMessage{session.getSessionId(), this->shortenHomePath(e.path)}));
+        } else if constexpr (std::is_same_v<T, termihui::AnsiEvent::TitleChanged>) {
+            std::string path = extractPathFromTitle(e.title);
+            LOG_DEBUG(LogCategory::Osc, "OSC 2 (window_title) title={}, extracted_path={}", e.title, path);
+            if (!path.empty()) {
+                session.setLastKnownCwd(path);
+                this->broadcastToSubscribers(session.getSessionId(), serialize(CwdUpdateMessage{session.getSessionId(), this->shortenHomePath(path)}));
             }
         } else {
-            fmt::print("[OSC-PARSE] >>> Unknown OSC type, ignoring\n");
+            LOG_DEBUG(LogCategory::Osc, "Unknown OSC type, ignoring");
         }
+    }, event);
+}
+
+void TermihuiServerController::recordSessionOpenLatency(std::chrono::steady_clock::time_point openStart) {
+    auto elapsed = std::chrono::steady_clock::now() - openStart;
+    this->sessionOpenLatencies.push_back(std::chrono::duration<double, std::milli>(elapsed).count());
+}
 
-        i = oscEnd + 1;
+void TermihuiServerController::startSessionRecording(TerminalSessionController& session) {
+    if (this->recordingDirectory.empty()) {
+        return;
     }
+    // A failed recording is logged by the session; the session itself works without it
+    session.startRecording(this->recordingDirectory /
+                           fmt::format("session_{}_run_{}.ptyrec", session.getSessionId(), this->currentRunId));
 }
 
 void TermihuiServerController::printStats() {
+    // Outbound traffic, including what subscriptions saved
+    auto now = std::chrono::steady_clock::now();
+    if (now - this->lastStatsTime > std::chrono::seconds(30)) {
+        auto outboundStats = this->webSocketServer->getOutboundStats();
+        if (outboundStats.messagesSent > 0 || outboundStats.messagesFiltered > 0) {
+            LOG_INFO(LogCategory::Ws, "Outbound: {} messages / {} bytes sent, {} messages / {} bytes filtered by subscriptions",
+                     outboundStats.messagesSent, outboundStats.bytesSent,
+                     outboundStats.messagesFiltered, outboundStats.bytesFiltered);
+        }
+        if (!this->sessionOpenLatencies.empty()) {
+            auto& latencies = this->sessionOpenLatencies;
+            std::sort(latencies.begin(), latencies.end());
+            size_t p99Index = std::min(latencies.size() - 1, latencies.size() * 99 / 100);
+            LOG_INFO(LogCategory::Session, "Session open latency: median {:.1f} ms, p99 {:.1f} ms ({} sessions, {} pooled shells ready)",
+                     latencies[latencies.size() / 2], latencies[p99Index], latencies.size(),
+                     this->shellPool.getReadyCount());
+            latencies.clear();
+        }
+        // Scrollback lives on the session workers: each reports its own
+        for (uint64_t sessionId : this->sessionIds) {
+            this->workerFor(sessionId).post(sessionId, [sessionId](TerminalSessionController& session) {
+                const auto& scrollback = session.getScrollback();
+                if (scrollback.lineCount() > 0) {
+                    LOG_INFO(LogCategory::Session, "Session {} scrollback: {} lines, {} KiB packed, {} KiB in memory", sessionId,
+                             scrollback.lineCount(), scrollback.payloadBytes() / 1024, scrollback.memoryUsage() / 1024);
+                }
+            });
+        }
+        this->lastStatsTime = now;
+    }
+    
     // Disabled - too noisy in logs
     // auto now = std::chrono::steady_clock::now();
     // if (now - this->lastStatsTime > std::chrono::seconds(30)) {
     //     size_t connectedClients = this->webSocketServer->getConnectedClients();
     //     fmt::print("Connected clients: {}\n", connectedClients);
-    //     fmt::print("Active sessions: {}\n", this->sessions.size());
+    //     fmt::print("Active sessions: {}\n", this->sessionIds.size());
     //     this->lastStatsTime = now;
     // }
 }
@@ -2,6 +2,9 @@
 
 #include "TerminalSessionController.h"
 #include "WebSocketServer.h"
+#include "EventLoop.h"
+#include "SessionWorker.h"
+#include "ShellPool.h"
 #include <termihui/filesystem/file_system_manager.h>
 #include "ServerStorage.h"
 #include "CompletionManager.h"
@@ -12,6 +15,7 @@
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <chrono>
 
@@ -26,10 +30,13 @@ public:
      * @param webSocketServer WebSocket server instance (dependency injection)
      * @param aiAgentController AI agent controller instance (dependency injection)
      * @param serverStorage Server storage instance (dependency injection, optional - created in start() if null)
+     * @param sessionWorkerCount number of worker threads sessions are sharded across
+     *        (0 = process sessions on the thread calling update())
      */
     TermihuiServerController(std::unique_ptr<WebSocketServer> webSocketServer,
                              std::unique_ptr<AIAgentController> aiAgentController,
-                             std::unique_ptr<ServerStorage> serverStorage);
+                             std::unique_ptr<ServerStorage> serverStorage,
+                             size_t sessionWorkerCount = 0);
     
     /**
      * Destructor (virtual for testability)
@@ -53,9 +60,39 @@ public:
     
     /**
      * Main update loop iteration
-     * Should be called repeatedly from main loop
+     * Should be called repeatedly from main loop. Blocks in the event loop until
+     * PTY output, WebSocket activity, AI transfer activity or timeout.
+     * @param timeoutMs maximum time to wait for events (0 = don't block)
      */
-    void update();
+    void update(int timeoutMs = 0);
+    
+    /**
+     * Set minimal interval between screen frames of one session
+     * Output arriving faster is merged into the next frame; user input flushes immediately.
+     * Must be called before start().
+     * @param frameInterval interval between frames (zero = send after every PTY read)
+     */
+    void setFrameInterval(std::chrono::steady_clock::duration frameInterval) { this->frameInterval = frameInterval; }
+    
+    /**
+     * Set number of pre-spawned shells kept ready for new and restored sessions
+     * @param size pool size (0 = spawn shell when session is opened)
+     */
+    void setShellPoolSize(size_t size) { this->shellPool.setSize(size); }
+    
+    /**
+     * Set how much scrolled-off output each session keeps in memory
+     * Must be called before start().
+     * @param limits line and byte caps (either 0 = history is always read from SQLite)
+     */
+    void setScrollbackLimits(ScrollbackBuffer::Limits limits) { this->scrollbackLimits = limits; }
+    
+    /**
+     * Record output of every session opened from now on (for replay, see PtyRecording)
+     * Files are named session_<id>_run_<run id>.ptyrec.
+     * @param directory existing directory for recordings (empty = don't record)
+     */
+    void setRecordingDirectory(std::filesystem::path directory) { this->recordingDirectory = std::move(directory); }
     
     /**
      * Check if server should exit
@@ -74,6 +111,7 @@ public:
 
     /**
      * Process terminal output and OSC markers
+     * Runs on the thread owning the session; touches only the session and outbound queue
      * @param session terminal session to process output from
      */
     void processTerminalOutput(TerminalSessionController& session);
@@ -84,28 +122,57 @@ public:
      */
     void sendScreenSnapshot(TerminalSessionController& session);
     
+    /**
+     * Send current screen of session to one client that dropped screen updates
+     * Full snapshot in interactive mode, every row as block_screen_update otherwise.
+     * @param clientId client to resync
+     * @param session terminal session
+     */
+    void sendScreenResync(int clientId, TerminalSessionController& session);
+    
     /**
      * Send screen diff (changed rows only) to clients
      * @param session terminal session
+     * @return true if a message was sent
+     */
+    bool sendScreenDiff(TerminalSessionController& session);
+    
+    /**
+     * Send accumulated screen changes now (diff in interactive mode, block changes otherwise)
+     * Records the frame with session's FramePacer.
+     * @param session terminal session
+     */
+    void flushScreenChanges(TerminalSessionController& session);
+    
+    /**
+     * Send accumulated screen changes if frame interval allows, otherwise defer them
+     * @param session terminal session
      */
-    void sendScreenDiff(TerminalSessionController& session);
+    void paceScreenChanges(TerminalSessionController& session);
     
     /**
      * Process output in block mode (OSC markers for command tracking)
      * @param session terminal session
-     * @param output raw output string
+     * @param output raw output (view into session read buffer)
+     * @param skipOutputRecording don't append raw output to the current command
      */
-    void processBlockModeOutput(TerminalSessionController& session, const std::string& output, bool skipOutputRecording);
+    void processBlockModeOutput(TerminalSessionController& session, std::string_view output, bool skipOutputRecording);
     
     /**
      * Handle ANSI events (mode changes, title, bell)
      */
     void handleAnsiEvents(const std::vector<termihui::AnsiEventVariant>& events, TerminalSessionController& session);
     
+    /**
+     * Handle OSC event in block mode (command markers, working directory, title)
+     */
+    void handleOscEvent(const termihui::AnsiEventVariant& event, TerminalSessionController& session);
+    
     /**
      * Send VirtualScreen changes (scroll-off + dirty rows) to client in block mode
+     * @return true if a message was sent
      */
-    void sendBlockScreenChanges(TerminalSessionController& session);
+    bool sendBlockScreenChanges(TerminalSessionController& session);
 
     /**
      * Shorten path by replacing home directory with ~
@@ -124,6 +191,8 @@ protected:
     virtual void handleMessageFromClient(int clientId, const CreateSessionMessage& message);
     virtual void handleMessageFromClient(int clientId, const CloseSessionMessage& message);
     virtual void handleMessageFromClient(int clientId, const GetHistoryMessage& message);
+    virtual void handleMessageFromClient(int clientId, const SubscribeMessage& message);
+    virtual void handleMessageFromClient(int clientId, const UnsubscribeMessage& message);
     virtual void handleMessageFromClient(int clientId, const AIChatMessage& message);
     virtual void handleMessageFromClient(int clientId, const GetChatHistoryMessage& message);
     virtual void handleMessageFromClient(int clientId, const ListLLMProvidersMessage& message);
@@ -132,9 +201,29 @@ protected:
     virtual void handleMessageFromClient(int clientId, const DeleteLLMProviderMessage& message);
     
     /**
-     * Get session by ID, returns nullptr if not found
+     * Run task against session on the thread that owns it
+     * Lazily restores session controller if session exists in DB.
+     * @param sessionId session ID
+     * @param task work to run (immediately or later on session worker thread)
+     * @return false if session not found
      */
-    TerminalSessionController* findSession(uint64_t sessionId);
+    bool withSession(uint64_t sessionId, SessionWorker::SessionTask task);
+    
+    /**
+     * Get worker that owns (or will own) given session
+     */
+    SessionWorker& workerFor(uint64_t sessionId);
+    
+    /**
+     * Broadcast control message of session to clients subscribed to it
+     */
+    void broadcastToSubscribers(uint64_t sessionId, std::string message);
+    
+    /**
+     * Send command history and current screen state of session to client
+     * Called on the session worker thread
+     */
+    void sendSessionHistory(int clientId, uint64_t sessionId, TerminalSessionController& terminalSessionController);
     
     // Home directory for path shortening (cached at start)
     std::string homeDirectory;
@@ -150,6 +239,22 @@ private:
      */
     void handleDisconnection(int clientId);
     
+    /**
+     * Handle readable PTY: process output and report finished session
+     * Called on the session worker thread
+     */
+    void handleSessionOutput(TerminalSessionController& session);
+    
+    /**
+     * Record time since session open started for latency stats
+     */
+    void recordSessionOpenLatency(std::chrono::steady_clock::time_point openStart);
+    
+    /**
+     * Start PTY recording of a new session controller if a recording directory is set
+     */
+    void startSessionRecording(TerminalSessionController& session);
+    
     /**
      * Print server statistics
      */
@@ -159,21 +264,36 @@ private:
     // Static flag for signal handling
     static std::atomic<bool> shouldExit;
     
+    // Event loop (declared before components that register with it, so it outlives them)
+    EventLoop eventLoop;
+    
     // Server components
     termihui::FileSystemManager fileSystemManager;
     std::unique_ptr<ServerStorage> serverStorage;
     std::unique_ptr<WebSocketServer> webSocketServer;
     std::unique_ptr<AIAgentController> aiAgentController;
     CompletionManager completionManager;
-    termihui::OutputParser outputParser;
+    ShellPool shellPool;
+    
+    // Session workers: sessions are sharded by ID (declared after components they use)
+    std::vector<std::unique_ptr<SessionWorker>> sessionWorkers;
     
-    // Terminal sessions (sessionId -> controller)
-    std::unordered_map<uint64_t, std::unique_ptr<TerminalSessionController>> sessions;
+    // IDs of sessions with a live controller in one of the workers (main thread only)
+    std::unordered_set<uint64_t> sessionIds;
     
-    // UTF-8 pending buffers per session (for incomplete sequences between reads)
-    std::unordered_map<uint64_t, std::string> utf8PendingBuffers;
+    // Minimal interval between screen frames of one session (zero = unpaced)
+    std::chrono::steady_clock::duration frameInterval{};
+    
+    // In-memory scrollback caps applied to every new session controller
+    ScrollbackBuffer::Limits scrollbackLimits;
+    
+    // Directory for PTY recordings of new session controllers (empty = recording off)
+    std::filesystem::path recordingDirectory;
     
     // State tracking
     uint64_t currentRunId = 0;
     std::chrono::steady_clock::time_point lastStatsTime;
+    
+    // Time to open a session (new or restored) since last stats print, milliseconds
+    std::vector<double> sessionOpenLatencies;
 };
@@ -1,4 +1,6 @@
 #include "TerminalSessionController.h"
+#include "Logger.h"
+#include "ShellPool.h"
 
 #include <iostream>
 #include <cstring>
@@ -10,6 +12,7 @@
 #include <fcntl.h>
 #include <poll.h>
 #include <sys/wait.h>
+#include <sys/syscall.h>
 #include <sys/ioctl.h>
 #include <termios.h>
 #include <signal.h>
@@ -18,6 +21,7 @@
 #include <pwd.h>
 #include <fmt/core.h>
 #include <fstream>
+#include <algorithm>
 
 #ifdef __APPLE__
 #include <util.h>
@@ -27,11 +31,44 @@
 #error "Unsupported platform"
 #endif
 
-TerminalSessionController::TerminalSessionController(std::filesystem::path dbPath, uint64_t sessionId, uint64_t serverRunId, size_t bufferSize)
+namespace {
+
+/**
+ * Open descriptor that becomes readable when process exits
+ * @return pidfd or -1 if not supported by platform/kernel
+ */
+int openChildExitFd(pid_t pid)
+{
+#ifdef SYS_pidfd_open
+    int exitFd = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+    if (exitFd < 0) {
+        LOG_WARN(LogCategory::Pty, "pidfd_open error: {}, falling back to polling", strerror(errno));
+    }
+    return exitFd;
+#else
+    (void)pid;
+    return -1;
+#endif
+}
+
+/**
+ * Setup descriptor in non-blocking mode
+ */
+void setNonBlocking(int fd)
+{
+    int flags = fcntl(fd, F_GETFL);
+    if (flags >= 0) {
+        fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    }
+}
+
+} // anonymous namespace
+
+TerminalSessionController::TerminalSessionController(std::filesystem::path dbPath, uint64_t sessionId, uint64_t serverRunId, size_t readChunkSize)
     : ptyFd(-1)
     , childPid(-1)
-    , buffer(bufferSize)
-    , bufferSize(bufferSize)
+    , readBuffer(readChunkSize)
+    , readChunkSize(readChunkSize)
     , running(false)
     , sessionCreated(false)
     , prevRunningState(false)
@@ -49,32 +86,70 @@ TerminalSessionController::~TerminalSessionController()
     this->cleanup();
 }
 
-bool TerminalSessionController::createSession()
+bool TerminalSessionController::createSession(ShellPool* shellPool)
 {
     if (this->sessionCreated) {
-        fmt::print(stderr, "Session already created\n");
+        LOG_ERROR(LogCategory::Pty, "Session already created");
         return false;
     }
 
-    // Determine initial cwd BEFORE fork (SQLite access must be in parent process)
+    // Determine initial cwd (from history or HOME)
     std::string initialCwd;
     if (auto lastCwd = this->sessionStorage.getLastCwd()) {
         initialCwd = *lastCwd;
-        fmt::print("Session {}: Restoring cwd from history: {}\n", this->sessionId, initialCwd);
+        LOG_INFO(LogCategory::Pty, "Session {}: Restoring cwd from history: {}", this->sessionId, initialCwd);
     } else if (const char* home = getenv("HOME")) {
         initialCwd = home;
-        fmt::print("Session {}: Using HOME as initial cwd: {}\n", this->sessionId, initialCwd);
+        LOG_INFO(LogCategory::Pty, "Session {}: Using HOME as initial cwd: {}", this->sessionId, initialCwd);
+    }
+
+    // Warm shell waits at its first prompt: move it to initial cwd and hide that from the client
+    std::optional<Shell> shell;
+    if (shellPool) {
+        shell = shellPool->claim();
+    }
+    if (shell) {
+        this->hideOutputOfNextCommand();
+    } else {
+        shell = spawnShell(initialCwd);
+        if (!shell) {
+            return false;
+        }
     }
+    
+    this->ptyFd = shell->ptyFd;
+    this->childPid = shell->pid;
+    this->childExitFd = shell->exitFd;
+    this->running = true;
+    this->sessionCreated = true;
+    
+    if (this->hiddenPromptCount > 0) {
+        std::string quotedCwd = "'";
+        for (char ch : initialCwd) {
+            quotedCwd += ch == '\'' ? std::string("'\\''") : std::string(1, ch);
+        }
+        quotedCwd += "'";
+        this->sendInput(fmt::format("__termihui_chdir {}\n", quotedCwd));
+        LOG_INFO(LogCategory::Pty, "Interactive bash session claimed from pool (PID: {})", this->childPid);
+    } else {
+        LOG_INFO(LogCategory::Pty, "Interactive bash session created (PID: {})", this->childPid);
+    }
+    
+    return true;
+}
 
+std::optional<TerminalSessionController::Shell> TerminalSessionController::spawnShell(const std::string& initialCwd)
+{
     // Create PTY
-    this->childPid = forkpty(&this->ptyFd, nullptr, nullptr, nullptr);
+    Shell shell;
+    shell.pid = forkpty(&shell.ptyFd, nullptr, nullptr, nullptr);
     
-    if (this->childPid < 0) {
-        fmt::print(stderr, "forkpty error: {}\n", strerror(errno));
-        return false;
+    if (shell.pid < 0) {
+        LOG_ERROR(LogCategory::Pty, "forkpty error: {}", strerror(errno));
+        return std::nullopt;
     }
     
-    if (this->childPid == 0) {
+    if (shell.pid == 0) {
         // Child process
         
         // Change to initial cwd (from history or HOME)
@@ -113,13 +188,17 @@ bool TerminalSessionController::createSession()
         if (rcFd >= 0) {
             std::string rcContent;
             rcContent.append("# TermiHUI shell integration (bash)\n");
+            // Unlink rcfile as soon as bash has read it (one file per shell would pile up in /tmp)
+            rcContent.append(fmt::format("command rm -f -- '{}'\n", rcTemplate));
             rcContent.append("export PS1=\"\"\n");
             // precmd: print OSC 133;B with previous command exit code and cwd
             rcContent.append("__termihui_precmd() { local ec=$?; printf '\\033]133;B;exit=%s;cwd=%s\\007' \"$ec\" \"$PWD\"; }\n");
             // wrapper for PROMPT_COMMAND: sets guard during precmd so DEBUG-trap doesn't trigger extra A
             rcContent.append("__termihui_precmd_wrapper() { local ec=$?; __TERMIHUI_IN_PRECMD=1; __termihui_precmd \"$ec\"; unset __TERMIHUI_IN_PRECMD; }\n");
             // preexec: print OSC 133;A before user command with current cwd, but NOT before PROMPT_COMMAND
-            rcContent.append("__termihui_preexec() { if [[ -n \"$__TERMIHUI_IN_PRECMD\" ]]; then return; fi; if [[ \"$BASH_COMMAND\" == \"__termihui_precmd_wrapper\" || \"$BASH_COMMAND\" == \"__termihui_precmd\" ]]; then return; fi; printf '\\033]133;A;cwd=%s\\007' \"$PWD\"; }\n");
+            rcContent.append("__termihui_preexec() { if [[ -n \"$__TERMIHUI_IN_PRECMD\" ]]; then return; fi; if [[ \"$BASH_COMMAND\" == __termihui_* ]]; then return; fi; printf '\\033]133;A;cwd=%s\\007' \"$PWD\"; }\n");
+            // Hidden cd for pooled shells (see ShellPool): no 133;A, no history entry, failure keeps cwd
+            rcContent.append("__termihui_chdir() { builtin cd -- \"$1\" 2>/dev/null; builtin history -d -1 2>/dev/null; return 0; }\n");
             // In bash use trap DEBUG as preexec equivalent
             rcContent.append("trap '__termihui_preexec' DEBUG\n");
             // PROMPT_COMMAND executes before printing prompt — precmd equivalent
@@ -143,13 +222,10 @@ bool TerminalSessionController::createSession()
     }
     
     // Parent process
-    this->setupNonBlocking();
-    this->running = true;
-    this->sessionCreated = true;
-    
-    fmt::print("Interactive bash session created (PID: {})\n", this->childPid);
+    setNonBlocking(shell.ptyFd);
+    shell.exitFd = openChildExitFd(shell.pid);
     
-    return true;
+    return shell;
 }
 
 TerminalSessionController::ExecuteCommandResult TerminalSessionController::executeCommand(std::string_view command)
@@ -160,7 +236,7 @@ TerminalSessionController::ExecuteCommandResult TerminalSessionController::execu
     
     // Send command + newline to interactive shell
     std::string cmd = std::string(command) + "\n";
-    const ssize_t bytesWritten = write(this->ptyFd, cmd.c_str(), cmd.length());
+    const ssize_t bytesWritten = this->sendInput(cmd);
     
     if (bytesWritten < 0) {
         std::string errorText = fmt::format("Command send error: {}", strerror(errno));
@@ -176,49 +252,204 @@ ssize_t TerminalSessionController::sendInput(std::string_view input)
         return -1;
     }
     
-    ssize_t bytesWritten = write(this->ptyFd, input.data(), input.length());
-    if (bytesWritten < 0) {
-        fmt::print(stderr, "PTY write error: {}\n", strerror(errno));
+    if (this->pendingInput.size() - this->pendingInputOffset + input.size() > maxPendingInput) {
+        LOG_WARN(LogCategory::Pty, "PTY input queue full, {} bytes rejected", input.size());
+        errno = ENOBUFS;
+        return -1;
+    }
+    
+    // Queued bytes go first: input must reach the PTY in order
+    this->pendingInput.append(input);
+    if (!this->flushPendingInput()) {
+        return -1;
+    }
+    
+    return static_cast<ssize_t>(input.size());
+}
+
+ssize_t TerminalSessionController::sendPaste(std::string_view text)
+{
+    if (!this->ansiProcessor.isBracketedPasteMode()) {
+        return this->sendInput(text);
+    }
+    
+    static constexpr std::string_view pasteStart = "\x1b[200~";
+    static constexpr std::string_view pasteEnd = "\x1b[201~";
+    
+    // End marker inside pasted text would let the rest run as typed input: drop it
+    std::string bracketed;
+    bracketed.reserve(text.size() + pasteStart.size() + pasteEnd.size());
+    bracketed += pasteStart;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t markerPos = text.find(pasteEnd, pos);
+        if (markerPos == std::string_view::npos) {
+            bracketed += text.substr(pos);
+            break;
+        }
+        bracketed += text.substr(pos, markerPos - pos);
+        pos = markerPos + pasteEnd.size();
+    }
+    bracketed += pasteEnd;
+    
+    return this->sendInput(bracketed);
+}
+
+bool TerminalSessionController::flushPendingInput()
+{
+    if (this->ptyFd < 0) {
+        return false;
+    }
+    
+    while (this->hasPendingInput()) {
+        ssize_t bytesWritten = write(this->ptyFd, this->pendingInput.data() + this->pendingInputOffset,
+                                     this->pendingInput.size() - this->pendingInputOffset);
+        if (bytesWritten > 0) {
+            this->pendingInputOffset += static_cast<size_t>(bytesWritten);
+        } else if (bytesWritten < 0 && errno == EINTR) {
+            continue;
+        } else if (bytesWritten == 0 || errno == EAGAIN || errno == EWOULDBLOCK) {
+            // PTY input buffer is full: rest waits for writability
+            break;
+        } else {
+            int writeError = errno;
+            LOG_ERROR(LogCategory::Pty, "PTY write error: {}", strerror(writeError));
+            this->pendingInput.clear();
+            this->pendingInputOffset = 0;
+            errno = writeError;
+            return false;
+        }
     }
     
-    return bytesWritten;
+    if (!this->hasPendingInput()) {
+        this->pendingInput.clear();
+        this->pendingInputOffset = 0;
+    } else if (this->pendingInputOffset > this->pendingInput.size() / 2) {
+        // Drop written prefix once it dominates, so appends don't grow the buffer forever
+        this->pendingInput.erase(0, this->pendingInputOffset);
+        this->pendingInputOffset = 0;
+    }
+    return true;
 }
 
 std::string TerminalSessionController::readOutput()
 {
-    if (!this->running || this->ptyFd < 0) {
-        return "";
+    return std::string(this->drainOutput());
+}
+
+std::string_view TerminalSessionController::drainOutput()
+{
+    this->compactReadBuffer();
+    if (this->ptyFd < 0) {
+        return {};
     }
     
-    std::string output;
+    const size_t retainedSize = this->readBufferUsed;
     
-    // Read all available data
-    while (this->hasData()) {
-        ssize_t bytesRead = read(this->ptyFd, this->buffer.data(), this->bufferSize);
+    // Read until EAGAIN with large reads; readiness comes from the event loop, no poll() per read.
+    // Capped per call so one flooding session can't starve others on the same worker.
+    while (this->readBufferUsed - retainedSize < maxBytesPerDrain) {
+        if (this->readBuffer.size() - this->readBufferUsed < this->readChunkSize) {
+            this->readBuffer.resize(this->readBufferUsed + this->readChunkSize);
+        }
         
+        ssize_t bytesRead = read(this->ptyFd, this->readBuffer.data() + this->readBufferUsed,
+                                 this->readBuffer.size() - this->readBufferUsed);
         if (bytesRead > 0) {
-            output.append(this->buffer.data(), bytesRead);
+            this->readBufferUsed += static_cast<size_t>(bytesRead);
         } else if (bytesRead == 0) {
             // EOF - process terminated
-            this->checkChildStatus();
             break;
+        } else if (errno == EINTR) {
+            continue;
         } else {
-            if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                // No data to read
-                break;
-            } else {
-                fmt::print(stderr, "PTY read error: {}\n", strerror(errno));
-                break;
+            // EAGAIN: drained. EIO: shell side closed (Linux reports it instead of EOF)
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EIO) {
+                LOG_ERROR(LogCategory::Pty, "PTY read error: {}", strerror(errno));
             }
+            break;
         }
     }
     
-    // Check child process status
-    this->checkChildStatus();
+    // Without exit descriptor nobody tells us about child exit: poll
+    if (this->childExitFd < 0) {
+        this->checkChildStatus();
+    }
     
+    return this->takeOutput(retainedSize);
+}
+
+std::string_view TerminalSessionController::takeOutput(size_t retainedSize)
+{
+    if (this->readBufferUsed == retainedSize) {
+        // Nothing new: keep retained bytes for the next read
+        this->retainedTailSize = retainedSize;
+        return {};
+    }
+    std::string_view output(this->readBuffer.data(), this->readBufferUsed);
+    bool hidingOutput = this->hiddenPromptCount > 0;
+    if (hidingOutput) {
+        output = this->skipHiddenOutput(output);
+    }
+    if (this->recording.isOpen() && !output.empty()) {
+        // Retained bytes went into the previous chunk, unless they were held back while hiding output
+        this->recording.writeOutput(hidingOutput ? output : output.substr(retainedSize), PtyRecording::Clock::now());
+    }
     return output;
 }
 
+std::string_view TerminalSessionController::skipHiddenOutput(std::string_view output)
+{
+    static constexpr std::string_view promptMarker = "\x1b]133;B";
+    
+    size_t pos = 0;
+    while (this->hiddenPromptCount > 0) {
+        size_t markerPos = output.find(promptMarker, pos);
+        if (markerPos == std::string_view::npos) {
+            // Marker may be split across reads: keep what could be its beginning
+            this->retainedTailSize = std::min(output.size() - pos, promptMarker.size() - 1);
+            return {};
+        }
+        if (--this->hiddenPromptCount == 0) {
+            // Client sees the prompt the hidden command ended with, as if shell just started there
+            return output.substr(markerPos);
+        }
+        pos = markerPos + promptMarker.size();
+    }
+    return output;
+}
+
+void TerminalSessionController::retainOutputTail(size_t count)
+{
+    this->retainedTailSize = std::min(count, this->readBufferUsed);
+}
+
+std::string_view TerminalSessionController::bufferOutput(std::string_view data)
+{
+    this->compactReadBuffer();
+    const size_t retainedSize = this->readBufferUsed;
+    if (!data.empty()) {
+        if (this->readBuffer.size() < this->readBufferUsed + data.size()) {
+            this->readBuffer.resize(this->readBufferUsed + data.size());
+        }
+        std::memcpy(this->readBuffer.data() + this->readBufferUsed, data.data(), data.size());
+        this->readBufferUsed += data.size();
+    }
+    return this->takeOutput(retainedSize);
+}
+
+void TerminalSessionController::compactReadBuffer()
+{
+    // Move retained tail (a few bytes of split UTF-8) to the front, drop everything else
+    if (this->retainedTailSize > 0 && this->retainedTailSize < this->readBufferUsed) {
+        std::memmove(this->readBuffer.data(),
+                     this->readBuffer.data() + this->readBufferUsed - this->retainedTailSize,
+                     this->retainedTailSize);
+    }
+    this->readBufferUsed = this->retainedTailSize;
+    this->retainedTailSize = 0;
+}
+
 bool TerminalSessionController::isRunning() const
 {
     return this->running;
@@ -237,22 +468,18 @@ pid_t TerminalSessionController::getChildPid() const
     return this->childPid;
 }
 
-void TerminalSessionController::terminate()
+TerminalSessionController::ChildProcess TerminalSessionController::releaseChild()
 {
-    if (this->running && this->childPid > 0) {
-        // First try graceful termination
-        kill(this->childPid, SIGTERM);
-        
-        // Wait a bit
-        usleep(100000); // 100ms
-        
-        // If process still running, force terminate
-        if (this->running) {
-            kill(this->childPid, SIGKILL);
-        }
-    }
-    
+    ChildProcess child{this->childPid, this->childExitFd};
+    this->childPid = -1;
+    this->childExitFd = -1;
     this->cleanup();
+    return child;
+}
+
+void TerminalSessionController::handleChildExit()
+{
+    this->checkChildStatus();
 }
 
 int TerminalSessionController::getPtyFd() const
@@ -280,22 +507,18 @@ bool TerminalSessionController::hasData() const
     return false;
 }
 
-void TerminalSessionController::setupNonBlocking()
-{
-    if (this->ptyFd >= 0) {
-        int flags = fcntl(this->ptyFd, F_GETFL);
-        if (flags >= 0) {
-            fcntl(this->ptyFd, F_SETFL, flags | O_NONBLOCK);
-        }
-    }
-}
-
 void TerminalSessionController::cleanup()
 {
     if (this->ptyFd >= 0) {
         close(this->ptyFd);
         this->ptyFd = -1;
     }
+    if (this->childExitFd >= 0) {
+        close(this->childExitFd);
+        this->childExitFd = -1;
+    }
+    this->pendingInput.clear();
+    this->pendingInputOffset = 0;
     
     if (this->childPid > 0) {
         // Wait for child process termination
@@ -327,7 +550,7 @@ void TerminalSessionController::checkChildStatus()
         //     this->onProcessExit(status, WIFEXITED(status) ? WEXITSTATUS(status) : -1);
         // }
     } else if (result < 0 && errno != ECHILD) {
-        fmt::print(stderr, "waitpid error: {}\n", strerror(errno));
+        LOG_ERROR(LogCategory::Pty, "waitpid error: {}", strerror(errno));
     }
 }
 
@@ -335,7 +558,7 @@ void TerminalSessionController::setLastKnownCwd(const std::string& cwd)
 {
     if (!cwd.empty()) {
         lastKnownCwd = cwd;
-        fmt::print("Updated lastKnownCwd: '{}'\n", lastKnownCwd);
+        LOG_DEBUG(LogCategory::Pty, "Updated lastKnownCwd: '{}'", lastKnownCwd);
     }
 }
 
@@ -355,7 +578,7 @@ std::string TerminalSessionController::getCurrentWorkingDirectory() const
     // First try to find bash process among child processes
     std::string findBashCommand = "pgrep -P " + std::to_string(childPid) + " bash 2>/dev/null | head -1";
     
-    fmt::print("Searching for bash process: {}\n", findBashCommand);
+    LOG_DEBUG(LogCategory::Pty, "Searching for bash process: {}", findBashCommand);
     
     FILE* bashPipe = popen(findBashCommand.c_str(), "r");
     pid_t bashPid = childPid; // Default to original PID
@@ -364,7 +587,7 @@ std::string TerminalSessionController::getCurrentWorkingDirectory() const
         char buffer[32];
         if (fgets(buffer, sizeof(buffer), bashPipe) != nullptr) {
             bashPid = std::atoi(buffer);
-            fmt::print("Found bash process with PID: {}\n", bashPid);
+            LOG_DEBUG(LogCategory::Pty, "Found bash process with PID: {}", bashPid);
         }
         pclose(bashPipe);
     }
@@ -372,7 +595,7 @@ std::string TerminalSessionController::getCurrentWorkingDirectory() const
     // Now get cwd for found bash process
     std::string command = "lsof -p " + std::to_string(bashPid) + " -d cwd -Fn 2>/dev/null | grep '^n' | cut -c2-";
     
-    fmt::print("Executing command: {}\n", command);
+    LOG_DEBUG(LogCategory::Pty, "Executing command: {}", command);
     
     FILE* pipe = popen(command.c_str(), "r");
     if (pipe) {
@@ -384,7 +607,7 @@ std::string TerminalSessionController::getCurrentWorkingDirectory() const
             if (!result.empty() && result.back() == '\n') {
                 result.pop_back();
             }
-            fmt::print("lsof returned: '{}'\n", result);
+            LOG_DEBUG(LogCategory::Pty, "lsof returned: '{}'", result);
             if (!result.empty() && result != "/") {
                 return result;
             }
@@ -392,7 +615,7 @@ std::string TerminalSessionController::getCurrentWorkingDirectory() const
         pclose(pipe);
     }
     
-    fmt::print("lsof failed, using fallback directory\n");
+    LOG_DEBUG(LogCategory::Pty, "lsof failed, using fallback directory");
     
     // Fallback - use user's home directory
     const char* home = getenv("HOME");
@@ -416,14 +639,14 @@ std::string TerminalSessionController::getCurrentWorkingDirectory() const
     }
 #endif
     
-    fmt::print(stderr, "Failed to get current directory for process {}\n", childPid);
+    LOG_ERROR(LogCategory::Pty, "Failed to get current directory for process {}", childPid);
     return "";
 }
 
 bool TerminalSessionController::setWindowSize(unsigned short cols, unsigned short rows)
 {
     if (this->ptyFd < 0) {
-        fmt::print(stderr, "Cannot set window size: PTY not initialized\n");
+        LOG_ERROR(LogCategory::Pty, "Cannot set window size: PTY not initialized");
         return false;
     }
     
@@ -434,14 +657,25 @@ bool TerminalSessionController::setWindowSize(unsigned short cols, unsigned shor
     ws.ws_ypixel = 0;
     
     if (ioctl(this->ptyFd, TIOCSWINSZ, &ws) < 0) {
-        fmt::print(stderr, "Failed to set window size: {}\n", strerror(errno));
+        LOG_ERROR(LogCategory::Pty, "Failed to set window size: {}", strerror(errno));
         return false;
     }
     
     // Also resize the virtual screen
     this->virtualScreen.resize(rows, cols);
+    this->recording.writeResize(rows, cols, PtyRecording::Clock::now());
     
-    fmt::print("Terminal size set to {}x{}\n", cols, rows);
+    LOG_DEBUG(LogCategory::Pty, "Terminal size set to {}x{}", cols, rows);
+    return true;
+}
+
+bool TerminalSessionController::startRecording(const std::filesystem::path& path)
+{
+    if (!this->recording.open(path, this->virtualScreen.rows(), this->virtualScreen.columns(), PtyRecording::Clock::now())) {
+        LOG_ERROR(LogCategory::Pty, "Failed to create PTY recording {}", path.string());
+        return false;
+    }
+    LOG_INFO(LogCategory::Pty, "Recording session {} output to {}", this->sessionId, path.string());
     return true;
 }
 
@@ -455,26 +689,26 @@ void TerminalSessionController::startCommandInHistory(const std::string& cwd) {
     }
     
     this->currentCommandId = this->sessionStorage.addCommand(this->serverRunId, this->pendingCommand, cwd);
-    fmt::print("Added command to storage with ID: {}\n", this->currentCommandId);
+    LOG_DEBUG(LogCategory::Storage, "Added command to storage with ID: {}", this->currentCommandId);
     
     this->pendingCommand.clear();
 }
 
-void TerminalSessionController::appendOutputToCurrentCommand(const std::string& output) {
+void TerminalSessionController::appendOutputToCurrentCommand(std::string_view output) {
     if (this->currentCommandId > 0) {
-        this->sessionStorage.appendOutput(this->currentCommandId, output);
+        this->sessionStorage.appendOutput(this->currentCommandId, std::string(output));
     } else {
-        fmt::print("[WARN] appendOutputToCurrentCommand called with no active command, output ignored ({} bytes)\n", output.size());
+        LOG_WARN(LogCategory::Storage, "appendOutputToCurrentCommand called with no active command, output ignored ({} bytes)", output.size());
     }
 }
 
 void TerminalSessionController::finishCurrentCommand(int exitCode, const std::string& cwd) {
     if (this->currentCommandId > 0) {
         this->sessionStorage.finishCommand(this->currentCommandId, exitCode, cwd);
-        fmt::print("Finished command ID: {} with exit code: {}\n", this->currentCommandId, exitCode);
+        LOG_DEBUG(LogCategory::Storage, "Finished command ID: {} with exit code: {}", this->currentCommandId, exitCode);
         this->currentCommandId = 0;
     } else {
-        fmt::print("[WARN] finishCurrentCommand called with no active command (exit={}, cwd={})\n", exitCode, cwd);
+        LOG_WARN(LogCategory::Storage, "finishCurrentCommand called with no active command (exit={}, cwd={})", exitCode, cwd);
     }
 }
 
@@ -5,12 +5,18 @@
 #include <vector>
 #include <memory>
 #include <filesystem>
+#include <optional>
 #include <sys/types.h>
 #include <variant>
 
 #include "SessionStorage.h"
 #include "VirtualScreen.h"
 #include "AnsiProcessor.h"
+#include "FramePacer.h"
+#include "ScrollbackBuffer.h"
+#include "PtyRecording.h"
+
+class ShellPool;
 
 /**
  * Class for managing terminal sessions via PTY
@@ -19,7 +25,8 @@
  * - Asynchronous command execution via forkpty
  * - Non-blocking output reading
  * - Data buffering
- * - Process state checking
+ * - Queued input: writes never block, the rest is flushed when the PTY becomes writable
+ * - Process state checking (exit reported through pidfd where available)
  */
 class TerminalSessionController {
 public:
@@ -28,9 +35,9 @@ public:
      * @param dbPath path to session storage database
      * @param sessionId unique session ID (from database)
      * @param serverRunId current server run ID
-     * @param bufferSize output buffer size (default 4096)
+     * @param readChunkSize minimum free space for each PTY read (default 64 KiB)
      */
-    TerminalSessionController(std::filesystem::path dbPath, uint64_t sessionId, uint64_t serverRunId, size_t bufferSize = 4096);
+    TerminalSessionController(std::filesystem::path dbPath, uint64_t sessionId, uint64_t serverRunId, size_t readChunkSize = 64 * 1024);
     
     /**
      * Get session ID
@@ -49,10 +56,27 @@ public:
     TerminalSessionController& operator=(TerminalSessionController&&) = delete;
     
     /**
-     * Create interactive bash session
+     * Shell running on its own PTY, not yet owned by a session
+     */
+    struct Shell {
+        int ptyFd = -1;
+        pid_t pid = -1;
+        int exitFd = -1;  // pidfd, -1 if unavailable
+    };
+    
+    /**
+     * Start bash with shell integration on a new non-blocking PTY
+     * @param initialCwd working directory (empty = inherit)
+     * @return started shell, nullopt on error
+     */
+    static std::optional<Shell> spawnShell(const std::string& initialCwd);
+    
+    /**
+     * Create interactive bash session in cwd restored from history (or HOME)
+     * @param shellPool pool to claim a warm shell from (nullptr or empty pool = spawn new shell)
      * @return true if session successfully created
      */
-    bool createSession();
+    bool createSession(ShellPool* shellPool = nullptr);
     
     struct SessionNotCreatedOrInactiveError {};
 
@@ -96,22 +120,58 @@ public:
     /**
      * Execute command in existing session
      * @param command command to execute
-     * @return true if command successfully sent
+     * @return true if command successfully queued (see sendInput())
      */
     ExecuteCommandResult executeCommand(std::string_view command);
     
     /**
      * Send text to PTY
+     * Writes as much as the PTY accepts right away, the rest is queued (in order)
+     * until flushPendingInput() is called on writability.
      * @param input text to send
-     * @return number of bytes sent, -1 on error
+     * @return number of bytes accepted (written or queued), -1 on error or full queue
      */
     ssize_t sendInput(std::string_view input);
     
     /**
-     * Read available output from PTY
+     * Send pasted text to PTY
+     * Wrapped in ESC[200~ ... ESC[201~ if the application enabled bracketed paste mode.
+     * @param text pasted text
+     * @return number of bytes accepted, -1 on error or full queue
+     */
+    ssize_t sendPaste(std::string_view text);
+    
+    /**
+     * Write queued input until the PTY stops accepting it (call when PTY is writable)
+     * @return false on write error (queue is discarded)
+     */
+    bool flushPendingInput();
+    
+    /**
+     * Check if input is waiting for the PTY to become writable
+     */
+    bool hasPendingInput() const { return this->pendingInputOffset < this->pendingInput.size(); }
+    
+    /**
+     * Read available output from PTY (copying wrapper around drainOutput())
      * @return string with new output
      */
-    virtual std::string readOutput();
+    std::string readOutput();
+    
+    /**
+     * Drain available PTY output into the reusable session read buffer
+     * Reads until EAGAIN (bounded per call), without polling between reads.
+     * @return view of buffered bytes, valid until the next drain/read call;
+     *         starts with bytes kept by retainOutputTail(), empty if nothing new arrived
+     */
+    virtual std::string_view drainOutput();
+    
+    /**
+     * Keep last bytes of the current output view for the next drainOutput()
+     * (e.g. incomplete UTF-8 sequence split across reads)
+     * @param count number of trailing bytes to keep
+     */
+    void retainOutputTail(size_t count);
     
     /**
      * Check if process is running
@@ -133,9 +193,19 @@ public:
     pid_t getChildPid() const;
     
     /**
-     * Force terminate session
+     * Child process handed over for termination
      */
-    void terminate();
+    struct ChildProcess {
+        pid_t pid = -1;    // -1 if child already exited and was reaped
+        int exitFd = -1;   // pidfd, -1 if unavailable; owned by receiver
+    };
+    
+    /**
+     * Close PTY (shell gets SIGHUP) and hand child over without waiting for it
+     * Use ProcessReaper to make sure it is gone.
+     * @return child still to be reaped
+     */
+    ChildProcess releaseChild();
     
     /**
      * Get PTY file descriptor (for external polling)
@@ -143,6 +213,18 @@ public:
      */
     int getPtyFd() const;
     
+    /**
+     * Get descriptor that becomes readable when child exits (pidfd, Linux 5.3+)
+     * When -1, exit is detected by polling in drainOutput().
+     * @return file descriptor or -1
+     */
+    int getChildExitFd() const { return this->childExitFd; }
+    
+    /**
+     * Collect exit status of child (call when child exit descriptor is readable)
+     */
+    void handleChildExit();
+    
     /**
      * Check if data is available for reading (non-blocking)
      * @return true if data is available
@@ -191,7 +273,7 @@ public:
      * Append output to current command in history
      * @param output output text to append
      */
-    virtual void appendOutputToCurrentCommand(const std::string& output);
+    virtual void appendOutputToCurrentCommand(std::string_view output);
     
     /**
      * Finish current command in history (called on OSC 133;B)
@@ -259,12 +341,66 @@ public:
      * Get ANSI processor reference
      */
     termihui::AnsiProcessor& getAnsiProcessor() { return this->ansiProcessor; }
+    
+    /**
+     * Get frame pacing state for screen updates
+     */
+    FramePacer& getFramePacer() { return this->framePacer; }
+    const FramePacer& getFramePacer() const { return this->framePacer; }
+    
+    /**
+     * Get in-memory scrollback (recent scrolled-off lines, also stored in SQLite)
+     */
+    ScrollbackBuffer& getScrollback() { return this->scrollback; }
+    const ScrollbackBuffer& getScrollback() const { return this->scrollback; }
+    
+    /**
+     * Start recording output to a file (see PtyRecording), replacing any running recording
+     * Each drain is recorded as one chunk of exactly the bytes handed to the emulator,
+     * window size changes as resize records.
+     * @param path recording file (created or truncated)
+     * @return false if the file can't be created
+     */
+    bool startRecording(const std::filesystem::path& path);
+    
+    /**
+     * Stop recording and close the file
+     */
+    void stopRecording() { this->recording.close(); }
+    
+    bool isRecording() const { return this->recording.isOpen(); }
+
+protected:
+    /**
+     * Append externally provided output to the read buffer (same contract as drainOutput())
+     * Used by test doubles that don't own a real PTY
+     */
+    std::string_view bufferOutput(std::string_view data);
+    
+    /**
+     * Drop output up to the prompt marker that ends the next command (see skipHiddenOutput())
+     */
+    void hideOutputOfNextCommand() { ++this->hiddenPromptCount; }
 
 private:
     /**
-     * Setup PTY in non-blocking mode
+     * Drop consumed bytes from read buffer, keeping retained tail at the front
      */
-    void setupNonBlocking();
+    void compactReadBuffer();
+    
+    /**
+     * Drop output that belongs to the hidden cd of a claimed warm shell
+     * @return output starting at the prompt marker the client should see, empty while still hidden
+     */
+    std::string_view skipHiddenOutput(std::string_view output);
+    
+    /**
+     * Finish a drain after new bytes were appended to the read buffer: drop hidden output and
+     * record the bytes passed on for the first time
+     * @param retainedSize bytes at the front of the buffer kept from the previous drain
+     * @return output view (see drainOutput())
+     */
+    std::string_view takeOutput(size_t retainedSize);
     
     /**
      * Resource cleanup
@@ -279,8 +415,16 @@ private:
 private:
     int ptyFd;                    // PTY file descriptor
     pid_t childPid;               // Child process PID
-    std::vector<char> buffer;     // Buffer for reading data
-    size_t bufferSize;            // Buffer size
+    int childExitFd = -1;         // pidfd of child process, -1 if unavailable
+    std::vector<char> readBuffer; // Reusable PTY read buffer (grows up to maxBytesPerDrain + readChunkSize)
+    size_t readChunkSize;         // Minimum free space per read() call
+    size_t readBufferUsed = 0;    // Bytes of readBuffer handed out by the last drain
+    size_t retainedTailSize = 0;  // Trailing bytes to keep for the next drain
+    static constexpr size_t maxBytesPerDrain = 256 * 1024;
+    int hiddenPromptCount = 0;    // Prompt markers of hidden commands still to be dropped from output
+    std::string pendingInput;       // Input not yet accepted by the PTY
+    size_t pendingInputOffset = 0;  // Bytes of pendingInput already written
+    static constexpr size_t maxPendingInput = 64 * 1024 * 1024;
     bool running;                 // Process activity flag
     bool sessionCreated;          // Session created flag
     bool prevRunningState;        // Previous running state for transition detection
@@ -298,9 +442,14 @@ private:
     // Virtual screen for terminal emulation
     termihui::VirtualScreen virtualScreen;
     termihui::AnsiProcessor ansiProcessor;
+    FramePacer framePacer;
+    ScrollbackBuffer scrollback;
     bool interactiveMode = false;
     bool justExitedInteractiveMode = false;  // Flag to skip output recording after exiting interactive mode
     
+    // PTY stream recording for offline replay (closed unless started)
+    PtyRecording::Writer recording;
+    
     // TODO: Add in future:
     // - struct winsize m_windowSize;  // Terminal window size for resize events
     // - std::string m_lastCommand;    // Last executed command
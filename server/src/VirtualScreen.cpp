@@ -1,4 +1,5 @@
 #include "VirtualScreen.h"
+#include <termihui/utf8.h>
 #include <algorithm>
 
 namespace termihui {
@@ -8,6 +9,9 @@ VirtualScreen::VirtualScreen(size_t rows, size_t columns)
     , rowCount(rows)
     , columnCount(columns)
 {
+    this->resetScrollRegion();
+    this->resetDirtyTracking();
+    this->resetRowVersions();
 }
 
 VirtualScreen::VirtualScreen()
@@ -20,28 +24,160 @@ VirtualScreen::VirtualScreen()
 // =============================================================================
 
 void VirtualScreen::putCharacter(char32_t character) {
-    this->putCharacter(character, this->currentTextStyle);
+    this->putCodepoint(character, this->currentStyleId);
 }
 
 void VirtualScreen::putCharacter(char32_t character, const TextStyle& style) {
-    if (this->cursorColumnPosition >= this->columnCount) {
-        // Wrap to next line
+    this->putCodepoint(character, this->internStyle(style));
+}
+
+void VirtualScreen::putCodepoint(char32_t character, StyleId styleId) {
+    bool boundary = this->graphemeSegmenter.isBoundary(character);
+    auto width = static_cast<size_t>(unicode::width(character));
+    if ((!boundary || width == 0) && this->canExtendLastCell()) {
+        this->extendLastCell(character);
+    } else if (width > 0) {
+        this->putCell(Cell{character, styleId}, width);
+    }
+    // Zero-width character with no cell before it to join is dropped
+}
+
+void VirtualScreen::putCell(Cell cell, size_t width) {
+    width = std::min(width, this->columnCount);
+    if (this->cursorColumnPosition + width > this->columnCount) {
+        // Wrap to next line (a wide character is never split across lines)
         this->cursorColumnPosition = 0;
         this->lineFeed();
     }
     
-    this->buffer(this->cursorRowPosition, this->cursorColumnPosition) = Cell{character, style};
-    this->markDirty(this->cursorRowPosition);
-    ++this->cursorColumnPosition;
+    size_t row = this->cursorRowPosition;
+    size_t column = this->cursorColumnPosition;
+    this->splitWideCells(row, column, column + width);
+    Cell* cells = this->buffer.rowPointer(row) + column;
+    cells[0] = cell;
+    if (width == 2) {
+        cells[0].flags = Cell::wideFlag;
+        cells[1] = Cell{U' ', cell.styleId, Cell::spacerFlag};
+        this->wideCellRows[row] = 1;
+    }
+    this->markDirty(row, column, column + width);
+    
+    this->lastCellRow = row;
+    this->lastCellColumn = column;
+    this->lastCellVersion = this->rowVersions[row];
+    this->cursorColumnPosition += width;
     this->cursorDirtyFlag = true;
 }
 
+void VirtualScreen::putString(std::u32string_view text) {
+    while (!text.empty()) {
+        // Bulk of text is one cell per codepoint: such runs are written directly
+        size_t simpleLength = 0;
+        while (simpleLength < text.size() && unicode::isSimple(text[simpleLength])) {
+            ++simpleLength;
+        }
+        this->putRun(text.substr(0, simpleLength));
+        if (simpleLength == text.size()) {
+            break;
+        }
+        this->putCodepoint(text[simpleLength], this->currentStyleId);
+        text.remove_prefix(simpleLength + 1);
+    }
+}
+
+void VirtualScreen::putString(std::string_view asciiText) {
+    this->putRun(asciiText);
+}
+
+template<typename CharT>
+void VirtualScreen::putRun(std::basic_string_view<CharT> text) {
+    if (text.empty() || this->columnCount == 0) {
+        return;
+    }
+    
+    Cell cell{U' ', this->currentStyleId};
+    while (!text.empty()) {
+        if (this->cursorColumnPosition >= this->columnCount) {
+            // Wrap to next line
+            this->cursorColumnPosition = 0;
+            this->lineFeed();
+        }
+        
+        size_t count = std::min(text.size(), this->columnCount - this->cursorColumnPosition);
+        this->splitWideCells(this->cursorRowPosition, this->cursorColumnPosition, this->cursorColumnPosition + count);
+        Cell* row = this->buffer.rowPointer(this->cursorRowPosition) + this->cursorColumnPosition;
+        for (size_t i = 0; i < count; ++i) {
+            cell.character = static_cast<char32_t>(text[i]);
+            row[i] = cell;
+        }
+        this->markDirty(this->cursorRowPosition, this->cursorColumnPosition, this->cursorColumnPosition + count);
+        this->cursorColumnPosition += count;
+        text.remove_prefix(count);
+    }
+    
+    // Characters of the run are all simple: whatever follows may only join the last one
+    this->graphemeSegmenter.reset(unicode::GraphemeProperty::Other);
+    this->lastCellRow = this->cursorRowPosition;
+    this->lastCellColumn = this->cursorColumnPosition - 1;
+    this->lastCellVersion = this->rowVersions[this->cursorRowPosition];
+    this->cursorDirtyFlag = true;
+}
+
+bool VirtualScreen::canExtendLastCell() const {
+    // Only right after writing it: cursor still behind it and its row not changed since
+    if (this->lastCellRow >= this->rowCount || this->rowVersions[this->lastCellRow] != this->lastCellVersion ||
+        this->lastCellRow != this->cursorRowPosition) {
+        return false;
+    }
+    size_t width = this->buffer(this->lastCellRow, this->lastCellColumn).isWide() ? 2 : 1;
+    return this->lastCellColumn + width == this->cursorColumnPosition;
+}
+
+void VirtualScreen::extendLastCell(char32_t character) {
+    const Cell& cell = this->buffer(this->lastCellRow, this->lastCellColumn);
+    std::u32string cluster = GraphemeTable::isCluster(cell.character)
+        ? std::u32string(this->graphemeTable.cluster(cell.character))
+        : std::u32string(1, cell.character);
+    if (cluster.size() >= maxClusterLength) {
+        return;
+    }
+    cluster += character;
+    
+    // Interning may compact the table and renumber cells, so the cell is looked up again after
+    char32_t id = this->internCluster(cluster);
+    if (id == 0) {
+        return;
+    }
+    Cell& target = this->buffer(this->lastCellRow, this->lastCellColumn);
+    target.character = id;
+    this->wideCellRows[this->lastCellRow] = 1;
+    this->markDirty(this->lastCellRow, this->lastCellColumn, this->lastCellColumn + (target.isWide() ? 2 : 1));
+    this->lastCellVersion = this->rowVersions[this->lastCellRow];
+}
+
+void VirtualScreen::splitWideCells(size_t row, size_t begin, size_t end) {
+    // Overwriting one half of a double-width character blanks the other half
+    Cell* cells = this->buffer.rowPointer(row);
+    if (begin > 0 && begin < this->columnCount && cells[begin].isSpacer()) {
+        cells[begin - 1] = Cell{U' ', cells[begin - 1].styleId};
+        this->markDirty(row, begin - 1, begin);
+        this->wideCellRows[row] = 1;
+    }
+    if (end > begin && end < this->columnCount && cells[end].isSpacer()) {
+        cells[end] = Cell{U' ', cells[end].styleId};
+        this->markDirty(row, end, end + 1);
+        this->wideCellRows[row] = 1;
+    }
+}
+
 void VirtualScreen::setCurrentStyle(const TextStyle& style) {
     this->currentTextStyle = style;
+    this->currentStyleId = this->internStyle(style);
 }
 
 void VirtualScreen::resetStyle() {
     this->currentTextStyle.reset();
+    this->currentStyleId = StyleTable::defaultStyleId;
 }
 
 // =============================================================================
@@ -80,57 +216,77 @@ void VirtualScreen::carriageReturn() {
 }
 
 void VirtualScreen::lineFeed() {
-    if (this->cursorRowPosition + 1 < this->rowCount) {
-        ++this->cursorRowPosition;
-    } else {
-        // At bottom - scroll up
+    if (this->cursorRowPosition == this->scrollBottom) {
+        // At bottom of scroll region - scroll up
         this->scroll(1);
+    } else if (this->cursorRowPosition + 1 < this->rowCount) {
+        ++this->cursorRowPosition;
     }
     this->cursorDirtyFlag = true;
 }
 
+void VirtualScreen::reverseLineFeed() {
+    if (this->cursorRowPosition == this->scrollTop) {
+        // At top of scroll region - scroll down
+        this->scroll(-1);
+    } else if (this->cursorRowPosition > 0) {
+        --this->cursorRowPosition;
+    }
+    this->cursorDirtyFlag = true;
+}
+
+void VirtualScreen::saveCursor() {
+    this->savedCursor = SavedCursor{this->cursorRowPosition, this->cursorColumnPosition, this->currentTextStyle};
+}
+
+void VirtualScreen::restoreCursor() {
+    SavedCursor cursor = this->savedCursor.value_or(SavedCursor{});
+    this->moveCursor(cursor.row, cursor.column);
+    this->setCurrentStyle(cursor.style);
+}
+
 // =============================================================================
 // Screen Manipulation
 // =============================================================================
 
 void VirtualScreen::clearLine(ClearLineMode mode) {
     Cell blank = this->blankCell();
+    size_t cursorEnd = std::min(this->cursorColumnPosition + 1, this->columnCount);
     
     switch (mode) {
         case ClearLineMode::ToEnd:
             // Clear from cursor to end of line
-            for (size_t col = this->cursorColumnPosition; col < this->columnCount; ++col) {
-                this->buffer(this->cursorRowPosition, col) = blank;
-            }
+            this->splitWideCells(this->cursorRowPosition, this->cursorColumnPosition, this->columnCount);
+            this->buffer.fillRowRange(this->cursorRowPosition, this->cursorColumnPosition, this->columnCount, blank);
+            this->markDirty(this->cursorRowPosition, this->cursorColumnPosition, this->columnCount);
             break;
             
         case ClearLineMode::ToStart:
             // Clear from start of line to cursor (inclusive)
-            for (size_t col = 0; col <= this->cursorColumnPosition; ++col) {
-                this->buffer(this->cursorRowPosition, col) = blank;
-            }
+            this->splitWideCells(this->cursorRowPosition, 0, cursorEnd);
+            this->buffer.fillRowRange(this->cursorRowPosition, 0, cursorEnd, blank);
+            this->markDirty(this->cursorRowPosition, 0, cursorEnd);
             break;
             
         case ClearLineMode::Entire:
             // Clear entire line
             this->buffer.fillRow(this->cursorRowPosition, blank);
+            this->markDirty(this->cursorRowPosition);
             break;
     }
-    
-    this->markDirty(this->cursorRowPosition);
 }
 
 void VirtualScreen::clearScreen(ClearScreenMode mode) {
     Cell blank = this->blankCell();
+    size_t cursorEnd = std::min(this->cursorColumnPosition + 1, this->columnCount);
     
     switch (mode) {
         case ClearScreenMode::ToEnd:
             // Clear from cursor to end of screen
             // First, clear rest of current line
-            for (size_t col = this->cursorColumnPosition; col < this->columnCount; ++col) {
-                this->buffer(this->cursorRowPosition, col) = blank;
-            }
-            this->markDirty(this->cursorRowPosition);
+            this->splitWideCells(this->cursorRowPosition, this->cursorColumnPosition, this->columnCount);
+            this->buffer.fillRowRange(this->cursorRowPosition, this->cursorColumnPosition, this->columnCount, blank);
+            this->markDirty(this->cursorRowPosition, this->cursorColumnPosition, this->columnCount);
             
             // Then clear all lines below
             for (size_t row = this->cursorRowPosition + 1; row < this->rowCount; ++row) {
@@ -148,66 +304,69 @@ void VirtualScreen::clearScreen(ClearScreenMode mode) {
             }
             
             // Then clear current line up to and including cursor
-            for (size_t col = 0; col <= this->cursorColumnPosition; ++col) {
-                this->buffer(this->cursorRowPosition, col) = blank;
-            }
-            this->markDirty(this->cursorRowPosition);
+            this->splitWideCells(this->cursorRowPosition, 0, cursorEnd);
+            this->buffer.fillRowRange(this->cursorRowPosition, 0, cursorEnd, blank);
+            this->markDirty(this->cursorRowPosition, 0, cursorEnd);
             break;
             
         case ClearScreenMode::Entire:
-            // Clear entire screen
+            // Clear entire screen (every row is resent, recorded scrolls are moot)
             this->buffer.fill(blank);
-            this->markAllDirty();
+            for (size_t row = 0; row < this->rowCount; ++row) {
+                this->markDirty(row);
+            }
+            this->scrollOperations.clear();
             break;
     }
 }
 
 void VirtualScreen::scroll(int lines) {
-    if (lines == 0) return;
-    
-    Cell blank = this->blankCell();
+    if (lines == 0 || this->rowCount == 0) return;
     
-    if (lines > 0) {
-        // Scroll up (content moves up, new blank lines at bottom)
-        size_t scrollAmount = std::min(static_cast<size_t>(lines), this->rowCount);
-        
+    if (lines > 0 && this->scrollTop == 0 && !this->alternateScreenActive) {
         // Capture rows that will be pushed off the top before overwriting
+        size_t scrollAmount = std::min(static_cast<size_t>(lines), this->scrollBottom + 1);
         for (size_t row = 0; row < scrollAmount; ++row) {
             this->scrolledOffRows.push_back(this->getRowSegments(row));
         }
-        
-        // Move lines up
-        for (size_t row = 0; row < this->rowCount - scrollAmount; ++row) {
-            for (size_t col = 0; col < this->columnCount; ++col) {
-                this->buffer(row, col) = this->buffer(row + scrollAmount, col);
-            }
-            this->markDirty(row);
-        }
-        
-        // Clear bottom lines
-        for (size_t row = this->rowCount - scrollAmount; row < this->rowCount; ++row) {
-            this->buffer.fillRow(row, blank);
-            this->markDirty(row);
-        }
-    } else {
-        // Scroll down (content moves down, new blank lines at top)
-        size_t scrollAmount = std::min(static_cast<size_t>(-lines), this->rowCount);
-        
-        // Move lines down (start from bottom)
-        for (size_t row = this->rowCount - 1; row >= scrollAmount; --row) {
-            for (size_t col = 0; col < this->columnCount; ++col) {
-                this->buffer(row, col) = this->buffer(row - scrollAmount, col);
-            }
-            this->markDirty(row);
-            if (row == 0) break; // Prevent underflow
-        }
-        
-        // Clear top lines
-        for (size_t row = 0; row < scrollAmount; ++row) {
-            this->buffer.fillRow(row, blank);
-            this->markDirty(row);
-        }
     }
+    
+    this->scrollRows(this->scrollTop, this->scrollBottom, lines);
+}
+
+void VirtualScreen::insertLines(size_t count) {
+    if (this->cursorRowPosition < this->scrollTop || this->cursorRowPosition > this->scrollBottom) {
+        return;
+    }
+    count = std::min(count, this->scrollBottom - this->cursorRowPosition + 1);
+    this->scrollRows(this->cursorRowPosition, this->scrollBottom, -static_cast<int>(count));
+    this->cursorColumnPosition = 0;
+    this->cursorDirtyFlag = true;
+}
+
+void VirtualScreen::deleteLines(size_t count) {
+    if (this->cursorRowPosition < this->scrollTop || this->cursorRowPosition > this->scrollBottom) {
+        return;
+    }
+    count = std::min(count, this->scrollBottom - this->cursorRowPosition + 1);
+    this->scrollRows(this->cursorRowPosition, this->scrollBottom, static_cast<int>(count));
+    this->cursorColumnPosition = 0;
+    this->cursorDirtyFlag = true;
+}
+
+void VirtualScreen::setScrollRegion(size_t top, size_t bottom) {
+    bottom = std::min(bottom, this->rowCount > 0 ? this->rowCount - 1 : 0);
+    if (top >= bottom) {
+        return;
+    }
+    this->scrollTop = top;
+    this->scrollBottom = bottom;
+    this->moveCursor(0, 0);
+}
+
+void VirtualScreen::resetScrollRegion() {
+    this->scrollTop = 0;
+    this->scrollBottom = this->rowCount > 0 ? this->rowCount - 1 : 0;
 }
 
 void VirtualScreen::resize(size_t rows, size_t columns) {
@@ -215,15 +374,42 @@ void VirtualScreen::resize(size_t rows, size_t columns) {
         return;
     }
     
-    this->buffer.resize(rows, columns, Cell::blank());
+    // The screen not shown is resized when it is switched to
+    resizeGrid(this->buffer, rows, columns);
     this->rowCount = rows;
     this->columnCount = columns;
+    this->resetScrollRegion();
+    this->resetDirtyTracking();
+    this->resetRowVersions();
     
     // Ensure cursor is in bounds
     this->ensureCursorInBounds();
     this->markAllDirty();
 }
 
+// =============================================================================
+// Alternate Screen
+// =============================================================================
+
+void VirtualScreen::enterAlternateScreen(bool clear) {
+    if (this->alternateScreenActive) {
+        return;
+    }
+    this->swapScreens();
+    this->alternateScreenActive = true;
+    if (clear) {
+        this->clearScreen(ClearScreenMode::Entire);
+    }
+}
+
+void VirtualScreen::exitAlternateScreen() {
+    if (!this->alternateScreenActive) {
+        return;
+    }
+    this->swapScreens();
+    this->alternateScreenActive = false;
+}
+
 // =============================================================================
 // Content Access
 // =============================================================================
@@ -232,25 +418,22 @@ const Cell& VirtualScreen::cellAt(size_t row, size_t column) const {
     return this->buffer.at(row, column);
 }
 
-// Helper: encode char32_t to UTF-8
-static void appendUtf8(std::string& result, char32_t ch) {
-    if (ch == 0) ch = U' ';
-    
-    if (ch < 128) {
-        result += static_cast<char>(ch);
-    } else if (ch < 0x800) {
-        result += static_cast<char>(0xC0 | (ch >> 6));
-        result += static_cast<char>(0x80 | (ch & 0x3F));
-    } else if (ch < 0x10000) {
-        result += static_cast<char>(0xE0 | (ch >> 12));
-        result += static_cast<char>(0x80 | ((ch >> 6) & 0x3F));
-        result += static_cast<char>(0x80 | (ch & 0x3F));
-    } else {
-        result += static_cast<char>(0xF0 | (ch >> 18));
-        result += static_cast<char>(0x80 | ((ch >> 12) & 0x3F));
-        result += static_cast<char>(0x80 | ((ch >> 6) & 0x3F));
-        result += static_cast<char>(0x80 | (ch & 0x3F));
+const TextStyle& VirtualScreen::styleAt(size_t row, size_t column) const {
+    return this->styleTable.style(this->buffer.at(row, column).styleId);
+}
+
+void VirtualScreen::appendCell(std::string& result, const Cell& cell) const {
+    if (cell.isSpacer()) {
+        return;
     }
+    if (GraphemeTable::isCluster(cell.character)) {
+        for (char32_t codepoint : this->graphemeTable.cluster(cell.character)) {
+            utf8::append(result, codepoint);
+        }
+        return;
+    }
+    // NUL written to a cell reads as a blank
+    utf8::append(result, cell.character == 0 ? U' ' : cell.character);
 }
 
 std::string VirtualScreen::getRowText(size_t row) const {
@@ -268,7 +451,7 @@ std::string VirtualScreen::getRowText(size_t row) const {
     
     // Build string up to last non-space
     for (size_t col = 0; col < lastNonSpace; ++col) {
-        appendUtf8(result, this->buffer(row, col).character);
+        this->appendCell(result, this->buffer(row, col));
     }
     
     return result;
@@ -280,52 +463,77 @@ std::vector<StyledSegment> VirtualScreen::getRowSegments(size_t row, bool trimTr
     if (row >= this->rowCount) {
         return segments;
     }
-    
-    // Find last non-space character if trimming
-    size_t endCol = this->columnCount;
     if (trimTrailingSpaces) {
-        endCol = 0;
-        for (size_t col = 0; col < this->columnCount; ++col) {
-            char32_t ch = this->buffer(row, col).character;
-            if (ch != U' ' && ch != 0) {
-                endCol = col + 1;
-            }
+        return this->rowSegments(row);
+    }
+    return this->getRowSegments(row, 0, this->columnCount);
+}
+
+const std::vector<StyledSegment>& VirtualScreen::rowSegments(size_t row) const {
+    RowCache& cache = this->rowCaches[row];
+    if (cache.segmentsVersion == this->rowVersions[row]) {
+        return cache.segments;
+    }
+    
+    // Find last non-space character
+    size_t endCol = 0;
+    for (size_t col = 0; col < this->columnCount; ++col) {
+        char32_t ch = this->buffer(row, col).character;
+        if (ch != U' ' && ch != 0) {
+            endCol = col + 1;
         }
     }
     
-    if (endCol == 0) {
+    cache.segments = this->getRowSegments(row, 0, endCol);
+    cache.segmentsVersion = this->rowVersions[row];
+    return cache.segments;
+}
+
+std::vector<StyledSegment> VirtualScreen::getRowSegments(size_t row, size_t startColumn, size_t endColumn) const {
+    std::vector<StyledSegment> segments;
+    endColumn = std::min(endColumn, this->columnCount);
+    if (row >= this->rowCount || startColumn >= endColumn) {
         return segments;
     }
     
-    // Group adjacent cells with same style
+    // Group adjacent cells with same style (interned ids are equal exactly when styles are)
     StyledSegment current;
-    current.style = this->buffer(row, 0).style;
+    StyleId currentId = this->buffer(row, startColumn).styleId;
     
-    for (size_t col = 0; col < endCol; ++col) {
+    for (size_t col = startColumn; col < endColumn; ++col) {
         const Cell& cell = this->buffer(row, col);
+        if (cell.isSpacer()) {
+            continue;
+        }
         
-        if (cell.style == current.style) {
-            // Same style - append to current segment
-            appendUtf8(current.text, cell.character);
-        } else {
+        if (cell.styleId != currentId) {
             // Style changed - save current and start new
             if (!current.text.empty()) {
+                current.style = this->styleTable.style(currentId);
                 segments.push_back(std::move(current));
             }
             current = StyledSegment{};
-            current.style = cell.style;
-            appendUtf8(current.text, cell.character);
+            currentId = cell.styleId;
         }
+        this->appendCell(current.text, cell);
     }
     
     // Don't forget last segment
     if (!current.text.empty()) {
+        current.style = this->styleTable.style(currentId);
         segments.push_back(std::move(current));
     }
     
     return segments;
 }
 
+bool VirtualScreen::hasOnlyNarrowCells(size_t row) const {
+    const Cell* cells = this->buffer.rowPointer(row);
+    return std::none_of(cells, cells + this->columnCount, [](const Cell& cell) {
+        return cell.flags != 0 || GraphemeTable::isCluster(cell.character);
+    });
+}
+
 std::string VirtualScreen::getContent(bool includeTrailingSpaces) const {
     std::string result;
     
@@ -356,14 +564,30 @@ std::string VirtualScreen::getContent(bool includeTrailingSpaces) const {
 // =============================================================================
 
 void VirtualScreen::clearDirtyRows() {
-    this->dirtyRowSet.clear();
+    std::fill(this->dirtyRowBits.begin(), this->dirtyRowBits.end(), 0);
+    this->dirtyRowTotal = 0;
+    this->scrollOperations.clear();
     this->cursorDirtyFlag = false;
 }
 
 void VirtualScreen::markAllDirty() {
     for (size_t row = 0; row < this->rowCount; ++row) {
-        this->dirtyRowSet.insert(row);
+        this->flagDirty(row, 0, this->columnCount);
     }
+    this->scrollOperations.clear();
+}
+
+std::vector<VirtualScreen::ScrollOperation> VirtualScreen::takeScrollOperations() {
+    auto result = std::move(this->scrollOperations);
+    this->scrollOperations.clear();
+    return result;
+}
+
+std::vector<size_t> VirtualScreen::dirtyRows() const {
+    std::vector<size_t> rows;
+    rows.reserve(this->dirtyRowTotal);
+    this->forEachDirtyRow([&rows](size_t row) { rows.push_back(row); });
+    return rows;
 }
 
 // =============================================================================
@@ -381,7 +605,160 @@ std::vector<std::vector<StyledSegment>> VirtualScreen::takeScrolledOffRows() {
 // =============================================================================
 
 void VirtualScreen::markDirty(size_t row) {
-    this->dirtyRowSet.insert(row);
+    this->markDirty(row, 0, this->columnCount);
+}
+
+void VirtualScreen::moveRowState(size_t fromRow, size_t toRow) {
+    // Version and cache go with the content; the overwritten row's version is gone for good,
+    // so the cache swapped into fromRow can never match again
+    this->rowVersions[toRow] = this->rowVersions[fromRow];
+    std::swap(this->rowCaches[toRow], this->rowCaches[fromRow]);
+    this->wideCellRows[toRow] = this->wideCellRows[fromRow];
+
+    bool fromDirty = this->isRowDirty(fromRow);
+    bool toDirty = this->isRowDirty(toRow);
+    uint64_t bit = uint64_t(1) << (toRow & 63);
+    if (fromDirty) {
+        this->dirtyRowBits[toRow >> 6] |= bit;
+        this->dirtyColumnRanges[toRow] = this->dirtyColumnRanges[fromRow];
+        this->dirtyRowTotal += toDirty ? 0 : 1;
+    } else if (toDirty) {
+        this->dirtyRowBits[toRow >> 6] &= ~bit;
+        --this->dirtyRowTotal;
+    }
+}
+
+void VirtualScreen::resetDirtyTracking() {
+    this->dirtyRowBits.assign((this->rowCount + 63) / 64, 0);
+    this->dirtyColumnRanges.assign(this->rowCount, DirtyColumns{});
+    this->dirtyRowTotal = 0;
+    this->resetWideCellRows();
+}
+
+void VirtualScreen::resetWideCellRows() {
+    // Clients get these rows whole next, so only current content counts
+    this->wideCellRows.resize(this->rowCount);
+    for (size_t row = 0; row < this->rowCount; ++row) {
+        this->markRowSentWhole(row);
+    }
+}
+
+void VirtualScreen::resetRowVersions() {
+    this->rowVersions.resize(this->rowCount);
+    for (auto& version : this->rowVersions) {
+        version = ++this->lastRowVersion;
+    }
+    this->rowCaches.assign(this->rowCount, RowCache{});
+}
+
+void VirtualScreen::swapScreens() {
+    this->fitInactiveScreen();
+    std::swap(this->buffer, this->inactiveScreen.buffer);
+    std::swap(this->rowVersions, this->inactiveScreen.rowVersions);
+    std::swap(this->rowCaches, this->inactiveScreen.rowCaches);
+    std::swap(this->savedCursor, this->inactiveScreen.savedCursor);
+    this->resetWideCellRows();
+    
+    // A region set by a full-screen application means nothing to the other screen
+    this->resetScrollRegion();
+    this->markAllDirty();
+    this->cursorDirtyFlag = true;
+}
+
+void VirtualScreen::fitInactiveScreen() {
+    // Allocated on first switch; resized here if the screen was resized while it was aside
+    InactiveScreen& inactive = this->inactiveScreen;
+    if (inactive.buffer.rows() == this->rowCount && inactive.buffer.columns() == this->columnCount &&
+        inactive.rowVersions.size() == this->rowCount) {
+        return;
+    }
+    resizeGrid(inactive.buffer, this->rowCount, this->columnCount);
+    inactive.rowVersions.resize(this->rowCount);
+    for (auto& version : inactive.rowVersions) {
+        version = ++this->lastRowVersion;
+    }
+    inactive.rowCaches.assign(this->rowCount, RowCache{});
+}
+
+void VirtualScreen::resizeGrid(Grid2D<Cell>& grid, size_t rows, size_t columns) {
+    grid.resize(rows, columns, Cell::blank());
+    
+    // Narrowing may have cut off the spacer of a double-width character in the last column
+    for (size_t row = 0; row < rows && columns > 0; ++row) {
+        Cell& last = grid(row, columns - 1);
+        if (last.isWide()) {
+            last = Cell{U' ', last.styleId};
+        }
+    }
+}
+
+void VirtualScreen::scrollRows(size_t top, size_t bottom, int lines) {
+    if (lines == 0 || top > bottom || bottom >= this->rowCount) return;
+    
+    size_t height = bottom - top + 1;
+    size_t scrollAmount = std::min(static_cast<size_t>(lines > 0 ? lines : -static_cast<long>(lines)), height);
+    size_t kept = height - scrollAmount;
+    Cell blank = this->blankCell();
+    bool wholeScreen = top == 0 && height == this->rowCount;
+    
+    if (lines > 0) {
+        // Scroll up (content moves up, new blank lines at bottom)
+        if (wholeScreen) {
+            // Rotate the row ring instead of moving cells
+            this->buffer.rotateRows(static_cast<long>(scrollAmount));
+        } else {
+            for (size_t row = top; row < top + kept; ++row) {
+                std::copy_n(this->buffer.rowPointer(row + scrollAmount), this->columnCount, this->buffer.rowPointer(row));
+            }
+        }
+        for (size_t row = top; row < top + kept; ++row) {
+            this->moveRowState(row + scrollAmount, row);
+        }
+        for (size_t row = top + kept; row <= bottom; ++row) {
+            this->buffer.fillRow(row, blank);
+            this->markDirty(row);
+        }
+    } else {
+        // Scroll down (content moves down, new blank lines at top)
+        if (wholeScreen) {
+            this->buffer.rotateRows(-static_cast<long>(scrollAmount));
+        } else {
+            for (size_t row = bottom + 1; row-- > top + scrollAmount;) {
+                std::copy_n(this->buffer.rowPointer(row - scrollAmount), this->columnCount, this->buffer.rowPointer(row));
+            }
+        }
+        for (size_t row = bottom + 1; row-- > top + scrollAmount;) {
+            this->moveRowState(row - scrollAmount, row);
+        }
+        for (size_t row = top; row < top + scrollAmount; ++row) {
+            this->buffer.fillRow(row, blank);
+            this->markDirty(row);
+        }
+    }
+    
+    // Dirty state moved along with the content: clients shift their rows the same way
+    int count = lines > 0 ? static_cast<int>(scrollAmount) : -static_cast<int>(scrollAmount);
+    this->recordScroll(ScrollOperation{top, bottom, count});
+}
+
+void VirtualScreen::recordScroll(const ScrollOperation& operation) {
+    if (!this->scrollOperations.empty()) {
+        ScrollOperation& last = this->scrollOperations.back();
+        if (last.top == operation.top && last.bottom == operation.bottom) {
+            // Consecutive scrolls of one region compose into a single shift (a full height clears it)
+            int height = static_cast<int>(last.bottom - last.top + 1);
+            last.count = std::clamp(last.count + operation.count, -height, height);
+            if (last.count == 0) {
+                this->scrollOperations.pop_back();
+            }
+            return;
+        }
+    }
+    if (this->scrollOperations.size() >= maxScrollOperations) {
+        this->markAllDirty();
+        return;
+    }
+    this->scrollOperations.push_back(operation);
 }
 
 void VirtualScreen::ensureCursorInBounds() {
@@ -399,7 +776,62 @@ void VirtualScreen::ensureCursorInBounds() {
 }
 
 Cell VirtualScreen::blankCell() const {
-    return Cell{U' ', this->currentTextStyle};
+    return Cell{U' ', this->currentStyleId};
+}
+
+StyleId VirtualScreen::internStyle(const TextStyle& style) {
+    if (this->styleTable.full()) {
+        this->compactStyles();
+    }
+    return this->styleTable.intern(style);
+}
+
+void VirtualScreen::compactStyles() {
+    // Keep styles still referenced by cells of either screen or the current style, renumber the rest
+    std::vector<bool> used(this->styleTable.size(), false);
+    used[this->currentStyleId] = true;
+    for (const Grid2D<Cell>* grid : {&this->buffer, &this->inactiveScreen.buffer}) {
+        for (const Cell& cell : *grid) {
+            used[cell.styleId] = true;
+        }
+    }
+    
+    std::vector<StyleId> remap = this->styleTable.compact(used);
+    for (Grid2D<Cell>* grid : {&this->buffer, &this->inactiveScreen.buffer}) {
+        for (Cell& cell : *grid) {
+            cell.styleId = remap[cell.styleId];
+        }
+    }
+    this->currentStyleId = remap[this->currentStyleId];
+}
+
+char32_t VirtualScreen::internCluster(std::u32string_view cluster) {
+    if (this->graphemeTable.full()) {
+        this->compactClusters();
+    }
+    return this->graphemeTable.intern(cluster);
+}
+
+void VirtualScreen::compactClusters() {
+    // Keep clusters still referenced by cells of either screen (the table also holds every
+    // prefix a cluster grew through)
+    std::vector<bool> used(this->graphemeTable.size(), false);
+    for (const Grid2D<Cell>* grid : {&this->buffer, &this->inactiveScreen.buffer}) {
+        for (const Cell& cell : *grid) {
+            if (GraphemeTable::isCluster(cell.character)) {
+                used[cell.character - GraphemeTable::firstId] = true;
+            }
+        }
+    }
+    
+    std::vector<char32_t> remap = this->graphemeTable.compact(used);
+    for (Grid2D<Cell>* grid : {&this->buffer, &this->inactiveScreen.buffer}) {
+        for (Cell& cell : *grid) {
+            if (GraphemeTable::isCluster(cell.character)) {
+                cell.character = remap[cell.character - GraphemeTable::firstId];
+            }
+        }
+    }
 }
 
 } // namespace termihui
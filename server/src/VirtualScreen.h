@@ -1,9 +1,15 @@
 #pragma once
 
+#include <termihui/grapheme_table.h>
 #include <termihui/grid2d.h>
+#include <termihui/style_table.h>
 #include <termihui/text_style.h>
+#include <termihui/unicode_width.h>
 #include <string>
-#include <set>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 #include <vector>
 
 namespace termihui {
@@ -13,6 +19,10 @@ namespace termihui {
  * 
  * Maintains a 2D grid of cells representing the terminal display.
  * Supports cursor movement, text insertion, and screen manipulation operations.
+ * Cells hold a style id; the styles themselves are interned in a per-screen StyleTable.
+ * Characters take as many cells as their Unicode width: double-width ones are followed by
+ * a spacer cell, combining marks and other cluster continuations join the previous cell
+ * (clusters are interned in a per-screen GraphemeTable).
  */
 class VirtualScreen {
 public:
@@ -34,6 +44,24 @@ public:
         Entire = 2      // Clear entire screen (ESC[2J)
     };
     
+    /**
+     * Damaged column range of a row, [begin, end)
+     */
+    struct DirtyColumns {
+        size_t begin = 0;
+        size_t end = 0;
+    };
+    
+    /**
+     * Scroll recorded for clients: rows [top, bottom] moved up by count (down if negative)
+     * Rows that scroll in are blank and reported dirty.
+     */
+    struct ScrollOperation {
+        size_t top = 0;
+        size_t bottom = 0;
+        int count = 0;
+    };
+    
     /**
      * Construct screen with given dimensions
      * @param rows Number of rows
@@ -51,7 +79,8 @@ public:
     // =========================================================================
     
     /**
-     * Write character at cursor position and advance cursor
+     * Write character at cursor position and advance cursor by its width
+     * A character continuing the grapheme cluster just written joins that cell instead.
      * @param character Character to write
      */
     void putCharacter(char32_t character);
@@ -63,6 +92,19 @@ public:
      */
     void putCharacter(char32_t character, const TextStyle& style);
     
+    /**
+     * Write run of printable characters with current style, wrapping like putCharacter
+     * Each row touched is written in one pass and marked dirty once.
+     * @param text Characters to write
+     */
+    void putString(std::u32string_view text);
+    
+    /**
+     * Write run of printable ASCII characters (0x20..0x7E) with current style
+     * @param asciiText Characters to write
+     */
+    void putString(std::string_view asciiText);
+    
     /**
      * Set current text style for subsequent characters
      * @param style Text style to use
@@ -103,10 +145,26 @@ public:
     void carriageReturn();
     
     /**
-     * Move cursor to next line, scrolling if at bottom
+     * Move cursor to next line, scrolling if at bottom of scroll region
      */
     void lineFeed();
     
+    /**
+     * Move cursor to previous line, scrolling down if at top of scroll region
+     */
+    void reverseLineFeed();
+    
+    /**
+     * Save cursor position and current style (DECSC); each screen has its own saved cursor
+     */
+    void saveCursor();
+    
+    /**
+     * Restore cursor position and style saved by saveCursor() (DECRC)
+     * Without a saved cursor the cursor goes home and the style is reset.
+     */
+    void restoreCursor();
+    
     /**
      * Get current cursor row
      */
@@ -134,11 +192,45 @@ public:
     void clearScreen(ClearScreenMode mode);
     
     /**
-     * Scroll screen content
+     * Scroll content of the scroll region
      * @param lines Number of lines to scroll (positive = up, negative = down)
      */
     void scroll(int lines);
     
+    /**
+     * Insert blank lines at cursor row, pushing the rows below down within the scroll region
+     * @param count Number of lines to insert
+     */
+    void insertLines(size_t count);
+    
+    /**
+     * Delete lines at cursor row, pulling the rows below up within the scroll region
+     * @param count Number of lines to delete
+     */
+    void deleteLines(size_t count);
+    
+    /**
+     * Set scroll region (DECSTBM) and move cursor home; invalid regions are ignored
+     * @param top First row of region (0-indexed)
+     * @param bottom Last row of region (0-indexed, inclusive)
+     */
+    void setScrollRegion(size_t top, size_t bottom);
+    
+    /**
+     * Make the whole screen the scroll region
+     */
+    void resetScrollRegion();
+    
+    /**
+     * Get first row of scroll region
+     */
+    size_t scrollRegionTop() const { return this->scrollTop; }
+    
+    /**
+     * Get last row of scroll region (inclusive)
+     */
+    size_t scrollRegionBottom() const { return this->scrollBottom; }
+    
     /**
      * Resize screen
      * @param rows New number of rows
@@ -146,6 +238,28 @@ public:
      */
     void resize(size_t rows, size_t columns);
     
+    // =========================================================================
+    // Alternate Screen
+    // =========================================================================
+    
+    /**
+     * Show the alternate screen (full-screen applications), keeping the primary one aside
+     * Both are swapped as a whole, with their row versions and caches: O(1), nothing is copied.
+     * @param clear Clear the alternate screen before showing it
+     */
+    void enterAlternateScreen(bool clear);
+    
+    /**
+     * Show the primary screen again, as it was when the alternate screen was entered
+     * Every row is marked dirty; their cached encodings are still valid.
+     */
+    void exitAlternateScreen();
+    
+    /**
+     * Check if the alternate screen is shown
+     */
+    bool isAlternateScreen() const { return this->alternateScreenActive; }
+    
     // =========================================================================
     // Content Access
     // =========================================================================
@@ -157,6 +271,23 @@ public:
      */
     const Cell& cellAt(size_t row, size_t column) const;
     
+    /**
+     * Get style of cell at position
+     * @param row Row (0-indexed)
+     * @param column Column (0-indexed)
+     */
+    const TextStyle& styleAt(size_t row, size_t column) const;
+    
+    /**
+     * Get style by id stored in a cell
+     */
+    const TextStyle& style(StyleId styleId) const { return this->styleTable.style(styleId); }
+    
+    /**
+     * Get number of distinct styles currently interned
+     */
+    size_t styleCount() const { return this->styleTable.size(); }
+    
     /**
      * Get row content as string (without trailing spaces)
      * @param row Row index
@@ -170,6 +301,67 @@ public:
      */
     std::vector<StyledSegment> getRowSegments(size_t row, bool trimTrailingSpaces = true) const;
     
+    /**
+     * Get row as styled segments with trailing spaces trimmed, cached until the row changes
+     * @param row Row index (must be on screen)
+     */
+    const std::vector<StyledSegment>& rowSegments(size_t row) const;
+    
+    /**
+     * Get encoding of rowSegments(row), cached until the row changes
+     *
+     * The cache has one slot per row, so a screen must always be encoded the same way.
+     * @param row Row index (must be on screen)
+     * @param encode Function std::string(const std::vector<StyledSegment>&), called on cache miss only
+     */
+    template<typename Encoder>
+    const std::string& encodedRow(size_t row, Encoder&& encode) const {
+        RowCache& cache = this->rowCaches[row];
+        if (cache.encodedVersion != this->rowVersions[row]) {
+            cache.encoded = encode(this->rowSegments(row));
+            cache.encodedVersion = this->rowVersions[row];
+        }
+        return cache.encoded;
+    }
+    
+    /**
+     * Get version of row content
+     *
+     * Changes whenever a cell of the row is written and moves along with the row when it
+     * scrolls, so equal versions mean equal content. Never reused within a screen.
+     */
+    uint64_t rowVersion(size_t row) const { return this->rowVersions[row]; }
+    
+    /**
+     * Get cells [startColumn, endColumn) of row as styled segments, without trimming
+     * @param row Row index
+     * @param startColumn First column
+     * @param endColumn Column after the last one (clamped to screen width)
+     */
+    std::vector<StyledSegment> getRowSegments(size_t row, size_t startColumn, size_t endColumn) const;
+    
+    /**
+     * Check if every cell of row holds one codepoint of width 1 (cells and codepoints map 1:1)
+     * @param row Row index
+     */
+    bool hasOnlyNarrowCells(size_t row) const;
+    
+    /**
+     * Check if row held a wide character or cluster since it was last sent whole
+     *
+     * A client's copy of such a row may not map cells to codepoints 1:1 even when the row
+     * does now, so it can only be updated whole.
+     * @param row Row index
+     */
+    bool heldWideCells(size_t row) const { return this->wideCellRows[row] != 0; }
+    
+    /**
+     * Note that clients received row whole: from now on it counts as holding wide cells
+     * only if it still does
+     * @param row Row index
+     */
+    void markRowSentWhole(size_t row) { this->wideCellRows[row] = !this->hasOnlyNarrowCells(row); }
+    
     /**
      * Get entire screen content as string
      * @param includeTrailingSpaces Whether to include trailing spaces on each line
@@ -187,9 +379,45 @@ public:
     // =========================================================================
     
     /**
-     * Get set of rows that have been modified since last call to clearDirtyRows()
+     * Check if any row has been modified since last call to clearDirtyRows()
+     */
+    bool hasDirtyRows() const { return this->dirtyRowTotal != 0; }
+    
+    /**
+     * Get number of rows modified since last call to clearDirtyRows()
+     */
+    size_t dirtyRowCount() const { return this->dirtyRowTotal; }
+    
+    /**
+     * Check if row has been modified since last call to clearDirtyRows()
+     */
+    bool isRowDirty(size_t row) const {
+        return (this->dirtyRowBits[row >> 6] >> (row & 63)) & 1;
+    }
+    
+    /**
+     * Get damaged column range of a dirty row (meaningless for clean rows)
      */
-    const std::set<size_t>& dirtyRows() const { return this->dirtyRowSet; }
+    DirtyColumns dirtyColumns(size_t row) const { return this->dirtyColumnRanges[row]; }
+    
+    /**
+     * Call function with index of each dirty row, in ascending order
+     */
+    template<typename Function>
+    void forEachDirtyRow(Function&& function) const {
+        for (size_t word = 0; word < this->dirtyRowBits.size(); ++word) {
+            uint64_t bits = this->dirtyRowBits[word];
+            while (bits != 0) {
+                function(word * 64 + static_cast<size_t>(__builtin_ctzll(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+    
+    /**
+     * Get rows modified since last call to clearDirtyRows(), in ascending order
+     */
+    std::vector<size_t> dirtyRows() const;
     
     /**
      * Check if cursor position has changed since last clearDirtyRows()
@@ -197,15 +425,28 @@ public:
     bool isCursorDirty() const { return this->cursorDirtyFlag; }
     
     /**
-     * Clear the dirty rows set and cursor dirty flag
+     * Clear dirty rows, recorded scrolls and cursor dirty flag
      */
     void clearDirtyRows();
     
     /**
-     * Mark all rows as dirty
+     * Mark all rows as dirty (recorded scrolls are dropped: every row is resent anyway)
      */
     void markAllDirty();
     
+    /**
+     * Check if scrolls were recorded since last call to clearDirtyRows()
+     */
+    bool hasScrollOperations() const { return !this->scrollOperations.empty(); }
+    
+    /**
+     * Get scrolls recorded since last call to clearDirtyRows(), oldest first, and forget them
+     *
+     * Dirty rows are tracked relative to the scrolled content: a client that applies these
+     * scrolls and then the dirty rows ends up with the current screen.
+     */
+    std::vector<ScrollOperation> takeScrollOperations();
+    
     // =========================================================================
     // Scroll-off Capture
     // =========================================================================
@@ -225,19 +466,121 @@ public:
     bool hasScrolledOffRows() const { return !this->scrolledOffRows.empty(); }
 
 private:
+    /**
+     * Segmentation and encoding of a row, each valid while its version is the row's
+     */
+    struct RowCache {
+        uint64_t segmentsVersion = 0;
+        uint64_t encodedVersion = 0;
+        std::vector<StyledSegment> segments;
+        std::string encoded;
+    };
+    
+    /**
+     * Cursor saved by DECSC
+     */
+    struct SavedCursor {
+        size_t row = 0;
+        size_t column = 0;
+        TextStyle style;
+    };
+    
+    /**
+     * Screen not shown: grid and per-row state, swapped with the shown one as a whole
+     */
+    struct InactiveScreen {
+        Grid2D<Cell> buffer;
+        std::vector<uint64_t> rowVersions;
+        std::vector<RowCache> rowCaches;
+        std::optional<SavedCursor> savedCursor;
+    };
+    
     Grid2D<Cell> buffer;
     size_t rowCount;
     size_t columnCount;
     size_t cursorRowPosition = 0;
     size_t cursorColumnPosition = 0;
+    size_t scrollTop = 0;
+    size_t scrollBottom = 0;
     TextStyle currentTextStyle;
-    std::set<size_t> dirtyRowSet;
+    StyleTable styleTable;
+    StyleId currentStyleId = StyleTable::defaultStyleId;
+    GraphemeTable graphemeTable;
+    unicode::GraphemeSegmenter graphemeSegmenter;
+    // Cell last written to, valid while its row keeps the version it had then
+    size_t lastCellRow = 0;
+    size_t lastCellColumn = 0;
+    uint64_t lastCellVersion = 0;
+    std::vector<uint64_t> dirtyRowBits;
+    std::vector<DirtyColumns> dirtyColumnRanges;
+    size_t dirtyRowTotal = 0;
     bool cursorDirtyFlag = false;
+    std::vector<ScrollOperation> scrollOperations;
     std::vector<std::vector<StyledSegment>> scrolledOffRows;
+    std::vector<uint64_t> rowVersions;
+    uint64_t lastRowVersion = 0;
+    // Rows that held a wide character or cluster since they were last sent whole
+    std::vector<uint8_t> wideCellRows;
+    mutable std::vector<RowCache> rowCaches;
+    std::optional<SavedCursor> savedCursor;
+    InactiveScreen inactiveScreen;
+    bool alternateScreenActive = false;
+    
+    // Beyond this many distinct scrolls per frame resending every row is cheaper
+    static constexpr size_t maxScrollOperations = 16;
+    
+    // Codepoints beyond this in one cell (e.g. stacked combining marks) are dropped
+    static constexpr size_t maxClusterLength = 32;
+    
+    /**
+     * Mark columns [begin, end) of row as damaged: one bit test, no allocation
+     * The row gets a new version, dropping its cached segments.
+     */
+    void markDirty(size_t row, size_t begin, size_t end) {
+        this->rowVersions[row] = ++this->lastRowVersion;
+        this->flagDirty(row, begin, end);
+    }
     
+    /**
+     * Mark columns [begin, end) of row for resending without a content change
+     */
+    void flagDirty(size_t row, size_t begin, size_t end) {
+        uint64_t& word = this->dirtyRowBits[row >> 6];
+        uint64_t bit = uint64_t(1) << (row & 63);
+        DirtyColumns& columns = this->dirtyColumnRanges[row];
+        if (!(word & bit)) {
+            word |= bit;
+            ++this->dirtyRowTotal;
+            columns = DirtyColumns{begin, end};
+        } else {
+            columns.begin = std::min(columns.begin, begin);
+            columns.end = std::max(columns.end, end);
+        }
+    }
     void markDirty(size_t row);
+    void moveRowState(size_t fromRow, size_t toRow);
+    void resetDirtyTracking();
+    void resetRowVersions();
+    void resetWideCellRows();
+    void swapScreens();
+    void fitInactiveScreen();
+    static void resizeGrid(Grid2D<Cell>& grid, size_t rows, size_t columns);
+    void scrollRows(size_t top, size_t bottom, int lines);
+    void recordScroll(const ScrollOperation& operation);
+    void putCodepoint(char32_t character, StyleId styleId);
+    void putCell(Cell cell, size_t width);
+    template<typename CharT>
+    void putRun(std::basic_string_view<CharT> text);
+    bool canExtendLastCell() const;
+    void extendLastCell(char32_t character);
+    void splitWideCells(size_t row, size_t begin, size_t end);
+    void appendCell(std::string& result, const Cell& cell) const;
     void ensureCursorInBounds();
     Cell blankCell() const;
+    StyleId internStyle(const TextStyle& style);
+    void compactStyles();
+    char32_t internCluster(std::u32string_view cluster);
+    void compactClusters();
 };
 
 } // namespace termihui
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * DEC-compatible (VT500) escape sequence parser state machine
+ *
+ * Follows Paul Williams' model of the DEC parser (vt100.net/emu/dec_ansi_parser) with the
+ * adjustments xterm makes for a UTF-8 stream:
+ * - Bytes 0x80..0xFF in Ground are printable (UTF-8); a lone C1 byte there is resolved by the
+ *   processor, since it can only be told apart from a continuation byte with decoder state
+ * - Bytes 0x80..0xFF inside OSC / DCS strings are payload, not C1 controls
+ * - BEL terminates an OSC string, ':' is a parameter separator
+ *
+ * The whole machine is one constexpr table: every byte costs a single lookup that yields
+ * the action to perform and the next state.
+ */
+namespace termihui::vt {
+
+enum class State : uint8_t {
+    Ground,
+    Escape,
+    EscapeIntermediate,
+    CsiEntry,
+    CsiParam,
+    CsiIntermediate,
+    CsiIgnore,
+    DcsEntry,
+    DcsParam,
+    DcsIntermediate,
+    DcsPassthrough,
+    DcsIgnore,
+    OscString,
+    SosPmApcString
+};
+
+inline constexpr size_t stateCount = 14;
+
+enum class Action : uint8_t {
+    None,
+    Print,       // Ground: printable byte or part of a UTF-8 sequence
+    Execute,     // C0 control
+    Clear,       // Forget parameters and intermediates
+    Collect,     // Intermediate or private marker byte
+    Param,       // Parameter digit or separator
+    EscDispatch,
+    CsiDispatch,
+    Hook,        // DCS final byte seen
+    Put,         // DCS payload byte
+    Unhook,      // DCS string ended
+    OscStart,
+    OscPut,
+    OscEnd,
+    C1Control    // 8-bit C1 control outside Ground: equivalent to ESC + (byte - 0x40)
+};
+
+/**
+ * Table entry: action in low nibble, next state in high nibble (stay = no transition)
+ */
+using TransitionEntry = uint8_t;
+using TransitionTable = std::array<std::array<TransitionEntry, 256>, stateCount>;
+
+inline constexpr uint8_t stay = 0x0F;
+
+constexpr TransitionEntry makeEntry(Action action, uint8_t next = stay) {
+    return static_cast<TransitionEntry>(static_cast<uint8_t>(action) | (next << 4));
+}
+
+constexpr TransitionEntry makeEntry(Action action, State next) {
+    return makeEntry(action, static_cast<uint8_t>(next));
+}
+
+constexpr Action entryAction(TransitionEntry entry) {
+    return static_cast<Action>(entry & 0x0F);
+}
+
+constexpr uint8_t entryNextState(TransitionEntry entry) {
+    return static_cast<uint8_t>(entry >> 4);
+}
+
+namespace detail {
+
+constexpr void setRange(TransitionTable& table, State state, int first, int last, TransitionEntry entry) {
+    for (int byte = first; byte <= last; ++byte) {
+        table[static_cast<size_t>(state)][static_cast<size_t>(byte)] = entry;
+    }
+}
+
+/**
+ * C0 controls other than CAN, SUB and ESC (those are handled as "anywhere" transitions)
+ */
+constexpr void setC0(TransitionTable& table, State state, TransitionEntry entry) {
+    setRange(table, state, 0x00, 0x17, entry);
+    setRange(table, state, 0x19, 0x19, entry);
+    setRange(table, state, 0x1C, 0x1F, entry);
+}
+
+constexpr TransitionTable buildTransitionTable() {
+    TransitionTable table{};
+    const auto none = makeEntry(Action::None);
+
+    // Ground
+    setC0(table, State::Ground, makeEntry(Action::Execute));
+    setRange(table, State::Ground, 0x20, 0x7E, makeEntry(Action::Print));
+    setRange(table, State::Ground, 0x7F, 0x7F, none);
+    setRange(table, State::Ground, 0x80, 0xFF, makeEntry(Action::Print));
+
+    // Escape
+    setC0(table, State::Escape, makeEntry(Action::Execute));
+    setRange(table, State::Escape, 0x20, 0x2F, makeEntry(Action::Collect, State::EscapeIntermediate));
+    setRange(table, State::Escape, 0x30, 0x7E, makeEntry(Action::EscDispatch, State::Ground));
+    setRange(table, State::Escape, 0x50, 0x50, makeEntry(Action::None, State::DcsEntry));
+    setRange(table, State::Escape, 0x58, 0x58, makeEntry(Action::None, State::SosPmApcString));
+    setRange(table, State::Escape, 0x5B, 0x5B, makeEntry(Action::None, State::CsiEntry));
+    setRange(table, State::Escape, 0x5D, 0x5D, makeEntry(Action::None, State::OscString));
+    setRange(table, State::Escape, 0x5E, 0x5F, makeEntry(Action::None, State::SosPmApcString));
+    setRange(table, State::Escape, 0x7F, 0x7F, none);
+
+    // Escape intermediate
+    setC0(table, State::EscapeIntermediate, makeEntry(Action::Execute));
+    setRange(table, State::EscapeIntermediate, 0x20, 0x2F, makeEntry(Action::Collect));
+    setRange(table, State::EscapeIntermediate, 0x30, 0x7E, makeEntry(Action::EscDispatch, State::Ground));
+    setRange(table, State::EscapeIntermediate, 0x7F, 0x7F, none);
+
+    // CSI entry
+    setC0(table, State::CsiEntry, makeEntry(Action::Execute));
+    setRange(table, State::CsiEntry, 0x20, 0x2F, makeEntry(Action::Collect, State::CsiIntermediate));
+    setRange(table, State::CsiEntry, 0x30, 0x3B, makeEntry(Action::Param, State::CsiParam));
+    setRange(table, State::CsiEntry, 0x3C, 0x3F, makeEntry(Action::Collect, State::CsiParam));
+    setRange(table, State::CsiEntry, 0x40, 0x7E, makeEntry(Action::CsiDispatch, State::Ground));
+    setRange(table, State::CsiEntry, 0x7F, 0x7F, none);
+
+    // CSI param
+    setC0(table, State::CsiParam, makeEntry(Action::Execute));
+    setRange(table, State::CsiParam, 0x20, 0x2F, makeEntry(Action::Collect, State::CsiIntermediate));
+    setRange(table, State::CsiParam, 0x30, 0x3B, makeEntry(Action::Param));
+    setRange(table, State::CsiParam, 0x3C, 0x3F, makeEntry(Action::None, State::CsiIgnore));
+    setRange(table, State::CsiParam, 0x40, 0x7E, makeEntry(Action::CsiDispatch, State::Ground));
+    setRange(table, State::CsiParam, 0x7F, 0x7F, none);
+
+    // CSI intermediate
+    setC0(table, State::CsiIntermediate, makeEntry(Action::Execute));
+    setRange(table, State::CsiIntermediate, 0x20, 0x2F, makeEntry(Action::Collect));
+    setRange(table, State::CsiIntermediate, 0x30, 0x3F, makeEntry(Action::None, State::CsiIgnore));
+    setRange(table, State::CsiIntermediate, 0x40, 0x7E, makeEntry(Action::CsiDispatch, State::Ground));
+    setRange(table, State::CsiIntermediate, 0x7F, 0x7F, none);
+
+    // CSI ignore: consume the malformed sequence up to its final byte
+    setC0(table, State::CsiIgnore, makeEntry(Action::Execute));
+    setRange(table, State::CsiIgnore, 0x20, 0x3F, none);
+    setRange(table, State::CsiIgnore, 0x40, 0x7E, makeEntry(Action::None, State::Ground));
+    setRange(table, State::CsiIgnore, 0x7F, 0x7F, none);
+
+    // DCS entry
+    setC0(table, State::DcsEntry, none);
+    setRange(table, State::DcsEntry, 0x20, 0x2F, makeEntry(Action::Collect, State::DcsIntermediate));
+    setRange(table, State::DcsEntry, 0x30, 0x3B, makeEntry(Action::Param, State::DcsParam));
+    setRange(table, State::DcsEntry, 0x3C, 0x3F, makeEntry(Action::Collect, State::DcsParam));
+    setRange(table, State::DcsEntry, 0x40, 0x7E, makeEntry(Action::None, State::DcsPassthrough));
+    setRange(table, State::DcsEntry, 0x7F, 0x7F, none);
+
+    // DCS param
+    setC0(table, State::DcsParam, none);
+    setRange(table, State::DcsParam, 0x20, 0x2F, makeEntry(Action::Collect, State::DcsIntermediate));
+    setRange(table, State::DcsParam, 0x30, 0x3B, makeEntry(Action::Param));
+    setRange(table, State::DcsParam, 0x3C, 0x3F, makeEntry(Action::None, State::DcsIgnore));
+    setRange(table, State::DcsParam, 0x40, 0x7E, makeEntry(Action::None, State::DcsPassthrough));
+    setRange(table, State::DcsParam, 0x7F, 0x7F, none);
+
+    // DCS intermediate
+    setC0(table, State::DcsIntermediate, none);
+    setRange(table, State::DcsIntermediate, 0x20, 0x2F, makeEntry(Action::Collect));
+    setRange(table, State::DcsIntermediate, 0x30, 0x3F, makeEntry(Action::None, State::DcsIgnore));
+    setRange(table, State::DcsIntermediate, 0x40, 0x7E, makeEntry(Action::None, State::DcsPassthrough));
+    setRange(table, State::DcsIntermediate, 0x7F, 0x7F, none);
+
+    // DCS passthrough: payload until ST
+    setC0(table, State::DcsPassthrough, makeEntry(Action::Put));
+    setRange(table, State::DcsPassthrough, 0x20, 0x7E, makeEntry(Action::Put));
+    setRange(table, State::DcsPassthrough, 0x7F, 0x7F, none);
+    setRange(table, State::DcsPassthrough, 0x80, 0xFF, makeEntry(Action::Put));
+
+    // DCS ignore, SOS/PM/APC: everything is swallowed until ST
+    setRange(table, State::DcsIgnore, 0x00, 0xFF, none);
+    setRange(table, State::SosPmApcString, 0x00, 0xFF, none);
+
+    // OSC string
+    setC0(table, State::OscString, none);
+    setRange(table, State::OscString, 0x07, 0x07, makeEntry(Action::None, State::Ground));
+    setRange(table, State::OscString, 0x20, 0xFF, makeEntry(Action::OscPut));
+
+    // Sequence states: C1 controls act from anywhere, GR bytes are treated as their GL equivalents
+    for (auto state : {State::Escape, State::EscapeIntermediate, State::CsiEntry, State::CsiParam,
+                       State::CsiIntermediate, State::CsiIgnore, State::DcsEntry, State::DcsParam,
+                       State::DcsIntermediate}) {
+        auto& row = table[static_cast<size_t>(state)];
+        setRange(table, state, 0x80, 0x9F, makeEntry(Action::C1Control));
+        for (size_t byte = 0xA0; byte <= 0xFF; ++byte) {
+            row[byte] = row[byte - 0x80];
+        }
+    }
+
+    // Anywhere: CAN and SUB abort the sequence, ESC starts a new one
+    for (size_t state = 0; state < stateCount; ++state) {
+        table[state][0x18] = makeEntry(Action::Execute, State::Ground);
+        table[state][0x1A] = makeEntry(Action::Execute, State::Ground);
+        table[state][0x1B] = makeEntry(Action::None, State::Escape);
+    }
+
+    return table;
+}
+
+} // namespace detail
+
+inline constexpr TransitionTable transitionTable = detail::buildTransitionTable();
+
+/**
+ * Action performed when a state is entered
+ */
+constexpr Action onEntry(State state) {
+    switch (state) {
+        case State::Escape:
+        case State::CsiEntry:
+        case State::DcsEntry:
+            return Action::Clear;
+        case State::DcsPassthrough:
+            return Action::Hook;
+        case State::OscString:
+            return Action::OscStart;
+        default:
+            return Action::None;
+    }
+}
+
+/**
+ * Action performed when a state is left
+ */
+constexpr Action onExit(State state) {
+    switch (state) {
+        case State::DcsPassthrough:
+            return Action::Unhook;
+        case State::OscString:
+            return Action::OscEnd;
+        default:
+            return Action::None;
+    }
+}
+
+static_assert(stateCount == static_cast<size_t>(State::SosPmApcString) + 1);
+static_assert(stateCount < stay, "state must fit into the high nibble next to the stay marker");
+static_assert(entryAction(transitionTable[static_cast<size_t>(State::Ground)]['A']) == Action::Print);
+static_assert(entryNextState(transitionTable[static_cast<size_t>(State::Escape)]['[']) ==
+              static_cast<uint8_t>(State::CsiEntry));
+static_assert(entryNextState(transitionTable[static_cast<size_t>(State::OscString)][0x1B]) ==
+              static_cast<uint8_t>(State::Escape));
+
+} // namespace termihui::vt
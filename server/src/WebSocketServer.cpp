@@ -1,13 +1,41 @@
 #include "WebSocketServerImpl.h"
+#include "Logger.h"
 #include <iostream>
 #include <cstring>
-#include <fmt/core.h>
 
 // libhv headers included via WebSocketServer.h
 
-WebSocketServerImpl::WebSocketServerImpl(int port, std::string bindAddress)
+namespace {
+
+/**
+ * libhv channel as outbound connection
+ */
+class ChannelConnection : public OutboundDispatcher::Connection {
+public:
+    explicit ChannelConnection(WebSocketChannelPtr channel)
+        : channel(std::move(channel))
+    {
+    }
+
+    size_t pendingBytes() const override {
+        return this->channel->writeBufsize();
+    }
+
+    bool write(const OutboundDispatcher::SharedFrame& frame) override {
+        // Whole frame in one write: libhv serializes writes per channel, so frames never interleave
+        return this->channel->write(frame->data(), static_cast<int>(frame->size())) >= 0;
+    }
+
+private:
+    WebSocketChannelPtr channel;
+};
+
+} // anonymous namespace
+
+WebSocketServerImpl::WebSocketServerImpl(int port, std::string bindAddress, size_t outboundBudget)
     : port(port)
     , bindAddress(std::move(bindAddress))
+    , outboundDispatcher(outboundBudget)
 {
 }
 
@@ -44,15 +72,15 @@ bool WebSocketServerImpl::start()
         
         // Start server in separate thread
         this->serverThread = std::make_unique<std::thread>([this]() {
-            fmt::print("Starting WebSocket server on {}:{}\n", this->bindAddress, this->port);
+            LOG_INFO(LogCategory::Ws, "Starting WebSocket server on {}:{}", this->bindAddress, this->port);
             this->wsServer.run(false); // false = don't block thread
         });
         
-        fmt::print("WebSocket server started on {}:{}\n", this->bindAddress, this->port);
+        LOG_INFO(LogCategory::Ws, "WebSocket server started on {}:{}", this->bindAddress, this->port);
         return true;
         
     } catch (const std::exception& e) {
-        fmt::print(stderr, "WebSocket server start error: {}\n", e.what());
+        LOG_ERROR(LogCategory::Ws, "WebSocket server start error: {}", e.what());
         this->running = false;
         return false;
     }
@@ -67,11 +95,11 @@ void WebSocketServerImpl::stop()
     // Close all connections
     {
         std::lock_guard<std::mutex> lock(this->clientsMutex);
-        for (auto& [clientId, channel] : this->clients) {
+        for (auto& [channel, clientId] : this->channelToClientId) {
             try {
                 channel->close();
             } catch (const std::exception& e) {
-                fmt::print(stderr, "Connection {} close error: {}\n", clientId, e.what());
+                LOG_ERROR(LogCategory::Ws, "Connection {} close error: {}", clientId, e.what());
             }
         }
         this->clients.clear();
@@ -90,8 +118,9 @@ void WebSocketServerImpl::stop()
     this->incomingQueue.clear();
     this->connectionEventsQueue.clear();
     this->outgoingQueue.clear();
+    this->outboundDispatcher.clear();
     
-    fmt::print("WebSocket server stopped\n");
+    LOG_INFO(LogCategory::Ws, "WebSocket server stopped");
 }
 
 bool WebSocketServerImpl::isRunning() const
@@ -103,6 +132,9 @@ WebSocketServerImpl::UpdateResult WebSocketServerImpl::update()
 {
     UpdateResult result;
     
+    // Reset before taking queues: anything pushed after this point wakes the loop again
+    this->wakeupPending.store(false);
+    
     // Get all incoming messages
     result.incomingMessages = this->incomingQueue.takeAll();
     
@@ -110,19 +142,61 @@ WebSocketServerImpl::UpdateResult WebSocketServerImpl::update()
     result.connectionEvents = this->connectionEventsQueue.takeAll();
     
     // Process outgoing messages
-    this->processOutgoingMessages();
+    this->processOutgoingMessages(result.resyncRequests);
     
     return result;
 }
 
-void WebSocketServerImpl::sendMessage(int clientId, const std::string& message)
+void WebSocketServerImpl::sendMessage(int clientId, std::string message)
 {
-    this->outgoingQueue.push({clientId, message});
+    this->outgoingQueue.push({clientId, std::move(message)});
+    this->requestWakeup();
 }
 
-void WebSocketServerImpl::broadcastMessage(const std::string& message)
+void WebSocketServerImpl::broadcastMessage(std::string message)
 {
-    this->outgoingQueue.push({0, message}); // 0 = broadcast to all
+    this->outgoingQueue.push({0, std::move(message)}); // 0 = broadcast to all
+    this->requestWakeup();
+}
+
+void WebSocketServerImpl::sendSessionMessage(int clientId, uint64_t sessionId, MessageClass messageClass, std::string message)
+{
+    this->outgoingQueue.push({clientId, std::move(message), messageClass, sessionId});
+    this->requestWakeup();
+}
+
+void WebSocketServerImpl::broadcastSessionMessage(uint64_t sessionId, MessageClass messageClass, std::string message)
+{
+    this->outgoingQueue.push({0, std::move(message), messageClass, sessionId});
+    this->requestWakeup();
+}
+
+void WebSocketServerImpl::subscribe(int clientId, uint64_t sessionId)
+{
+    this->outboundDispatcher.subscribe(clientId, sessionId);
+}
+
+void WebSocketServerImpl::unsubscribe(int clientId, uint64_t sessionId)
+{
+    this->outboundDispatcher.unsubscribe(clientId, sessionId);
+}
+
+WebSocketServer::OutboundStats WebSocketServerImpl::getOutboundStats() const
+{
+    return this->outboundDispatcher.getStats();
+}
+
+void WebSocketServerImpl::setWakeupHandler(std::function<void()> wakeupHandler)
+{
+    this->wakeupHandler = std::move(wakeupHandler);
+}
+
+void WebSocketServerImpl::requestWakeup()
+{
+    // Only the first event since last update() needs to interrupt the loop
+    if (this->wakeupHandler && !this->wakeupPending.exchange(true)) {
+        this->wakeupHandler();
+    }
 }
 
 size_t WebSocketServerImpl::getConnectedClients() const
@@ -144,14 +218,15 @@ void WebSocketServerImpl::onConnection(const WebSocketChannelPtr& channel)
     // Save connection
     {
         std::lock_guard<std::mutex> lock(this->clientsMutex);
-        this->clients[clientId] = channel;
+        this->clients[clientId] = std::make_shared<ChannelConnection>(channel);
         this->channelToClientId[channel] = clientId;
     }
     
-    fmt::print("WebSocket connection: {} (address: {})\n", clientId, channel->peeraddr());
+    LOG_INFO(LogCategory::Ws, "WebSocket connection: {} (address: {})", clientId, channel->peeraddr());
     
     // Add event to queue for processing in main thread
     this->connectionEventsQueue.push({clientId, true});
+    this->requestWakeup();
 }
 
 void WebSocketServerImpl::onMessage(const WebSocketChannelPtr& channel, const std::string& message)
@@ -162,16 +237,17 @@ void WebSocketServerImpl::onMessage(const WebSocketChannelPtr& channel, const st
         std::lock_guard<std::mutex> lock(this->clientsMutex);
         auto it = this->channelToClientId.find(channel);
         if (it == this->channelToClientId.end()) {
-            fmt::print(stderr, "Received message from unknown client\n");
+            LOG_ERROR(LogCategory::Ws, "Received message from unknown client");
             return;
         }
         clientId = it->second;
     }
     
-    fmt::print("Received message from {}: {}\n", clientId, message);
+    LOG_TRACE(LogCategory::Ws, "Received message from {}: {}", clientId, message);
     
     // Add message to queue for processing in main thread
     this->incomingQueue.push({clientId, message});
+    this->requestWakeup();
 }
 
 void WebSocketServerImpl::onClose(const WebSocketChannelPtr& channel)
@@ -191,42 +267,19 @@ void WebSocketServerImpl::onClose(const WebSocketChannelPtr& channel)
     }
     
     if (found) {
-        fmt::print("WebSocket disconnect: {}\n", clientId);
+        LOG_INFO(LogCategory::Ws, "WebSocket disconnect: {}", clientId);
         
         // Add event to queue for processing in main thread
         this->connectionEventsQueue.push({clientId, false});
+        this->requestWakeup();
     }
 }
 
-void WebSocketServerImpl::processOutgoingMessages()
+void WebSocketServerImpl::processOutgoingMessages(std::vector<ResyncRequest>& resyncRequests)
 {
     // Get all outgoing messages
     auto messages = this->outgoingQueue.takeAll();
     
-    // Send messages
     std::lock_guard<std::mutex> clientsLock(this->clientsMutex);
-    for (const auto& msg : messages) {
-        if (msg.clientId == 0) {
-            // Broadcast to all clients
-            for (const auto& [clientId, channel] : this->clients) {
-                try {
-                    channel->send(msg.message);
-                } catch (const std::exception& e) {
-                    fmt::print(stderr, "Broadcast message send error to client {}: {}\n", clientId, e.what());
-                }
-            }
-        } else {
-            // Send to specific client
-            auto it = this->clients.find(msg.clientId);
-            if (it != this->clients.end()) {
-                try {
-                    it->second->send(msg.message);
-                } catch (const std::exception& e) {
-                    fmt::print(stderr, "Message send error to client {}: {}\n", msg.clientId, e.what());
-                }
-            } else {
-                fmt::print(stderr, "Client {} not found to send message\n", msg.clientId);
-            }
-        }
-    }
+    this->outboundDispatcher.dispatch(messages, this->clients, resyncRequests);
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -11,6 +13,10 @@
  * - JSON protocol according to docs/protocol.md
  * - Non-blocking architecture with message queues
  * - Processing in main thread via update()
+ * - Session subscriptions: session broadcasts only reach subscribed clients
+ * - Per-client outbound budget: stale screen updates are dropped for slow clients,
+ *   which get a resync request reported through update()
+ * - Optional wakeup handler to integrate with the main thread event loop
  */
 class WebSocketServer {
 public:
@@ -22,12 +28,32 @@ public:
         std::string text;
     };
     
+    /**
+     * Delivery class of outgoing message: decides what may be dropped for a client that falls behind
+     */
+    enum class MessageClass {
+        Control,         // Always delivered
+        ScreenUpdate,    // Incremental screen change: dropped for a slow client, which is resynced later
+        ScreenSnapshot,  // Complete screen state: supersedes dropped updates
+        OutputLine       // Scrolled-off line: delivered in order or collapsed into output_skipped
+    };
+    
     /**
      * Structure for outgoing message to client
      */
     struct OutgoingMessage {
         int clientId = 0;  // 0 = broadcast to all
         std::string message;
+        MessageClass messageClass = MessageClass::Control;
+        uint64_t sessionId = 0;  // Session the message belongs to (0 = not session scoped)
+    };
+    
+    /**
+     * Request to send current screen of a session to a client that dropped its updates
+     */
+    struct ResyncRequest {
+        int clientId = 0;
+        uint64_t sessionId = 0;
     };
     
     /**
@@ -38,12 +64,23 @@ public:
         bool connected = false;  // true = connected, false = disconnected
     };
     
+    /**
+     * Outbound traffic counters (since start)
+     */
+    struct OutboundStats {
+        uint64_t messagesSent = 0;
+        uint64_t bytesSent = 0;
+        uint64_t messagesFiltered = 0;  // Broadcasts not sent to clients unsubscribed from their session
+        uint64_t bytesFiltered = 0;
+    };
+    
     /**
      * Result of update() call
      */
     struct UpdateResult {
         std::vector<IncomingMessage> incomingMessages;
         std::vector<ConnectionEvent> connectionEvents;
+        std::vector<ResyncRequest> resyncRequests;
     };
     
     /**
@@ -79,13 +116,60 @@ public:
      * @param clientId client identifier
      * @param message message to send
      */
-    virtual void sendMessage(int clientId, const std::string& message) = 0;
+    virtual void sendMessage(int clientId, std::string message) = 0;
     
     /**
      * Broadcast message (adds to queue)
+     * Payload is framed once and the same frame is written to every client.
+     * @param message message to send to all clients (moved into the queue)
+     */
+    virtual void broadcastMessage(std::string message) = 0;
+    
+    /**
+     * Send session message to client (adds to queue, may be dropped if client is behind)
+     * @param clientId client identifier
+     * @param sessionId session the message belongs to
+     * @param messageClass delivery class
+     * @param message message to send
+     */
+    virtual void sendSessionMessage(int clientId, uint64_t sessionId, MessageClass messageClass, std::string message) = 0;
+    
+    /**
+     * Broadcast session message to clients subscribed to the session
+     * (adds to queue, may be dropped for clients that are behind)
+     * @param sessionId session the message belongs to
+     * @param messageClass delivery class
      * @param message message to send to all clients
      */
-    virtual void broadcastMessage(const std::string& message) = 0;
+    virtual void broadcastSessionMessage(uint64_t sessionId, MessageClass messageClass, std::string message) = 0;
+    
+    /**
+     * Route broadcasts of session to client (call from the thread calling update())
+     * Client without subscriptions receives broadcasts of all sessions.
+     * @param clientId client identifier
+     * @param sessionId session to receive
+     */
+    virtual void subscribe(int clientId, uint64_t sessionId) = 0;
+    
+    /**
+     * Stop routing broadcasts of session to client (call from the thread calling update())
+     * @param clientId client identifier
+     * @param sessionId session to stop receiving
+     */
+    virtual void unsubscribe(int clientId, uint64_t sessionId) = 0;
+    
+    /**
+     * Get outbound traffic counters (safe to call from any thread)
+     */
+    virtual OutboundStats getOutboundStats() const = 0;
+    
+    /**
+     * Set handler called (from any thread) when update() has work to do:
+     * new incoming messages, connection events or queued outgoing messages.
+     * The handler must be cheap and thread-safe (e.g. EventLoop::wakeup).
+     * @param wakeupHandler handler to call, empty function to disable
+     */
+    virtual void setWakeupHandler(std::function<void()> wakeupHandler) = 0;
     
     /**
      * Get number of connected clients
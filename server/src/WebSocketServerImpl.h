@@ -1,8 +1,10 @@
 #pragma once
 
 #include "WebSocketServer.h"
+#include "OutboundDispatcher.h"
 #include <termihui/thread_safe_queue.h>
 
+#include <functional>
 #include <memory>
 #include <thread>
 #include <atomic>
@@ -11,18 +13,25 @@
 
 // Include libhv headers
 #include "hv/WebSocketServer.h"
+#include "hv/wsdef.h"
 
 /**
  * WebSocket server implementation using libhv
  */
 class WebSocketServerImpl : public WebSocketServer {
 public:
+    /**
+     * Default bytes that may be queued for a client before its screen updates are dropped
+     */
+    static constexpr size_t defaultOutboundBudget = 1024 * 1024;
+    
     /**
      * Constructor
      * @param port port for WebSocket server
      * @param bindAddress address to bind (e.g. "0.0.0.0" or "127.0.0.1")
+     * @param outboundBudget per-client outbound budget in bytes
      */
-    WebSocketServerImpl(int port, std::string bindAddress);
+    WebSocketServerImpl(int port, std::string bindAddress, size_t outboundBudget = defaultOutboundBudget);
     
     /**
      * Destructor
@@ -37,8 +46,14 @@ public:
     void stop() override;
     bool isRunning() const override;
     UpdateResult update() override;
-    void sendMessage(int clientId, const std::string& message) override;
-    void broadcastMessage(const std::string& message) override;
+    void sendMessage(int clientId, std::string message) override;
+    void broadcastMessage(std::string message) override;
+    void sendSessionMessage(int clientId, uint64_t sessionId, MessageClass messageClass, std::string message) override;
+    void broadcastSessionMessage(uint64_t sessionId, MessageClass messageClass, std::string message) override;
+    void subscribe(int clientId, uint64_t sessionId) override;
+    void unsubscribe(int clientId, uint64_t sessionId) override;
+    OutboundStats getOutboundStats() const override;
+    void setWakeupHandler(std::function<void()> wakeupHandler) override;
     size_t getConnectedClients() const override;
     int getPort() const override { return this->port; }
     const std::string& getBindAddress() const override { return this->bindAddress; }
@@ -59,8 +74,14 @@ private:
     
     /**
      * Send outgoing messages from queue (called from update)
+     * @param resyncRequests receives screens to resend to clients that caught up
+     */
+    void processOutgoingMessages(std::vector<ResyncRequest>& resyncRequests);
+    
+    /**
+     * Notify wakeup handler once per update() cycle
      */
-    void processOutgoingMessages();
+    void requestWakeup();
 
 private:
     int port = 0;
@@ -75,11 +96,18 @@ private:
     
     // Client management (mutex protected)
     mutable std::mutex clientsMutex;
-    std::unordered_map<int, WebSocketChannelPtr> clients;
+    OutboundDispatcher::Connections clients;
     std::unordered_map<WebSocketChannelPtr, int> channelToClientId;
     
+    // Framing, subscriptions and backpressure of outgoing messages (update() thread only)
+    OutboundDispatcher outboundDispatcher;
+    
     // Thread-safe message queues
     termihui::ThreadSafeQueue<IncomingMessage> incomingQueue;
     termihui::ThreadSafeQueue<ConnectionEvent> connectionEventsQueue;
     termihui::ThreadSafeQueue<OutgoingMessage> outgoingQueue;
+    
+    // Main loop wakeup (set before start(), invoked from any thread)
+    std::function<void()> wakeupHandler;
+    std::atomic<bool> wakeupPending{false};
 };
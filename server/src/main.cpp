@@ -1,6 +1,7 @@
 #include "TermihuiServerController.h"
 #include "WebSocketServerImpl.h"
 #include "AIAgentControllerImpl.h"
+#include "Logger.h"
 #include <csignal>
 #include <cstdio>
 #include <memory>
@@ -8,19 +9,30 @@
 #include "hv/hlog.h"
 #include <cstring>
 #include <string_view>
+#include <algorithm>
 #include <thread>
 #include <chrono>
+#include <filesystem>
 
 void printUsage(std::string_view programName) {
     fmt::print("Usage: {} [options]\n", programName);
     fmt::print("Options:\n");
     fmt::print("  -b, --bind <address>   Bind address (default: 127.0.0.1)\n");
     fmt::print("  -p, --port <port>      Port number (default: 37854)\n");
+    fmt::print("  -w, --workers <count>  Session worker threads (default: CPU cores, 0 = main thread)\n");
+    fmt::print("  -f, --fps <rate>       Max screen frames per second per session (default: 60, 0 = unpaced)\n");
+    fmt::print("  -s, --shell-pool <count> Pre-spawned shells for new tabs (default: 2, 0 = disabled)\n");
+    fmt::print("  -k, --scrollback <lines> Scrolled-off lines kept in memory per session (default: 10000, 0 = disabled)\n");
+    fmt::print("      --scrollback-mb <size> Memory cap of that scrollback per session, MiB (default: 4)\n");
+    fmt::print("      --record <dir>     Record PTY output of each new session into dir (for termihui_replay)\n");
+    fmt::print("  -l, --log <spec>       Log levels: <level> or <category>=<level>, comma-separated (default: info)\n");
+    fmt::print("                         Categories: pty, osc, ws, storage, ai, session; levels: trace, debug, info, warn, error, off\n");
     fmt::print("  -h, --help             Show this help message\n");
     fmt::print("\nExamples:\n");
     fmt::print("  {}                       # Listen on localhost:37854\n", programName);
     fmt::print("  {} -b 0.0.0.0            # Listen on all interfaces\n", programName);
     fmt::print("  {} -b 0.0.0.0 -p 8080    # Listen on all interfaces, port 8080\n", programName);
+    fmt::print("  {} -l warn,ws=debug      # Quiet except WebSocket traffic\n", programName);
     }
 
 int main(int argc, char* argv[])
@@ -32,6 +44,11 @@ int main(int argc, char* argv[])
     // Default values
     std::string bindAddress = "127.0.0.1";
     int port = 37854;
+    int sessionWorkerCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int framesPerSecond = 60;
+    int shellPoolSize = 2;
+    ScrollbackBuffer::Limits scrollbackLimits;
+    std::filesystem::path recordingDirectory;
     
     // Parse command line arguments
     for (int i = 1; i < argc; i++) {
@@ -56,6 +73,86 @@ int main(int argc, char* argv[])
                 fmt::print(stderr, "Error: --port requires a port number argument\n");
                 return 1;
             }
+        } else if (strcmp(argv[i], "-w") == 0 || strcmp(argv[i], "--workers") == 0) {
+            if (i + 1 < argc) {
+                sessionWorkerCount = std::atoi(argv[++i]);
+                if (sessionWorkerCount < 0 || sessionWorkerCount > 256) {
+                    fmt::print(stderr, "Error: Invalid worker count\n");
+                    return 1;
+                }
+            } else {
+                fmt::print(stderr, "Error: --workers requires a count argument\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-f") == 0 || strcmp(argv[i], "--fps") == 0) {
+            if (i + 1 < argc) {
+                framesPerSecond = std::atoi(argv[++i]);
+                if (framesPerSecond < 0 || framesPerSecond > 1000) {
+                    fmt::print(stderr, "Error: Invalid frame rate\n");
+                    return 1;
+                }
+            } else {
+                fmt::print(stderr, "Error: --fps requires a rate argument\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--shell-pool") == 0) {
+            if (i + 1 < argc) {
+                shellPoolSize = std::atoi(argv[++i]);
+                if (shellPoolSize < 0 || shellPoolSize > 64) {
+                    fmt::print(stderr, "Error: Invalid shell pool size\n");
+                    return 1;
+                }
+            } else {
+                fmt::print(stderr, "Error: --shell-pool requires a count argument\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-k") == 0 || strcmp(argv[i], "--scrollback") == 0) {
+            if (i + 1 < argc) {
+                int lines = std::atoi(argv[++i]);
+                if (lines < 0) {
+                    fmt::print(stderr, "Error: Invalid scrollback line count\n");
+                    return 1;
+                }
+                scrollbackLimits.maxLines = static_cast<size_t>(lines);
+            } else {
+                fmt::print(stderr, "Error: --scrollback requires a line count argument\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--scrollback-mb") == 0) {
+            if (i + 1 < argc) {
+                int megabytes = std::atoi(argv[++i]);
+                if (megabytes < 0 || megabytes > 4096) {
+                    fmt::print(stderr, "Error: Invalid scrollback size\n");
+                    return 1;
+                }
+                scrollbackLimits.maxBytes = static_cast<size_t>(megabytes) * 1024 * 1024;
+            } else {
+                fmt::print(stderr, "Error: --scrollback-mb requires a size argument\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--record") == 0) {
+            if (i + 1 < argc) {
+                recordingDirectory = argv[++i];
+                std::error_code error;
+                std::filesystem::create_directories(recordingDirectory, error);
+                if (error) {
+                    fmt::print(stderr, "Error: Can't create recording directory '{}': {}\n", recordingDirectory.string(), error.message());
+                    return 1;
+                }
+            } else {
+                fmt::print(stderr, "Error: --record requires a directory argument\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-l") == 0 || strcmp(argv[i], "--log") == 0) {
+            if (i + 1 < argc) {
+                if (!Logger::instance().configure(argv[++i])) {
+                    fmt::print(stderr, "Error: Invalid log spec '{}'\n", argv[i]);
+                    return 1;
+                }
+            } else {
+                fmt::print(stderr, "Error: --log requires a spec argument\n");
+                return 1;
+            }
         } else {
             fmt::print(stderr, "Error: Unknown option '{}'\n", argv[i]);
             printUsage(argv[0]);
@@ -78,7 +175,14 @@ int main(int argc, char* argv[])
     // Create and start the server
     auto webSocketServer = std::make_unique<WebSocketServerImpl>(port, bindAddress);
     auto aiAgentController = std::make_unique<AIAgentControllerImpl>();
-    TermihuiServerController termihuiServerController(std::move(webSocketServer), std::move(aiAgentController), nullptr);
+    TermihuiServerController termihuiServerController(std::move(webSocketServer), std::move(aiAgentController), nullptr,
+                                                      static_cast<size_t>(sessionWorkerCount));
+    if (framesPerSecond > 0) {
+        termihuiServerController.setFrameInterval(std::chrono::microseconds(1000000 / framesPerSecond));
+    }
+    termihuiServerController.setShellPoolSize(static_cast<size_t>(shellPoolSize));
+    termihuiServerController.setScrollbackLimits(scrollbackLimits);
+    termihuiServerController.setRecordingDirectory(recordingDirectory);
     
     if (!termihuiServerController.start()) {
         return 1;
@@ -86,10 +190,10 @@ int main(int argc, char* argv[])
     
     fmt::print("Server started! Waiting for connections...\n\n");
     
-    // Main server loop
+    // Main server loop: blocks in the event loop until there is work to do.
+    // Timeout only bounds how long a shutdown signal may go unnoticed.
     while (!termihuiServerController.shouldStop()) {
-        termihuiServerController.update();
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        termihuiServerController.update(500);
     }
     
     fmt::print("\n=== Server shutdown ===\n");
@@ -96,6 +96,11 @@ public:
         return this->updateReturnValue;
     }
     
+    // Event loop integration is not needed in tests (update() is called directly)
+    void attachEventLoop(EventLoop&) override {}
+    
+    int nextTimeoutMs() const override { return -1; }
+    
     void clearHistory(uint64_t sessionId) override {
         this->calls.push_back(ClearHistoryCall{sessionId});
     }
@@ -45,6 +45,9 @@ public:
     TerminalSessionControllerMock() 
         : TerminalSessionController(std::filesystem::temp_directory_path() / "test_mock.sqlite", 1, 1) {}
     
+    // Output of a claimed warm shell's hidden cd, as after createSession() with a shell pool
+    using TerminalSessionController::hideOutputOfNextCommand;
+    
     // Recorded calls
     std::vector<Call> calls;
     
@@ -58,17 +61,17 @@ public:
         return this->hasDataReturnValue;
     }
     
-    std::string readOutput() override {
-        if (this->readOutputReturnValues.empty()) {
+    std::string_view drainOutput() override {
+        if (!this->hasDataReturnValue || this->readOutputReturnValues.empty()) {
             this->hasDataReturnValue = false;
-            return "";
+            return this->bufferOutput({});
         }
         std::string result = this->readOutputReturnValues.front();
         this->readOutputReturnValues.pop();
         if (this->readOutputReturnValues.empty()) {
             this->hasDataReturnValue = false;
         }
-        return result;
+        return this->bufferOutput(result);
     }
     
     void setLastKnownCwd(const std::string& cwd) override {
@@ -79,8 +82,8 @@ public:
         this->calls.push_back(StartCommandInHistoryCall{cwd});
     }
     
-    void appendOutputToCurrentCommand(const std::string& output) override {
-        this->calls.push_back(AppendOutputToCurrentCommandCall{output});
+    void appendOutputToCurrentCommand(std::string_view output) override {
+        this->calls.push_back(AppendOutputToCurrentCommandCall{std::string(output)});
     }
     
     void finishCurrentCommand(int exitCode, const std::string& cwd) override {
@@ -45,7 +45,25 @@ public:
         }
     };
 
-    using Call = std::variant<SendMessageCall, BroadcastMessageCall, UpdateCall>;
+    struct SubscribeCall {
+        int clientId = 0;
+        uint64_t sessionId = 0;
+        bool operator==(const SubscribeCall&) const = default;
+        friend std::ostream& operator<<(std::ostream& os, const SubscribeCall& call) {
+            return os << "SubscribeCall{clientId=" << call.clientId << ", sessionId=" << call.sessionId << "}";
+        }
+    };
+    
+    struct UnsubscribeCall {
+        int clientId = 0;
+        uint64_t sessionId = 0;
+        bool operator==(const UnsubscribeCall&) const = default;
+        friend std::ostream& operator<<(std::ostream& os, const UnsubscribeCall& call) {
+            return os << "UnsubscribeCall{clientId=" << call.clientId << ", sessionId=" << call.sessionId << "}";
+        }
+    };
+
+    using Call = std::variant<SendMessageCall, BroadcastMessageCall, UpdateCall, SubscribeCall, UnsubscribeCall>;
     
     friend std::ostream& operator<<(std::ostream& os, const Call& call) {
         std::visit([&os](const auto& c) { os << c; }, call);
@@ -57,6 +75,9 @@ public:
     
     // Configurable return value for update()
     UpdateResult updateReturnValue;
+    
+    // Handler installed by the controller (not recorded as a call)
+    std::function<void()> wakeupHandler;
 
     // Stub implementations
     bool start() override { return true; }
@@ -68,14 +89,37 @@ public:
         return this->updateReturnValue;
     }
     
-    void sendMessage(int clientId, const std::string& message) override {
+    void sendMessage(int clientId, std::string message) override {
+        this->calls.push_back(SendMessageCall{clientId, message});
+    }
+    
+    void broadcastMessage(std::string message) override {
+        this->calls.push_back(BroadcastMessageCall{message});
+    }
+    
+    // Session messages are recorded like plain ones: delivery class only matters to the real server
+    void sendSessionMessage(int clientId, uint64_t, MessageClass, std::string message) override {
         this->calls.push_back(SendMessageCall{clientId, message});
     }
     
-    void broadcastMessage(const std::string& message) override {
+    void broadcastSessionMessage(uint64_t, MessageClass, std::string message) override {
         this->calls.push_back(BroadcastMessageCall{message});
     }
     
+    void subscribe(int clientId, uint64_t sessionId) override {
+        this->calls.push_back(SubscribeCall{clientId, sessionId});
+    }
+    
+    void unsubscribe(int clientId, uint64_t sessionId) override {
+        this->calls.push_back(UnsubscribeCall{clientId, sessionId});
+    }
+    
+    OutboundStats getOutboundStats() const override { return {}; }
+    
+    void setWakeupHandler(std::function<void()> wakeupHandler) override {
+        this->wakeupHandler = std::move(wakeupHandler);
+    }
+    
     size_t getConnectedClients() const override { return 0; }
     int getPort() const override { return 0; }
     const std::string& getBindAddress() const override { return this->bindAddress; }
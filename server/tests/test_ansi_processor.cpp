@@ -66,6 +66,20 @@ TEST_CASE("AnsiProcessor handles backspace", "[AnsiProcessor][text]") {
     CHECK(screen.getRowText(0) == "AXC");
 }
 
+TEST_CASE("AnsiProcessor lays out wide and combining characters", "[AnsiProcessor][text]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    // "日本" (two wide characters), then "e" + U+0301 COMBINING ACUTE ACCENT
+    processor.process("\xE6\x97\xA5\xE6\x9C\xAC");
+    processor.process("e\xCC\x81!");
+    
+    CHECK(screen.getRowText(0) == "\xE6\x97\xA5\xE6\x9C\xAC" "e\xCC\x81!");
+    CHECK(screen.cellAt(0, 2).character == U'\u672C');
+    CHECK(screen.cellAt(0, 5).character == U'!');
+    CHECK(screen.cursorColumn() == 6);
+}
+
 // =============================================================================
 // Cursor Movement
 // =============================================================================
@@ -199,6 +213,51 @@ TEST_CASE("AnsiProcessor EL clears entire line", "[AnsiProcessor][clear]") {
     CHECK(screen.getRowText(0) == "");
 }
 
+// =============================================================================
+// Scroll Region
+// =============================================================================
+
+TEST_CASE("AnsiProcessor DECSTBM confines scrolling to region", "[AnsiProcessor][scroll]") {
+    VirtualScreen screen(5, 10);
+    AnsiProcessor processor(screen);
+    
+    processor.process("top\r\nA\r\nB\r\nC\r\nstatus");
+    processor.process("\x1B[2;4r");  // Rows 2..4, cursor goes home
+    CHECK(screen.cursorRow() == 0);
+    
+    processor.process("\x1B[4;1H\nD");
+    
+    CHECK(screen.getContent() == "top\nB\nC\nD\nstatus");
+    CHECK_FALSE(screen.hasScrolledOffRows());
+    
+    processor.process("\x1B[r");  // Reset to full screen
+    CHECK(screen.scrollRegionTop() == 0);
+    CHECK(screen.scrollRegionBottom() == 4);
+}
+
+TEST_CASE("AnsiProcessor IL and DL shift lines below cursor", "[AnsiProcessor][scroll]") {
+    VirtualScreen screen(4, 10);
+    AnsiProcessor processor(screen);
+    
+    processor.process("A\r\nB\r\nC\r\nD");
+    processor.process("\x1B[2;3H\x1B[L");  // Insert line at row 2
+    CHECK(screen.getContent() == "A\n\nB\nC");
+    CHECK(screen.cursorColumn() == 0);
+    
+    processor.process("\x1B[2M");  // Delete two lines at row 2
+    CHECK(screen.getContent() == "A\nC\n\n");
+}
+
+TEST_CASE("AnsiProcessor RI at top of region scrolls region down", "[AnsiProcessor][scroll]") {
+    VirtualScreen screen(4, 10);
+    AnsiProcessor processor(screen);
+    
+    processor.process("A\r\nB\r\nC\r\nD");
+    processor.process("\x1B[2;3r\x1B[2;1H\x1BM");
+    
+    CHECK(screen.getContent() == "A\n\nB\nD");
+}
+
 // =============================================================================
 // SGR (Colors and Styles)
 // =============================================================================
@@ -209,10 +268,10 @@ TEST_CASE("AnsiProcessor SGR reset", "[AnsiProcessor][sgr]") {
     
     processor.process("\x1B[1;31mRed\x1B[0mNormal");
     
-    CHECK(screen.cellAt(0, 0).style.bold == true);
-    CHECK(screen.cellAt(0, 0).style.foreground.has_value());
-    CHECK(screen.cellAt(0, 3).style.bold == false);
-    CHECK(!screen.cellAt(0, 3).style.foreground.has_value());
+    CHECK(screen.styleAt(0, 0).bold == true);
+    CHECK(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(screen.styleAt(0, 3).bold == false);
+    CHECK(!screen.styleAt(0, 3).foreground.has_value());
 }
 
 TEST_CASE("AnsiProcessor SGR bold", "[AnsiProcessor][sgr]") {
@@ -221,7 +280,7 @@ TEST_CASE("AnsiProcessor SGR bold", "[AnsiProcessor][sgr]") {
     
     processor.process("\x1B[1mBold");
     
-    CHECK(screen.cellAt(0, 0).style.bold == true);
+    CHECK(screen.styleAt(0, 0).bold == true);
 }
 
 TEST_CASE("AnsiProcessor SGR standard foreground colors", "[AnsiProcessor][sgr]") {
@@ -230,9 +289,9 @@ TEST_CASE("AnsiProcessor SGR standard foreground colors", "[AnsiProcessor][sgr]"
     
     processor.process("\x1B[31mR"); // Red
     
-    CHECK(screen.cellAt(0, 0).style.foreground.has_value());
-    CHECK(screen.cellAt(0, 0).style.foreground->type == Color::Type::Standard);
-    CHECK(screen.cellAt(0, 0).style.foreground->index == 1);
+    CHECK(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(screen.styleAt(0, 0).foreground->type == Color::Type::Standard);
+    CHECK(screen.styleAt(0, 0).foreground->index == 1);
 }
 
 TEST_CASE("AnsiProcessor SGR bright foreground colors", "[AnsiProcessor][sgr]") {
@@ -241,9 +300,9 @@ TEST_CASE("AnsiProcessor SGR bright foreground colors", "[AnsiProcessor][sgr]")
     
     processor.process("\x1B[92mG"); // Bright green
     
-    CHECK(screen.cellAt(0, 0).style.foreground.has_value());
-    CHECK(screen.cellAt(0, 0).style.foreground->type == Color::Type::Bright);
-    CHECK(screen.cellAt(0, 0).style.foreground->index == 2);
+    CHECK(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(screen.styleAt(0, 0).foreground->type == Color::Type::Bright);
+    CHECK(screen.styleAt(0, 0).foreground->index == 2);
 }
 
 TEST_CASE("AnsiProcessor SGR 256-color foreground", "[AnsiProcessor][sgr]") {
@@ -252,9 +311,9 @@ TEST_CASE("AnsiProcessor SGR 256-color foreground", "[AnsiProcessor][sgr]") {
     
     processor.process("\x1B[38;5;208mO"); // Orange (index 208)
     
-    CHECK(screen.cellAt(0, 0).style.foreground.has_value());
-    CHECK(screen.cellAt(0, 0).style.foreground->type == Color::Type::Indexed);
-    CHECK(screen.cellAt(0, 0).style.foreground->index == 208);
+    CHECK(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(screen.styleAt(0, 0).foreground->type == Color::Type::Indexed);
+    CHECK(screen.styleAt(0, 0).foreground->index == 208);
 }
 
 TEST_CASE("AnsiProcessor SGR RGB foreground", "[AnsiProcessor][sgr]") {
@@ -263,11 +322,11 @@ TEST_CASE("AnsiProcessor SGR RGB foreground", "[AnsiProcessor][sgr]") {
     
     processor.process("\x1B[38;2;255;128;64mC"); // RGB color
     
-    CHECK(screen.cellAt(0, 0).style.foreground.has_value());
-    CHECK(screen.cellAt(0, 0).style.foreground->type == Color::Type::RGB);
-    CHECK(screen.cellAt(0, 0).style.foreground->r == 255);
-    CHECK(screen.cellAt(0, 0).style.foreground->g == 128);
-    CHECK(screen.cellAt(0, 0).style.foreground->b == 64);
+    CHECK(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(screen.styleAt(0, 0).foreground->type == Color::Type::RGB);
+    CHECK(screen.styleAt(0, 0).foreground->r == 255);
+    CHECK(screen.styleAt(0, 0).foreground->g == 128);
+    CHECK(screen.styleAt(0, 0).foreground->b == 64);
 }
 
 TEST_CASE("AnsiProcessor SGR background colors", "[AnsiProcessor][sgr]") {
@@ -276,9 +335,9 @@ TEST_CASE("AnsiProcessor SGR background colors", "[AnsiProcessor][sgr]") {
     
     processor.process("\x1B[44mB"); // Blue background
     
-    CHECK(screen.cellAt(0, 0).style.background.has_value());
-    CHECK(screen.cellAt(0, 0).style.background->type == Color::Type::Standard);
-    CHECK(screen.cellAt(0, 0).style.background->index == 4);
+    CHECK(screen.styleAt(0, 0).background.has_value());
+    CHECK(screen.styleAt(0, 0).background->type == Color::Type::Standard);
+    CHECK(screen.styleAt(0, 0).background->index == 4);
 }
 
 TEST_CASE("AnsiProcessor SGR multiple attributes", "[AnsiProcessor][sgr]") {
@@ -287,7 +346,7 @@ TEST_CASE("AnsiProcessor SGR multiple attributes", "[AnsiProcessor][sgr]") {
     
     processor.process("\x1B[1;3;4;31;44mX"); // Bold, italic, underline, red on blue
     
-    const TextStyle& style = screen.cellAt(0, 0).style;
+    const TextStyle& style = screen.styleAt(0, 0);
     CHECK(style.bold == true);
     CHECK(style.italic == true);
     CHECK(style.underline == true);
@@ -341,6 +400,53 @@ TEST_CASE("AnsiProcessor alternate screen is idempotent", "[AnsiProcessor][inter
     CHECK(events3.size() == 0); // Third time - no event
 }
 
+TEST_CASE("AnsiProcessor restores primary screen and cursor after alternate screen", "[AnsiProcessor][interactive]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    processor.process("$ vim\r\n\x1B[31m");
+    processor.process("\x1B[?1049h\x1B[0m\x1B[2;1Hediting\x1B[5;1H\n");
+    CHECK(screen.isAlternateScreen());
+    CHECK(screen.getRowText(0) == "editing");
+    CHECK(screen.getRowText(1) == "");
+    CHECK(screen.takeScrolledOffRows().empty());
+    
+    processor.process("\x1B[?1049lX");
+    
+    CHECK_FALSE(screen.isAlternateScreen());
+    CHECK(screen.getRowText(0) == "$ vim");
+    CHECK(screen.getRowText(1) == "X");
+    CHECK(screen.styleAt(1, 0).foreground == Color::standard(1));
+    CHECK(screen.cursorColumn() == 1);
+}
+
+TEST_CASE("AnsiProcessor DECSC and DECRC save and restore cursor", "[AnsiProcessor][cursor]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    processor.process("\x1B[3;4H\x1B[1m\x1B" "7\x1B[0m\x1B[H\x1B" "8X");
+    
+    CHECK(screen.cellAt(2, 3).character == U'X');
+    CHECK(screen.styleAt(2, 3).bold);
+    
+    processor.process("\x1B[1;2H\x1B[s\x1B[5;5H\x1B[uY");
+    CHECK(screen.cellAt(0, 1).character == U'Y');
+}
+
+TEST_CASE("AnsiProcessor tracks bracketed paste mode", "[AnsiProcessor][paste]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    CHECK_FALSE(processor.isBracketedPasteMode());
+    
+    auto events = processor.process("\x1B[?2004h");
+    CHECK(processor.isBracketedPasteMode());
+    CHECK(events.empty());
+    
+    processor.process("\x1B[?2004l");
+    CHECK_FALSE(processor.isBracketedPasteMode());
+}
+
 // =============================================================================
 // OSC Sequences
 // =============================================================================
@@ -373,6 +479,109 @@ TEST_CASE("AnsiProcessor handles OSC with ST terminator", "[AnsiProcessor][osc]"
     CHECK(event->title == "My Title");
 }
 
+TEST_CASE("AnsiProcessor parses OSC 133 command markers", "[AnsiProcessor][osc]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    auto events = processor.process("\x1B]133;A;cwd=/home\x07ls\x1B]133;B;exit=127;cwd=/tmp\x1B\\");
+    
+    CHECK(screen.getRowText(0) == "ls");
+    REQUIRE(events.size() == 2);
+    
+    auto* start = std::get_if<AnsiEvent::CommandMarker>(&events[0]);
+    REQUIRE(start != nullptr);
+    CHECK(start->kind == AnsiEvent::CommandMarker::Kind::CommandStart);
+    CHECK(start->cwd == "/home");
+    CHECK(start->range.begin == 0);
+    CHECK(start->range.end == 18);
+    
+    auto* end = std::get_if<AnsiEvent::CommandMarker>(&events[1]);
+    REQUIRE(end != nullptr);
+    CHECK(end->kind == AnsiEvent::CommandMarker::Kind::CommandEnd);
+    CHECK(end->exitCode == 127);
+    CHECK(end->cwd == "/tmp");
+    CHECK(end->range.begin == 20);
+    CHECK(end->range.end == 47);
+}
+
+TEST_CASE("AnsiProcessor parses OSC 7 working directory", "[AnsiProcessor][osc]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    auto events = processor.process("\x1B]7;file://host/var/log\x07\x1B]1337;x\x07");
+    
+    REQUIRE(events.size() == 2);
+    auto* cwd = std::get_if<AnsiEvent::CwdChanged>(&events[0]);
+    REQUIRE(cwd != nullptr);
+    CHECK(cwd->path == "/var/log");
+    CHECK(std::holds_alternative<AnsiEvent::OtherOsc>(events[1]));
+}
+
+TEST_CASE("AnsiProcessor stops after OSC on request", "[AnsiProcessor][osc]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    std::string_view data = "ab\x1B]133;C\x07" "cd";
+    std::vector<AnsiEventVariant> events;
+    
+    size_t consumed = processor.processUntilOsc(data, events);
+    
+    // Text before the marker is on screen, text after it is not yet
+    CHECK(consumed == 10);
+    CHECK(screen.getRowText(0) == "ab");
+    REQUIRE(events.size() == 1);
+    const AnsiEvent::ByteRange* range = oscRange(events[0]);
+    REQUIRE(range != nullptr);
+    CHECK(range->begin == 2);
+    CHECK(range->end == 10);
+    
+    events.clear();
+    CHECK(processor.processUntilOsc(data.substr(consumed), events) == 2);
+    CHECK(screen.getRowText(0) == "abcd");
+    CHECK(events.empty());
+}
+
+TEST_CASE("AnsiProcessor holds lone ESC at end of data", "[AnsiProcessor][osc]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    processor.process("text\x1B");
+    CHECK(processor.endsWithEscape());
+    REQUIRE(processor.pendingOscStart().has_value());
+    CHECK(*processor.pendingOscStart() == 4);
+    
+    processor.process("[1Cmore");
+    CHECK_FALSE(processor.endsWithEscape());
+    CHECK_FALSE(processor.pendingOscStart().has_value());
+    CHECK(screen.getRowText(0) == "text more");
+    
+    // ESC that may end an OSC (ST) is no lone ESC
+    processor.process("\x1B]0;title\x1B");
+    CHECK_FALSE(processor.endsWithEscape());
+}
+
+TEST_CASE("AnsiProcessor completes OSC split across reads", "[AnsiProcessor][osc]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    auto first = processor.process("text\x1B]133;A;cw");
+    
+    CHECK(first.empty());
+    REQUIRE(processor.pendingOscStart().has_value());
+    CHECK(*processor.pendingOscStart() == 4);
+    
+    auto second = processor.process("d=/tmp\x07more");
+    
+    CHECK_FALSE(processor.pendingOscStart().has_value());
+    CHECK(screen.getRowText(0) == "textmore");
+    REQUIRE(second.size() == 1);
+    auto* marker = std::get_if<AnsiEvent::CommandMarker>(&second[0]);
+    REQUIRE(marker != nullptr);
+    CHECK(marker->cwd == "/tmp");
+    // Began in the previous read: range starts at the beginning of this one
+    CHECK(marker->range.begin == 0);
+    CHECK(marker->range.end == 7);
+}
+
 // =============================================================================
 // Bell Event
 // =============================================================================
@@ -398,22 +607,163 @@ TEST_CASE("AnsiProcessor handles 8-bit CSI", "[AnsiProcessor][csi]") {
     
     processor.process("\x9B" "31mRed"); // 0x9B = 8-bit CSI
     
-    CHECK(screen.cellAt(0, 0).style.foreground.has_value());
-    CHECK(screen.cellAt(0, 0).style.foreground->index == 1);
+    CHECK(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(screen.styleAt(0, 0).foreground->index == 1);
+}
+
+TEST_CASE("AnsiProcessor handles 8-bit C1 controls inside sequences", "[AnsiProcessor][csi]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    // 8-bit CSI aborts the unfinished 7-bit one
+    processor.process("\x1B[12\x9B" "32mGreen");
+    
+    CHECK(screen.getRowText(0) == "Green");
+    REQUIRE(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(screen.styleAt(0, 0).foreground->index == 2);
+}
+
+TEST_CASE("AnsiProcessor SGR colon RGB foreground", "[AnsiProcessor][sgr]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    processor.process("\x1B[38:2:10:20:30mA\x1B[38:2::40:50:60;1mB\x1B[0;4:3mC");
+    
+    REQUIRE(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(*screen.styleAt(0, 0).foreground == Color::rgb(10, 20, 30));
+    REQUIRE(screen.styleAt(0, 1).foreground.has_value());
+    CHECK(*screen.styleAt(0, 1).foreground == Color::rgb(40, 50, 60));
+    CHECK(screen.styleAt(0, 1).bold == true);
+    // 4:3 (curly underline) is an underline, the sub-parameter is not italic
+    CHECK(screen.styleAt(0, 2).underline == true);
+    CHECK(screen.styleAt(0, 2).italic == false);
+}
+
+// =============================================================================
+// Unsupported Sequences
+// =============================================================================
+
+TEST_CASE("AnsiProcessor skips escape sequences with intermediates", "[AnsiProcessor][skip]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    // Charset designation, DECALN, DECSTR and DECSCUSR
+    processor.process("\x1B(BA\x1B#8B\x1B[!pC\x1B[2 qD");
+    
+    CHECK(screen.getRowText(0) == "ABCD");
+}
+
+TEST_CASE("AnsiProcessor skips DCS, SOS, PM and APC strings", "[AnsiProcessor][skip]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    auto events = processor.process("A\x1BP1$r0m\x1B\\B\x1BXsos\x07\x1B\\C\x1B^pm\x1B\\D\x1B_apc\x1B\\E");
+    
+    CHECK(screen.getRowText(0) == "ABCDE");
+    CHECK(events.empty());
+}
+
+TEST_CASE("AnsiProcessor ignores private CSI forms other than DEC modes", "[AnsiProcessor][skip]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    // DA2 request and XTMODKEYS must not be taken for cursor movement or SGR
+    processor.process("\x1B[>cA\x1B[>4;1mB");
+    
+    CHECK(screen.getRowText(0) == "AB");
+    CHECK(screen.styleAt(0, 1).underline == false);
+}
+
+TEST_CASE("AnsiProcessor survives oversized parameter lists", "[AnsiProcessor][skip]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    std::string sequence = "\x1B[";
+    for (int i = 0; i < 100; ++i) {
+        sequence += "999999999;";
+    }
+    sequence += "1mX";
+    processor.process(sequence);
+    
+    CHECK(screen.getRowText(0) == "X");
+}
+
+TEST_CASE("AnsiProcessor keeps UTF-8 title bytes that look like C1 controls", "[AnsiProcessor][osc]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    // "ё" is D1 91 and "ל" is D7 9C: continuation bytes in the C1 range
+    auto events = processor.process("\x1B]2;ёל\x07Text");
+    
+    CHECK(screen.getRowText(0) == "Text");
+    REQUIRE(events.size() == 1);
+    auto* event = std::get_if<AnsiEvent::TitleChanged>(&events[0]);
+    REQUIRE(event != nullptr);
+    CHECK(event->title == "ёל");
 }
 
 // =============================================================================
 // Edge Cases
 // =============================================================================
 
+TEST_CASE("AnsiProcessor text fast path matches byte-wise processing", "[AnsiProcessor][text]") {
+    // Long printable runs (vector-width and beyond), UTF-8, controls, DEL and invalid bytes
+    std::string data = "first line of plain ASCII text that is longer than one vector\r\n"
+                       "\x1B[1mbold\x1B[0m tab\there Привет, мир! 日本語 \xF0\x9F\x98\x80 end\r\n"
+                       "del\x7F and invalid \xC3( bytes \x80 continue\x07\r\n"
+                       "a row that is long enough to wrap over the forty column screen edge twice over";
+    
+    VirtualScreen wholeScreen(6, 40);
+    AnsiProcessor wholeProcessor(wholeScreen);
+    auto wholeEvents = wholeProcessor.process(data);
+    
+    VirtualScreen byteScreen(6, 40);
+    AnsiProcessor byteProcessor(byteScreen);
+    size_t byteEvents = 0;
+    for (char ch : data) {
+        byteEvents += byteProcessor.process(std::string_view(&ch, 1)).size();
+    }
+    
+    for (size_t row = 0; row < 6; ++row) {
+        INFO("Row " << row);
+        CHECK(wholeScreen.getRowSegments(row) == byteScreen.getRowSegments(row));
+    }
+    CHECK(wholeScreen.cursorRow() == byteScreen.cursorRow());
+    CHECK(wholeScreen.cursorColumn() == byteScreen.cursorColumn());
+    CHECK(wholeEvents.size() == byteEvents);
+}
+
+TEST_CASE("AnsiProcessor handles UTF-8 split across chunks", "[AnsiProcessor][text]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    processor.process("ab\xD0");
+    processor.process("\x9F" "cd\xE2\x82");
+    processor.process("\xAC!");
+    
+    CHECK(screen.getRowText(0) == "abПcd€!");
+    CHECK(screen.cursorColumn() == 7);
+}
+
+TEST_CASE("AnsiProcessor drops malformed UTF-8 sequences", "[AnsiProcessor][text]") {
+    VirtualScreen screen(5, 20);
+    AnsiProcessor processor(screen);
+    
+    // Overlong '/', a surrogate and a sequence cut short by ASCII
+    processor.process("a\xC0\xAF" "b\xED\xB0\xB0" "c\xE2\x82" "d");
+    
+    CHECK(screen.getRowText(0) == "abcd");
+    CHECK(screen.cursorColumn() == 4);
+}
+
 TEST_CASE("AnsiProcessor handles empty SGR", "[AnsiProcessor][sgr]") {
     VirtualScreen screen(5, 20);
     AnsiProcessor processor(screen);
     
     processor.process("\x1B[1mBold\x1B[mNormal"); // ESC[m = reset
     
-    CHECK(screen.cellAt(0, 0).style.bold == true);
-    CHECK(screen.cellAt(0, 4).style.bold == false);
+    CHECK(screen.styleAt(0, 0).bold == true);
+    CHECK(screen.styleAt(0, 4).bold == false);
 }
 
 TEST_CASE("AnsiProcessor handles incomplete escape sequences", "[AnsiProcessor][edge]") {
@@ -425,7 +775,7 @@ TEST_CASE("AnsiProcessor handles incomplete escape sequences", "[AnsiProcessor][
     processor.process("[31mRed");
     
     CHECK(screen.getRowText(0) == "TextRed");
-    CHECK(screen.cellAt(0, 4).style.foreground.has_value());
+    CHECK(screen.styleAt(0, 4).foreground.has_value());
 }
 
 TEST_CASE("AnsiProcessor reset clears state but not screen", "[AnsiProcessor][reset]") {
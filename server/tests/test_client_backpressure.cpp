@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/ClientBackpressure.h"
+#include <termihui/protocol/protocol.h>
+
+namespace {
+
+using MessageClass = WebSocketServer::MessageClass;
+using OutgoingMessage = WebSocketServer::OutgoingMessage;
+
+constexpr size_t budget = 1000;
+
+OutgoingMessage makeMessage(MessageClass messageClass, uint64_t sessionId = 1) {
+    return OutgoingMessage{0, "{}", messageClass, sessionId};
+}
+
+} // anonymous namespace
+
+TEST_CASE("ClientBackpressure delivers everything within budget", "[ClientBackpressure]") {
+    ClientBackpressure clientBackpressure(budget);
+    std::vector<std::string> preamble;
+
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::Control), 0, preamble));
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::ScreenUpdate), budget, preamble));
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::ScreenSnapshot), budget, preamble));
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::OutputLine), budget, preamble));
+    CHECK(preamble.empty());
+    CHECK(clientBackpressure.isIdle());
+}
+
+TEST_CASE("ClientBackpressure always delivers control messages", "[ClientBackpressure]") {
+    ClientBackpressure clientBackpressure(budget);
+    std::vector<std::string> preamble;
+
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::Control), budget * 100, preamble));
+    CHECK(clientBackpressure.isIdle());
+}
+
+TEST_CASE("ClientBackpressure drops screen updates until snapshot", "[ClientBackpressure]") {
+    ClientBackpressure clientBackpressure(budget);
+    std::vector<std::string> preamble;
+    std::vector<std::string> markers;
+    std::vector<uint64_t> resyncSessions;
+
+    // Over budget: update dropped, session 1 becomes stale
+    CHECK_FALSE(clientBackpressure.admit(makeMessage(MessageClass::ScreenUpdate, 1), budget + 1, preamble));
+    CHECK_FALSE(clientBackpressure.isIdle());
+
+    // Later updates are relative to a state client doesn't have: dropped even when drained
+    CHECK_FALSE(clientBackpressure.admit(makeMessage(MessageClass::ScreenUpdate, 1), 0, preamble));
+
+    // Other sessions are unaffected
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::ScreenUpdate, 2), 0, preamble));
+
+    // Not caught up yet: no resync
+    clientBackpressure.poll(budget, markers, resyncSessions);
+    CHECK(resyncSessions.empty());
+
+    // Caught up: resync requested exactly once
+    clientBackpressure.poll(budget / 2, markers, resyncSessions);
+    CHECK(resyncSessions == std::vector<uint64_t>{1});
+    clientBackpressure.poll(0, markers, resyncSessions);
+    CHECK(resyncSessions == std::vector<uint64_t>{1});
+    CHECK(markers.empty());
+
+    // Snapshot ends resync
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::ScreenSnapshot, 1), 0, preamble));
+    CHECK(clientBackpressure.isIdle());
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::ScreenUpdate, 1), 0, preamble));
+}
+
+TEST_CASE("ClientBackpressure requests resync again when snapshot is dropped", "[ClientBackpressure]") {
+    ClientBackpressure clientBackpressure(budget);
+    std::vector<std::string> preamble;
+    std::vector<std::string> markers;
+    std::vector<uint64_t> resyncSessions;
+
+    CHECK_FALSE(clientBackpressure.admit(makeMessage(MessageClass::ScreenUpdate), budget + 1, preamble));
+    clientBackpressure.poll(0, markers, resyncSessions);
+    REQUIRE(resyncSessions.size() == 1);
+
+    // Client fell behind again before snapshot went out
+    CHECK_FALSE(clientBackpressure.admit(makeMessage(MessageClass::ScreenSnapshot), budget + 1, preamble));
+    clientBackpressure.poll(0, markers, resyncSessions);
+    CHECK(resyncSessions.size() == 2);
+}
+
+TEST_CASE("ClientBackpressure collapses skipped output lines into marker", "[ClientBackpressure]") {
+    ClientBackpressure clientBackpressure(budget);
+    std::vector<std::string> preamble;
+    std::vector<std::string> markers;
+    std::vector<uint64_t> resyncSessions;
+
+    // Output lines have a larger allowance than screen updates
+    size_t outputLineLimit = budget * ClientBackpressure::outputLineBudgetFactor;
+    CHECK(clientBackpressure.admit(makeMessage(MessageClass::OutputLine), outputLineLimit, preamble));
+
+    // Beyond it lines are counted; once skipping, lines stay skipped until client caught up
+    CHECK_FALSE(clientBackpressure.admit(makeMessage(MessageClass::OutputLine), outputLineLimit + 1, preamble));
+    CHECK_FALSE(clientBackpressure.admit(makeMessage(MessageClass::OutputLine), budget, preamble));
+    CHECK_FALSE(clientBackpressure.admit(makeMessage(MessageClass::OutputLine), budget, preamble));
+    CHECK(preamble.empty());
+
+    SECTION("next line after catching up is preceded by marker") {
+        CHECK(clientBackpressure.admit(makeMessage(MessageClass::OutputLine), 0, preamble));
+        REQUIRE(preamble.size() == 1);
+        CHECK(preamble[0] == serialize(OutputSkippedMessage{1, 3}));
+        CHECK(clientBackpressure.isIdle());
+    }
+
+    SECTION("poll releases marker when no more lines arrive") {
+        clientBackpressure.poll(0, markers, resyncSessions);
+        REQUIRE(markers.size() == 1);
+        CHECK(markers[0] == serialize(OutputSkippedMessage{1, 3}));
+        CHECK(resyncSessions.empty());
+        CHECK(clientBackpressure.isIdle());
+    }
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/EventLoop.h"
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+
+// =============================================================================
+// Readiness Dispatch Tests
+// =============================================================================
+
+TEST_CASE("EventLoop wait with nothing ready returns zero", "[EventLoop]") {
+    EventLoop eventLoop;
+
+    CHECK(eventLoop.wait(0) == 0);
+}
+
+TEST_CASE("EventLoop dispatches readable descriptor", "[EventLoop]") {
+    EventLoop eventLoop;
+    int pipeFds[2];
+    REQUIRE(pipe(pipeFds) == 0);
+
+    uint32_t reportedEvents = 0;
+    int callCount = 0;
+    REQUIRE(eventLoop.watch(pipeFds[0], EventLoop::Readable, [&](uint32_t events) {
+        reportedEvents = events;
+        ++callCount;
+    }));
+
+    CHECK(eventLoop.wait(0) == 0);
+    CHECK(callCount == 0);
+
+    REQUIRE(write(pipeFds[1], "x", 1) == 1);
+    CHECK(eventLoop.wait(100) == 1);
+    CHECK(callCount == 1);
+    CHECK((reportedEvents & EventLoop::Readable) != 0);
+
+    eventLoop.unwatch(pipeFds[0]);
+    CHECK_FALSE(eventLoop.isWatching(pipeFds[0]));
+    CHECK(eventLoop.wait(0) == 0);
+    CHECK(callCount == 1);
+
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
+
+TEST_CASE("EventLoop reports hangup when writer closes", "[EventLoop]") {
+    EventLoop eventLoop;
+    int pipeFds[2];
+    REQUIRE(pipe(pipeFds) == 0);
+
+    uint32_t reportedEvents = 0;
+    eventLoop.watch(pipeFds[0], EventLoop::Readable, [&](uint32_t events) {
+        reportedEvents = events;
+    });
+
+    close(pipeFds[1]);
+    CHECK(eventLoop.wait(100) == 1);
+    CHECK((reportedEvents & EventLoop::Hangup) != 0);
+
+    eventLoop.unwatch(pipeFds[0]);
+    close(pipeFds[0]);
+}
+
+TEST_CASE("EventLoop callback can unwatch its own descriptor", "[EventLoop]") {
+    EventLoop eventLoop;
+    int pipeFds[2];
+    REQUIRE(pipe(pipeFds) == 0);
+    REQUIRE(write(pipeFds[1], "x", 1) == 1);
+
+    int callCount = 0;
+    eventLoop.watch(pipeFds[0], EventLoop::Readable, [&](uint32_t) {
+        ++callCount;
+        eventLoop.unwatch(pipeFds[0]);
+    });
+
+    CHECK(eventLoop.wait(100) == 1);
+    CHECK(eventLoop.wait(0) == 0);
+    CHECK(callCount == 1);
+
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
+
+// =============================================================================
+// Wakeup Tests
+// =============================================================================
+
+TEST_CASE("EventLoop wakeup from another thread interrupts wait", "[EventLoop][wakeup]") {
+    EventLoop eventLoop;
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread waker([&eventLoop]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        eventLoop.wakeup();
+    });
+
+    // Wakeups are not counted as dispatched callbacks
+    CHECK(eventLoop.wait(5000) == 0);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    waker.join();
+
+    CHECK(elapsed < std::chrono::seconds(2));
+}
+
+TEST_CASE("EventLoop pending wakeup is consumed by a single wait", "[EventLoop][wakeup]") {
+    EventLoop eventLoop;
+
+    eventLoop.wakeup();
+    eventLoop.wakeup();
+    eventLoop.wait(0);
+
+    auto start = std::chrono::steady_clock::now();
+    eventLoop.wait(50);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    CHECK(elapsed >= std::chrono::milliseconds(40));
+}
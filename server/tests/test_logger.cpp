@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/Logger.h"
+#include <cstdio>
+#include <string>
+
+namespace {
+
+/**
+ * Redirect logger into temporary files for the duration of a test
+ */
+class CapturedLog {
+public:
+    CapturedLog()
+        : out(tmpfile())
+        , err(tmpfile())
+    {
+        Logger::instance().setOutput(this->out, this->err);
+    }
+
+    ~CapturedLog() {
+        Logger::instance().setOutput(nullptr, nullptr);
+        Logger::instance().setLevel(LogLevel::Info);
+        fclose(this->out);
+        fclose(this->err);
+    }
+
+    std::string getOut() { return read(this->out); }
+    std::string getErr() { return read(this->err); }
+
+private:
+    static std::string read(FILE* file) {
+        Logger::instance().flush();
+        std::string content;
+        rewind(file);
+        char buffer[1024];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            content.append(buffer, count);
+        }
+        return content;
+    }
+
+    FILE* out;
+    FILE* err;
+};
+
+} // anonymous namespace
+
+TEST_CASE("Logger filters lines by category level", "[Logger]") {
+    CapturedLog capturedLog;
+    auto& logger = Logger::instance();
+    logger.setLevel(LogLevel::Info);
+    logger.setLevel(LogCategory::Ws, LogLevel::Debug);
+
+    LOG_DEBUG(LogCategory::Ws, "message from {}", 7);
+    LOG_DEBUG(LogCategory::Pty, "hidden");
+    LOG_INFO(LogCategory::Storage, "opened {}", "db");
+    LOG_ERROR(LogCategory::Ai, "request failed");
+
+    CHECK(capturedLog.getOut() == "[ws] debug: message from 7\n[storage] opened db\n");
+    CHECK(capturedLog.getErr() == "[ai] error: request failed\n");
+}
+
+TEST_CASE("Disabled log lines don't evaluate arguments", "[Logger]") {
+    CapturedLog capturedLog;
+    auto& logger = Logger::instance();
+    int evaluations = 0;
+    auto expensive = [&evaluations]() {
+        ++evaluations;
+        return std::string("payload");
+    };
+
+    logger.setLevel(LogCategory::Pty, LogLevel::Info);
+    LOG_DEBUG(LogCategory::Pty, "{}", expensive());
+    CHECK(evaluations == 0);
+
+    // Trace calls are compiled out of release builds regardless of runtime level
+    logger.setLevel(LogCategory::Pty, LogLevel::Trace);
+    LOG_TRACE(LogCategory::Pty, "{}", expensive());
+    CHECK(evaluations == TERMIHUI_TRACE_LOG_ENABLED);
+}
+
+TEST_CASE("Logger level spec", "[Logger]") {
+    auto& logger = Logger::instance();
+
+    REQUIRE(logger.configure("warn,pty=trace,ws=debug"));
+    CHECK(logger.isEnabled(LogCategory::Pty, LogLevel::Trace));
+    CHECK(logger.isEnabled(LogCategory::Ws, LogLevel::Debug));
+    CHECK_FALSE(logger.isEnabled(LogCategory::Ws, LogLevel::Trace));
+    CHECK_FALSE(logger.isEnabled(LogCategory::Storage, LogLevel::Info));
+    CHECK(logger.isEnabled(LogCategory::Storage, LogLevel::Warn));
+
+    // Invalid spec changes nothing
+    CHECK_FALSE(logger.configure("info,bogus=debug"));
+    CHECK_FALSE(logger.configure("pty=loud"));
+    CHECK_FALSE(logger.isEnabled(LogCategory::Storage, LogLevel::Info));
+
+    REQUIRE(logger.configure("off"));
+    CHECK_FALSE(logger.isEnabled(LogCategory::Ai, LogLevel::Error));
+
+    logger.setLevel(LogLevel::Info);
+}
+
+TEST_CASE("Logger escapes control characters", "[Logger]") {
+    CHECK(Logger::escape("ls\r\n") == "ls\\r\\n");
+    CHECK(Logger::escape("\x1b]133;B\x07") == "\\e]133;B\\a");
+    CHECK(Logger::escape(std::string_view("a\0b\x7f", 4)) == "a\\x00b\x7f");
+    CHECK(Logger::escape("") == "");
+}
@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/OutboundDispatcher.h"
+#include <string>
+#include <vector>
+
+namespace {
+
+using MessageClass = WebSocketServer::MessageClass;
+using OutgoingMessage = WebSocketServer::OutgoingMessage;
+
+constexpr size_t budget = 1000;
+
+/**
+ * Connection recording the frames written to it
+ */
+class ConnectionMock : public OutboundDispatcher::Connection {
+public:
+    size_t pendingBytesValue = 0;
+    std::vector<OutboundDispatcher::SharedFrame> frames;
+
+    size_t pendingBytes() const override { return this->pendingBytesValue; }
+
+    bool write(const OutboundDispatcher::SharedFrame& frame) override {
+        this->frames.push_back(frame);
+        return true;
+    }
+
+    /**
+     * Payloads of written frames (unmasked text frames end with the payload)
+     */
+    std::vector<std::string> payloads() const {
+        std::vector<std::string> result;
+        for (const auto& frame : this->frames) {
+            uint8_t length = static_cast<uint8_t>((*frame)[1]) & 0x7F;
+            size_t headerSize = length < 126 ? 2 : length == 126 ? 4 : 10;
+            result.push_back(frame->substr(headerSize));
+        }
+        return result;
+    }
+};
+
+struct Clients {
+    std::shared_ptr<ConnectionMock> first = std::make_shared<ConnectionMock>();
+    std::shared_ptr<ConnectionMock> second = std::make_shared<ConnectionMock>();
+    std::shared_ptr<ConnectionMock> third = std::make_shared<ConnectionMock>();
+    OutboundDispatcher::Connections connections{{1, first}, {2, second}, {3, third}};
+};
+
+} // anonymous namespace
+
+TEST_CASE("OutboundDispatcher frames broadcast once for all clients", "[OutboundDispatcher]") {
+    OutboundDispatcher dispatcher(budget);
+    Clients clients;
+    std::vector<WebSocketServer::ResyncRequest> resyncRequests;
+    const std::string payload = R"({"type":"status","running":true})";
+
+    dispatcher.dispatch({OutgoingMessage{0, payload}}, clients.connections, resyncRequests);
+
+    REQUIRE(clients.first->frames.size() == 1);
+    REQUIRE(clients.second->frames.size() == 1);
+    REQUIRE(clients.third->frames.size() == 1);
+    // One frame object shared by every recipient
+    CHECK(clients.first->frames[0] == clients.second->frames[0]);
+    CHECK(clients.first->frames[0] == clients.third->frames[0]);
+    const std::string& frame = *clients.first->frames[0];
+    CHECK(static_cast<uint8_t>(frame[0]) == 0x81);  // FIN + text
+    CHECK(static_cast<uint8_t>(frame[1]) == payload.size());  // Unmasked, short length
+    CHECK(clients.first->payloads() == std::vector<std::string>{payload});
+
+    auto stats = dispatcher.getStats();
+    CHECK(stats.messagesSent == 3);
+    CHECK(stats.bytesSent == 3 * frame.size());
+    CHECK(resyncRequests.empty());
+}
+
+TEST_CASE("OutboundDispatcher frames large payloads with extended length", "[OutboundDispatcher]") {
+    OutboundDispatcher dispatcher(budget * 1000);
+    Clients clients;
+    std::vector<WebSocketServer::ResyncRequest> resyncRequests;
+    const std::string payload(70000, 'x');
+
+    dispatcher.dispatch({OutgoingMessage{0, payload, MessageClass::ScreenSnapshot, 1}}, clients.connections, resyncRequests);
+
+    REQUIRE(clients.second->frames.size() == 1);
+    CHECK(clients.second->frames[0] == clients.third->frames[0]);
+    CHECK(clients.second->frames[0]->size() == payload.size() + 10);
+    CHECK(clients.second->payloads() == std::vector<std::string>{payload});
+}
+
+TEST_CASE("OutboundDispatcher sends session broadcasts to subscribers", "[OutboundDispatcher]") {
+    OutboundDispatcher dispatcher(budget);
+    Clients clients;
+    std::vector<WebSocketServer::ResyncRequest> resyncRequests;
+
+    // Client 1 watches session 7, client 2 watches nothing, client 3 never subscribed
+    dispatcher.subscribe(1, 7);
+    dispatcher.subscribe(2, 7);
+    dispatcher.unsubscribe(2, 7);
+
+    dispatcher.dispatch({
+        OutgoingMessage{0, "update", MessageClass::ScreenUpdate, 7},
+        OutgoingMessage{2, "direct"},
+    }, clients.connections, resyncRequests);
+
+    CHECK(clients.first->payloads() == std::vector<std::string>{"update"});
+    CHECK(clients.second->payloads() == std::vector<std::string>{"direct"});
+    CHECK(clients.third->payloads() == std::vector<std::string>{"update"});
+    CHECK(clients.first->frames[0] == clients.third->frames[0]);
+
+    auto stats = dispatcher.getStats();
+    CHECK(stats.messagesSent == 3);
+    CHECK(stats.messagesFiltered == 1);
+    CHECK(stats.bytesFiltered == 6);
+}
+
+TEST_CASE("OutboundDispatcher applies backpressure per client and message class", "[OutboundDispatcher]") {
+    OutboundDispatcher dispatcher(budget);
+    Clients clients;
+    std::vector<WebSocketServer::ResyncRequest> resyncRequests;
+
+    // Client 2 can't keep up
+    clients.second->pendingBytesValue = budget * 10;
+
+    dispatcher.dispatch({
+        OutgoingMessage{0, "update", MessageClass::ScreenUpdate, 1},
+        OutgoingMessage{0, "line", MessageClass::OutputLine, 1},
+        OutgoingMessage{0, "control"},
+    }, clients.connections, resyncRequests);
+
+    // Fast clients get everything, through the same frames
+    CHECK(clients.first->payloads() == std::vector<std::string>{"update", "line", "control"});
+    CHECK(clients.third->payloads() == std::vector<std::string>{"update", "line", "control"});
+    // Slow client only gets control messages, sharing their frame too
+    REQUIRE(clients.second->payloads() == std::vector<std::string>{"control"});
+    CHECK(clients.second->frames[0] == clients.first->frames[2]);
+    CHECK(resyncRequests.empty());
+
+    // Still behind: nothing released
+    dispatcher.dispatch({}, clients.connections, resyncRequests);
+    CHECK(clients.second->frames.size() == 1);
+    CHECK(resyncRequests.empty());
+
+    // Drained: skipped lines are announced and the screen is resynced
+    clients.second->pendingBytesValue = 0;
+    dispatcher.dispatch({}, clients.connections, resyncRequests);
+    REQUIRE(clients.second->frames.size() == 2);
+    CHECK(clients.second->payloads()[1].find("output_skipped") != std::string::npos);
+    REQUIRE(resyncRequests.size() == 1);
+    CHECK(resyncRequests[0].clientId == 2);
+    CHECK(resyncRequests[0].sessionId == 1);
+
+    // Caught up: updates flow again after the snapshot
+    dispatcher.dispatch({
+        OutgoingMessage{0, "snapshot", MessageClass::ScreenSnapshot, 1},
+        OutgoingMessage{0, "next", MessageClass::ScreenUpdate, 1},
+    }, clients.connections, resyncRequests);
+    CHECK(clients.second->payloads().back() == "next");
+    CHECK(clients.second->frames.back() == clients.first->frames.back());
+}
+
+TEST_CASE("OutboundDispatcher forgets disconnected clients", "[OutboundDispatcher]") {
+    OutboundDispatcher dispatcher(budget);
+    Clients clients;
+    std::vector<WebSocketServer::ResyncRequest> resyncRequests;
+
+    clients.second->pendingBytesValue = budget * 10;
+    dispatcher.dispatch({OutgoingMessage{0, "update", MessageClass::ScreenUpdate, 1}}, clients.connections, resyncRequests);
+
+    // Client 2 disconnects while behind: its stale screen is forgotten, no resync
+    clients.connections.erase(2);
+    dispatcher.dispatch({}, clients.connections, resyncRequests);
+    CHECK(resyncRequests.empty());
+
+    // Connection that gets the same ID starts without that state
+    auto reconnected = std::make_shared<ConnectionMock>();
+    clients.connections[2] = reconnected;
+    dispatcher.dispatch({OutgoingMessage{0, "update", MessageClass::ScreenUpdate, 1}}, clients.connections, resyncRequests);
+    CHECK(reconnected->payloads() == std::vector<std::string>{"update"});
+    CHECK(clients.second->frames.empty());
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/ProcessReaper.h"
+#include "../src/SessionWorker.h"
+#include <chrono>
+#include <csignal>
+#include <filesystem>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+/**
+ * Fork child that waits for signals forever
+ * Returns once child has set up its SIGTERM disposition (test runner's handlers are inherited until then).
+ */
+pid_t forkSleeper(bool ignoreSigterm) {
+    int readyPipe[2];
+    if (pipe(readyPipe) != 0) {
+        return -1;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        signal(SIGTERM, ignoreSigterm ? SIG_IGN : SIG_DFL);
+        ssize_t ignored = write(readyPipe[1], "x", 1);
+        (void)ignored;
+        for (;;) {
+            pause();
+        }
+    }
+    close(readyPipe[1]);
+    char ready;
+    ssize_t ignored = read(readyPipe[0], &ready, 1);
+    (void)ignored;
+    close(readyPipe[0]);
+    return pid;
+}
+
+int openExitFd(pid_t pid) {
+#ifdef SYS_pidfd_open
+    return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    (void)pid;
+    return -1;
+#endif
+}
+
+/**
+ * Drive reaper the way SessionWorker does until all children are gone
+ */
+bool runUntilReaped(EventLoop& eventLoop, ProcessReaper& processReaper, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (processReaper.getPendingCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        eventLoop.wait(processReaper.nextTimeoutMs());
+        processReaper.processTimers();
+    }
+    return processReaper.getPendingCount() == 0;
+}
+
+} // anonymous namespace
+
+TEST_CASE("ProcessReaper reaps terminated child without blocking", "[ProcessReaper]") {
+    EventLoop eventLoop;
+    ProcessReaper processReaper(eventLoop, 5s);
+
+    pid_t pid = forkSleeper(false);
+    REQUIRE(pid > 0);
+
+    int exitFd = -1;
+    SECTION("exit reported through exit descriptor") {
+        exitFd = openExitFd(pid);
+    }
+    SECTION("exit detected by polling") {
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    processReaper.terminate(pid, exitFd);
+    CHECK(std::chrono::steady_clock::now() - start < 50ms);
+
+    CHECK(runUntilReaped(eventLoop, processReaper, 2000ms));
+    CHECK(processReaper.nextTimeoutMs() == -1);
+    CHECK(kill(pid, 0) == -1);
+}
+
+TEST_CASE("ProcessReaper kills child ignoring SIGTERM after grace period", "[ProcessReaper]") {
+    EventLoop eventLoop;
+    ProcessReaper processReaper(eventLoop, 200ms);
+
+    pid_t pid = forkSleeper(true);
+    REQUIRE(pid > 0);
+
+    auto start = std::chrono::steady_clock::now();
+    processReaper.terminate(pid, openExitFd(pid));
+    CHECK(processReaper.getPendingCount() == 1);
+
+    REQUIRE(runUntilReaped(eventLoop, processReaper, 2000ms));
+    CHECK(std::chrono::steady_clock::now() - start >= 200ms);
+}
+
+TEST_CASE("SessionWorker removes session without waiting for shell", "[ProcessReaper][SessionWorker]") {
+    EventLoop eventLoop;
+    SessionWorker sessionWorker(eventLoop, [](TerminalSessionController& session) {
+        session.readOutput();
+    });
+
+    auto dbPath = std::filesystem::temp_directory_path() / "test_process_reaper_session.sqlite";
+    std::filesystem::remove(dbPath);
+    auto session = std::make_unique<TerminalSessionController>(dbPath, 11, 1);
+    REQUIRE(session->createSession());
+    sessionWorker.addSession(std::move(session));
+
+    auto start = std::chrono::steady_clock::now();
+    sessionWorker.removeSession(11);
+    CHECK(std::chrono::steady_clock::now() - start < 50ms);
+    CHECK(sessionWorker.getSessionCount() == 0);
+
+    // Shell goes away on hangup; reaped from the loop
+    auto deadline = std::chrono::steady_clock::now() + 3s;
+    while (sessionWorker.getTerminatingCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        eventLoop.wait(sessionWorker.nextTimeoutMs());
+        sessionWorker.processTimers();
+    }
+    CHECK(sessionWorker.getTerminatingCount() == 0);
+    std::filesystem::remove(dbPath);
+}
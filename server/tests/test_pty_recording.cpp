@@ -0,0 +1,158 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/PtyRecording.h"
+#include "TermihuiServerControllerTestable.h"
+#include "TerminalSessionControllerMock.h"
+#include "WebSocketServerMock.h"
+#include "AIAgentControllerMock.h"
+#include "ServerStorageMock.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+std::vector<PtyRecording::Record> readAll(PtyRecording::Reader& reader) {
+    std::vector<PtyRecording::Record> records;
+    PtyRecording::Record record;
+    while (reader.next(record)) {
+        records.push_back(record);
+    }
+    return records;
+}
+
+} // anonymous namespace
+
+TEST_CASE("PtyRecording round trip", "[PtyRecording]") {
+    auto path = std::filesystem::temp_directory_path() / "test_pty_recording.ptyrec";
+    const std::string binaryChunk("\x1b[1mbold\x1b[0m\0\xff", 14);
+    auto start = PtyRecording::Clock::now();
+    {
+        PtyRecording::Writer writer;
+        REQUIRE(writer.open(path, 24, 80, start));
+        writer.writeOutput("hello\r\n", start + 1500us);
+        writer.writeResize(50, 200, start + 2s);
+        writer.writeOutput(binaryChunk, start + 2s);
+        writer.writeOutput("", start + 3s);  // Nothing read: not recorded
+        writer.close();
+    }
+
+    PtyRecording::Reader reader;
+    REQUIRE(reader.open(path));
+    CHECK(reader.rows() == 24);
+    CHECK(reader.columns() == 80);
+
+    auto records = readAll(reader);
+    REQUIRE(records.size() == 3);
+    CHECK(records[0].kind == PtyRecording::Record::Kind::Output);
+    CHECK(records[0].delay == 1500us);
+    CHECK(records[0].bytes == "hello\r\n");
+    CHECK(records[1].kind == PtyRecording::Record::Kind::Resize);
+    CHECK(records[1].delay == 1998500us);
+    CHECK(records[1].rows == 50);
+    CHECK(records[1].columns == 200);
+    CHECK(records[2].kind == PtyRecording::Record::Kind::Output);
+    CHECK(records[2].delay == 0us);
+    CHECK(records[2].bytes == binaryChunk);
+
+    SECTION("record cut off by a crash is dropped") {
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+        PtyRecording::Reader truncated;
+        REQUIRE(truncated.open(path));
+        CHECK(readAll(truncated).size() == 2);
+    }
+
+    SECTION("other files are rejected") {
+        std::ofstream(path, std::ios::trunc) << "not a recording";
+        PtyRecording::Reader other;
+        CHECK_FALSE(other.open(path));
+        CHECK_FALSE(other.open(std::filesystem::temp_directory_path() / "test_pty_recording_missing.ptyrec"));
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Session recording replays to the same screen", "[PtyRecording][processTerminalOutput]") {
+    auto path = std::filesystem::temp_directory_path() / "test_pty_recording_session.ptyrec";
+    // UTF-8 character split between reads: its first byte is retained, not recorded twice
+    const std::vector<std::string> chunks = {
+        "\x1b]133;A\x07$ ls\r\n",
+        "caf\xC3",
+        "\xA9 \x1b[31mred\x1b[0m\r\nline two\r\n",
+    };
+
+    auto runSession = [](TerminalSessionControllerMock& session, const std::vector<std::string>& output) {
+        TermihuiServerControllerTestable controller(std::make_unique<WebSocketServerMock>(),
+                                                    std::make_unique<AIAgentControllerMock>(),
+                                                    std::make_unique<ServerStorageMock>());
+        for (const auto& chunk : output) {
+            session.readOutputReturnValues.push(chunk);
+            session.hasDataReturnValue = true;
+            controller.processTerminalOutput(session);
+        }
+    };
+
+    TerminalSessionControllerMock recorded;
+    REQUIRE(recorded.startRecording(path));
+    CHECK(recorded.isRecording());
+    runSession(recorded, chunks);
+    recorded.stopRecording();
+    CHECK_FALSE(recorded.isRecording());
+
+    PtyRecording::Reader reader;
+    REQUIRE(reader.open(path));
+    CHECK(reader.rows() == recorded.getVirtualScreen().rows());
+    CHECK(reader.columns() == recorded.getVirtualScreen().columns());
+    std::vector<std::string> replayedChunks;
+    for (auto& record : readAll(reader)) {
+        REQUIRE(record.kind == PtyRecording::Record::Kind::Output);
+        replayedChunks.push_back(record.bytes);
+    }
+    CHECK(replayedChunks == chunks);
+
+    TerminalSessionControllerMock replayed;
+    runSession(replayed, replayedChunks);
+    for (size_t row = 0; row < recorded.getVirtualScreen().rows(); ++row) {
+        CHECK(replayed.getVirtualScreen().getRowSegments(row) == recorded.getVirtualScreen().getRowSegments(row));
+    }
+    CHECK(replayed.getVirtualScreen().cursorRow() == recorded.getVirtualScreen().cursorRow());
+    CHECK(replayed.getVirtualScreen().cursorColumn() == recorded.getVirtualScreen().cursorColumn());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Session recording keeps only output passed on", "[PtyRecording][processTerminalOutput]") {
+    auto path = std::filesystem::temp_directory_path() / "test_pty_recording_hidden.ptyrec";
+    TermihuiServerControllerTestable controller(std::make_unique<WebSocketServerMock>(),
+                                                std::make_unique<AIAgentControllerMock>(),
+                                                std::make_unique<ServerStorageMock>());
+    TerminalSessionControllerMock session;
+    auto feed = [&](const std::string& chunk) {
+        session.readOutputReturnValues.push(chunk);
+        session.hasDataReturnValue = true;
+        controller.processTerminalOutput(session);
+    };
+    
+    REQUIRE(session.startRecording(path));
+    session.hideOutputOfNextCommand();
+    // Hidden cd, its prompt marker split across reads: the held back start of the marker
+    // was never passed on, so it is recorded with the rest of the marker
+    feed("cd /tmp\r\n\x1b]13");
+    feed("3;B$ ");
+    // UTF-8 character split between reads: its retained first byte is not recorded twice
+    feed("caf\xC3");
+    feed("\xA9\r\n");
+    session.stopRecording();
+    
+    PtyRecording::Reader reader;
+    REQUIRE(reader.open(path));
+    std::vector<std::string> recordedChunks;
+    for (auto& record : readAll(reader)) {
+        recordedChunks.push_back(record.bytes);
+    }
+    CHECK(recordedChunks == std::vector<std::string>{"\x1b]133;B$ ", "caf\xC3", "\xA9\r\n"});
+    
+    std::filesystem::remove(path);
+}
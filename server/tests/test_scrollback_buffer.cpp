@@ -0,0 +1,101 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/ScrollbackBuffer.h"
+#include <string>
+
+namespace {
+
+std::vector<StyledSegment> makeLine(const std::string& text, std::optional<int> colorIndex = std::nullopt) {
+    TextStyle style;
+    if (colorIndex) {
+        style.foreground = Color::indexed(*colorIndex);
+    }
+    return {StyledSegment{text, style}};
+}
+
+} // anonymous namespace
+
+TEST_CASE("ScrollbackBuffer returns lines of command in order", "[ScrollbackBuffer]") {
+    ScrollbackBuffer scrollback;
+
+    std::vector<StyledSegment> styled = {
+        StyledSegment{"error: ", TextStyle{}},
+        StyledSegment{"файл", makeLine("", 1)[0].style},
+    };
+    scrollback.append(7, makeLine("first"));
+    scrollback.append(8, makeLine("other command"));
+    scrollback.append(7, styled);
+    scrollback.append(7, {});
+
+    auto lines = scrollback.commandLines(7);
+    REQUIRE(lines.has_value());
+    REQUIRE(lines->size() == 3);
+    CHECK((*lines)[0] == makeLine("first"));
+    CHECK((*lines)[1] == styled);
+    CHECK((*lines)[2].empty());
+
+    CHECK(scrollback.commandLines(8)->size() == 1);
+    CHECK_FALSE(scrollback.commandLines(9).has_value());
+    CHECK(scrollback.lineCount() == 4);
+}
+
+TEST_CASE("ScrollbackBuffer evicts oldest pages over line limit", "[ScrollbackBuffer]") {
+    ScrollbackBuffer scrollback(ScrollbackBuffer::Limits{1000, 64 * 1024 * 1024});
+    std::string text(100, 'x');
+
+    for (int i = 0; i < 2000; ++i) {
+        scrollback.append(i < 1500 ? 1 : 2, makeLine(text));
+    }
+
+    // Whole pages go: at most one page worth of lines under the limit
+    CHECK(scrollback.lineCount() <= 1000);
+    CHECK(scrollback.lineCount() > 1000 - ScrollbackBuffer::pageBytes / 100);
+
+    // Command 1 lost its first lines: not served from memory anymore
+    CHECK_FALSE(scrollback.commandLines(1).has_value());
+    REQUIRE(scrollback.commandLines(2).has_value());
+    CHECK(scrollback.commandLines(2)->size() == 500);
+}
+
+TEST_CASE("ScrollbackBuffer evicts over byte limit and reports memory", "[ScrollbackBuffer]") {
+    ScrollbackBuffer scrollback(ScrollbackBuffer::Limits{1000000, 64 * 1024});
+    std::string text(200, 'y');
+
+    for (int i = 0; i < 5000; ++i) {
+        scrollback.append(1, makeLine(text));
+    }
+
+    CHECK(scrollback.payloadBytes() <= 64 * 1024 + ScrollbackBuffer::pageBytes + 256);
+    CHECK(scrollback.memoryUsage() >= scrollback.payloadBytes());
+    CHECK(scrollback.memoryUsage() < 200 * 1024);
+
+    scrollback.clear();
+    CHECK(scrollback.lineCount() == 0);
+    CHECK(scrollback.payloadBytes() == 0);
+}
+
+TEST_CASE("ScrollbackBuffer disabled by zero limit", "[ScrollbackBuffer]") {
+    ScrollbackBuffer scrollback;
+    scrollback.append(1, makeLine("kept"));
+
+    scrollback.setLimits(ScrollbackBuffer::Limits{0, 1024});
+    scrollback.append(1, makeLine("dropped"));
+
+    CHECK(scrollback.lineCount() == 0);
+    CHECK_FALSE(scrollback.commandLines(1).has_value());
+}
+
+TEST_CASE("ScrollbackBuffer keeps styles when style table fills", "[ScrollbackBuffer]") {
+    ScrollbackBuffer scrollback(ScrollbackBuffer::Limits{1000, 64 * 1024 * 1024});
+
+    // Far more distinct styles than ids: old ones get evicted and their ids reused
+    for (int i = 0; i < 70000; ++i) {
+        TextStyle style;
+        style.foreground = Color::rgb(i & 0xFF, (i >> 8) & 0xFF, (i >> 16) & 0xFF);
+        scrollback.append(static_cast<uint64_t>(i / 100), {StyledSegment{"z", style}});
+    }
+
+    auto lines = scrollback.commandLines(699);
+    REQUIRE(lines.has_value());
+    REQUIRE(lines->size() == 100);
+    CHECK((*lines)[99][0].style.foreground == Color::rgb(69999 & 0xFF, (69999 >> 8) & 0xFF, 69999 >> 16));
+}
@@ -0,0 +1,153 @@
+#include <catch2/catch_test_macros.hpp>
+#include "SessionWorker.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+/**
+ * Poll predicate until it holds or timeout expires
+ */
+template<typename Predicate>
+bool waitFor(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::milliseconds(5000)) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (predicate()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return predicate();
+}
+
+std::unique_ptr<TerminalSessionController> makeSession(uint64_t sessionId) {
+    auto dbPath = std::filesystem::temp_directory_path() / ("test_session_worker_" + std::to_string(sessionId) + ".sqlite");
+    std::filesystem::remove(dbPath);
+    auto session = std::make_unique<TerminalSessionController>(dbPath, sessionId, 1);
+    REQUIRE(session->createSession());
+    return session;
+}
+
+} // anonymous namespace
+
+TEST_CASE("SessionWorker processes PTY output on worker thread", "[SessionWorker]") {
+    std::mutex outputMutex;
+    std::string output;
+    std::thread::id handlerThreadId;
+
+    SessionWorker sessionWorker([&](TerminalSessionController& session) {
+        std::lock_guard<std::mutex> lock(outputMutex);
+        handlerThreadId = std::this_thread::get_id();
+        output += session.readOutput();
+    });
+    sessionWorker.start();
+
+    sessionWorker.addSession(makeSession(7));
+    REQUIRE(waitFor([&]() { return sessionWorker.getSessionCount() == 1; }));
+
+    sessionWorker.post(7, [](TerminalSessionController& session) {
+        session.executeCommand("echo worker_marker_$((20+22))");
+    });
+
+    bool found = waitFor([&]() {
+        std::lock_guard<std::mutex> lock(outputMutex);
+        return output.find("worker_marker_42") != std::string::npos;
+    });
+    CHECK(found);
+
+    std::lock_guard<std::mutex> lock(outputMutex);
+    CHECK(handlerThreadId != std::this_thread::get_id());
+}
+
+TEST_CASE("SessionWorker runs tasks in order and drops tasks for unknown sessions", "[SessionWorker]") {
+    SessionWorker sessionWorker([](TerminalSessionController& session) {
+        session.readOutput();
+    });
+    sessionWorker.start();
+    sessionWorker.addSession(makeSession(8));
+
+    std::mutex orderMutex;
+    std::vector<int> order;
+    for (int i = 0; i < 5; ++i) {
+        sessionWorker.post(8, [&, i](TerminalSessionController&) {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(i);
+        });
+    }
+    std::atomic<bool> unknownTaskRan{false};
+    sessionWorker.post(999, [&](TerminalSessionController&) {
+        unknownTaskRan = true;
+    });
+
+    REQUIRE(waitFor([&]() {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        return order.size() == 5;
+    }));
+    CHECK(order == std::vector<int>{0, 1, 2, 3, 4});
+
+    sessionWorker.removeSession(8);
+    REQUIRE(waitFor([&]() { return sessionWorker.getSessionCount() == 0; }));
+    CHECK_FALSE(unknownTaskRan);
+}
+
+TEST_CASE("Inline SessionWorker runs tasks immediately", "[SessionWorker]") {
+    EventLoop eventLoop;
+    SessionWorker sessionWorker(eventLoop, [](TerminalSessionController& session) {
+        session.readOutput();
+    });
+
+    sessionWorker.addSession(makeSession(9));
+    CHECK(sessionWorker.getSessionCount() == 1);
+
+    bool taskRan = false;
+    sessionWorker.post(9, [&](TerminalSessionController& session) {
+        taskRan = session.getSessionId() == 9;
+    });
+    CHECK(taskRan);
+
+    sessionWorker.stop();
+    CHECK(sessionWorker.getSessionCount() == 0);
+}
+
+TEST_CASE("SessionWorker streams large input into PTY without losing bytes", "[SessionWorker]") {
+    auto outputPath = std::filesystem::temp_directory_path() / "test_session_worker_input.txt";
+    std::filesystem::remove(outputPath);
+
+    SessionWorker sessionWorker([](TerminalSessionController& session) {
+        session.readOutput();
+    });
+    sessionWorker.start();
+    sessionWorker.addSession(makeSession(10));
+
+    sessionWorker.post(10, [&](TerminalSessionController& session) {
+        session.executeCommand("cat > '" + outputPath.string() + "'");
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    // Far more than the PTY buffers: rest must be flushed as the PTY drains
+    std::string input;
+    for (int i = 0; i < 32 * 1024; ++i) {
+        input += "line of pasted text that has to arrive at cat in one piece....\n";
+    }
+    std::atomic<ssize_t> accepted{0};
+    sessionWorker.post(10, [&](TerminalSessionController& session) {
+        accepted = session.sendInput(input);
+        session.sendInput("\x04");  // EOF for cat once everything is through
+    });
+
+    bool complete = waitFor([&]() {
+        std::error_code error;
+        return std::filesystem::file_size(outputPath, error) == input.size();
+    }, std::chrono::milliseconds(20000));
+    CHECK(accepted == static_cast<ssize_t>(input.size()));
+    REQUIRE(complete);
+
+    std::ifstream file(outputPath, std::ios::binary);
+    std::string written((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    CHECK(written == input);
+    std::filesystem::remove(outputPath);
+}
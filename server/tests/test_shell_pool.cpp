@@ -0,0 +1,134 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/ShellPool.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+/**
+ * Drive pool the way TermihuiServerController does until enough shells are ready
+ */
+bool runUntilReady(EventLoop& eventLoop, ShellPool& shellPool, size_t readyCount, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (shellPool.getReadyCount() < readyCount && std::chrono::steady_clock::now() < deadline) {
+        int timeoutMs = shellPool.nextTimeoutMs();
+        eventLoop.wait(timeoutMs < 0 ? 50 : std::min(timeoutMs, 50));
+        shellPool.processTimers();
+    }
+    return shellPool.getReadyCount() >= readyCount;
+}
+
+/**
+ * Drive reaper the way SessionWorker does until all children are gone
+ */
+bool runUntilReaped(EventLoop& eventLoop, ProcessReaper& processReaper, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (processReaper.getPendingCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        eventLoop.wait(processReaper.nextTimeoutMs());
+        processReaper.processTimers();
+    }
+    return processReaper.getPendingCount() == 0;
+}
+
+std::string readFor(TerminalSessionController& session, std::chrono::milliseconds duration) {
+    std::string output;
+    auto deadline = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (session.hasData()) {
+            output += session.readOutput();
+        }
+        std::this_thread::sleep_for(20ms);
+    }
+    return output;
+}
+
+} // anonymous namespace
+
+TEST_CASE("ShellPool warms shells up to its size", "[ShellPool]") {
+    EventLoop eventLoop;
+    ShellPool shellPool(eventLoop);
+    CHECK(shellPool.nextTimeoutMs() == -1);
+    CHECK_FALSE(shellPool.claim());
+
+    shellPool.setSize(2);
+    CHECK(shellPool.nextTimeoutMs() == 0);
+    REQUIRE(runUntilReady(eventLoop, shellPool, 2, 5000ms));
+    CHECK(shellPool.getShellCount() == 2);
+
+    auto shell = shellPool.claim();
+    REQUIRE(shell);
+    CHECK(shell->ptyFd >= 0);
+    CHECK(shell->pid > 0);
+    CHECK(shellPool.getShellCount() == 1);
+
+    // Claimed shell is ours now
+    ProcessReaper processReaper(eventLoop);
+    close(shell->ptyFd);
+    processReaper.terminate(shell->pid, shell->exitFd);
+
+    shellPool.setSize(0);
+    CHECK(shellPool.getShellCount() == 0);
+}
+
+TEST_CASE("Session claimed from pool starts in restored cwd", "[ShellPool][TerminalSessionController][cwd]") {
+    EventLoop eventLoop;
+    ShellPool shellPool(eventLoop);
+    shellPool.setSize(1);
+    REQUIRE(runUntilReady(eventLoop, shellPool, 1, 5000ms));
+
+    auto dbPath = std::filesystem::temp_directory_path() / "test_shell_pool_cwd.sqlite";
+    std::filesystem::remove(dbPath);
+    {
+        TerminalSessionController session(dbPath, 1, 1);
+        session.setPendingCommand("cd /tmp");
+        session.startCommandInHistory("/some/initial/path");
+        session.finishCurrentCommand(0, "/tmp");
+
+        REQUIRE(session.createSession(&shellPool));
+        REQUIRE(session.isRunning());
+        CHECK(shellPool.getShellCount() == 0);
+
+        // Hidden cd is not shown: output starts at the prompt it ended with
+        std::string startOutput = readFor(session, 500ms);
+        INFO("Startup output: " << startOutput);
+        CHECK(startOutput.rfind("\x1b]133;B", 0) == 0);
+        CHECK(startOutput.find("__termihui_chdir") == std::string::npos);
+
+        REQUIRE(session.executeCommand("pwd").isOk());
+        std::string output = readFor(session, 1000ms);
+        INFO("Output: " << output);
+        CHECK(output.find("/tmp") != std::string::npos);
+
+        ProcessReaper processReaper(eventLoop);
+        auto child = session.releaseChild();
+        processReaper.terminate(child.pid, child.exitFd);
+        CHECK(runUntilReaped(eventLoop, processReaper, 5000ms));
+    }
+    std::filesystem::remove(dbPath);
+}
+
+TEST_CASE("Shell removes its rcfile after startup", "[ShellPool]") {
+    auto countRcFiles = [] {
+        size_t count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+            if (entry.path().filename().string().rfind("termihui_bashrc_", 0) == 0) {
+                ++count;
+            }
+        }
+        return count;
+    };
+    size_t before = countRcFiles();
+
+    EventLoop eventLoop;
+    ShellPool shellPool(eventLoop);
+    shellPool.setSize(3);
+    REQUIRE(runUntilReady(eventLoop, shellPool, 3, 5000ms));
+
+    CHECK(countRcFiles() <= before);
+}
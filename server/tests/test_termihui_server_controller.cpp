@@ -25,11 +25,18 @@ static std::string makeExpectedOutputMessage(const std::string& text) {
     return message.dump();
 }
 
+// Expected row of block_screen_update: whole row, or cells starting at column
+struct ExpectedRowText {
+    size_t row;
+    std::string text;
+    std::optional<size_t> column = std::nullopt;
+};
+
 // Helper to create expected block_screen_update message
-// rowTexts: vector of (row_index, text) pairs for rows with content
+// rowTexts: rows with content
 static std::string makeExpectedBlockScreenUpdate(
     size_t cursorRow, size_t cursorColumn,
-    std::vector<std::pair<size_t, std::string>> rowTexts)
+    std::vector<ExpectedRowText> rowTexts)
 {
     json defaultStyle = {
         {"fg", nullptr},
@@ -42,12 +49,16 @@ static std::string makeExpectedBlockScreenUpdate(
         {"strikethrough", false}
     };
     json updates = json::array();
-    for (const auto& [row, text] : rowTexts) {
+    for (const auto& [row, text, column] : rowTexts) {
         json segments = json::array();
         if (!text.empty()) {
             segments.push_back({{"text", text}, {"style", defaultStyle}});
         }
-        updates.push_back({{"row", row}, {"segments", segments}});
+        json update = {{"row", row}, {"segments", segments}};
+        if (column) {
+            update["column"] = *column;
+        }
+        updates.push_back(update);
     }
     json message = {
         {"type", "block_screen_update"},
@@ -133,6 +144,20 @@ TEST_CASE("TermihuiServerController", "[handleMessage]") {
         REQUIRE(webSocketServerMockPointer->calls.empty());
     }
     
+    SECTION("subscribe and unsubscribe messages update subscriptions") {
+        message.clientId = 5;
+        message.text = json{{"type", "subscribe"}, {"session_id", 12}}.dump();
+        controller.handleMessage(message);
+        message.text = json{{"type", "unsubscribe"}, {"session_id", 12}}.dump();
+        controller.handleMessage(message);
+        
+        std::vector<WebSocketServerMock::Call> expectedWsCalls = {
+            WebSocketServerMock::SubscribeCall{5, 12},
+            WebSocketServerMock::UnsubscribeCall{5, 12}
+        };
+        REQUIRE(webSocketServerMockPointer->calls == expectedWsCalls);
+    }
+    
     SECTION("invalid JSON sends error") {
         message.clientId = 1;
         message.text = "not valid json";
@@ -337,7 +362,7 @@ TEST_CASE("TermihuiServerController", "[processTerminalOutput]") {
             SessionMock::SetLastKnownCwdCall{"/Users/test"}
         };
         expectedWsCalls = {
-            WsMock::BroadcastMessageCall{json{{"type", "cwd_update"}, {"cwd", "/Users/test"}}.dump()}
+            WsMock::BroadcastMessageCall{json{{"type", "cwd_update"}, {"session_id", 1}, {"cwd", "/Users/test"}}.dump()}
         };
     }
     
@@ -349,7 +374,7 @@ TEST_CASE("TermihuiServerController", "[processTerminalOutput]") {
             SessionMock::SetLastKnownCwdCall{"/tmp"}
         };
         expectedWsCalls = {
-            WsMock::BroadcastMessageCall{json{{"type", "cwd_update"}, {"cwd", "/tmp"}}.dump()}
+            WsMock::BroadcastMessageCall{json{{"type", "cwd_update"}, {"session_id", 1}, {"cwd", "/tmp"}}.dump()}
         };
     }
     
@@ -358,17 +383,76 @@ TEST_CASE("TermihuiServerController", "[processTerminalOutput]") {
         controller.processTerminalOutput(sessionMock);
     }
     
-    SECTION("incomplete OSC - treated as text") {
+    SECTION("OSC split across reads - completed by next read") {
         sessionMock.readOutputReturnValues.push("text\x1b]133;A");
+        sessionMock.readOutputReturnValues.push(";cwd=/tmp\x07more");
+        sessionMock.hasActiveCommandReturnValue = true;
+        controller.processTerminalOutput(sessionMock);
+        controller.processTerminalOutput(sessionMock);
+        
+        // Sequence bytes are not recorded as output from either read
+        expectedCalls = {
+            SessionMock::AppendOutputToCurrentCommandCall{"text"},
+            SessionMock::SetLastKnownCwdCall{"/tmp"},
+            SessionMock::StartCommandInHistoryCall{"/tmp"},
+            SessionMock::AppendOutputToCurrentCommandCall{"more"}
+        };
+        // "text" → row 0, cursor at col 4; the marker comes before "more" reaches the screen
+        expectedWsCalls = {
+            WsMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 4, {{0, "text"}})},
+            WsMock::BroadcastMessageCall{json{{"type", "command_start"}, {"session_id", 1}, {"cwd", "/tmp"}}.dump()},
+            WsMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 8, {{0, "more", 4}})}
+        };
+    }
+    
+    SECTION("OSC split right after ESC - completed by next read") {
+        sessionMock.readOutputReturnValues.push("text\x1b");
+        sessionMock.readOutputReturnValues.push("]133;A;cwd=/tmp\x07more");
+        sessionMock.hasActiveCommandReturnValue = true;
+        controller.processTerminalOutput(sessionMock);
+        controller.processTerminalOutput(sessionMock);
+        
+        // ESC is held back until the next read shows it starts the marker
+        expectedCalls = {
+            SessionMock::AppendOutputToCurrentCommandCall{"text"},
+            SessionMock::SetLastKnownCwdCall{"/tmp"},
+            SessionMock::StartCommandInHistoryCall{"/tmp"},
+            SessionMock::AppendOutputToCurrentCommandCall{"more"}
+        };
+        expectedWsCalls = {
+            WsMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 4, {{0, "text"}})},
+            WsMock::BroadcastMessageCall{json{{"type", "command_start"}, {"session_id", 1}, {"cwd", "/tmp"}}.dump()},
+            WsMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 8, {{0, "more", 4}})}
+        };
+    }
+    
+    SECTION("CSI split right after ESC - ESC recorded with the next read") {
+        sessionMock.readOutputReturnValues.push("text\x1b");
+        sessionMock.readOutputReturnValues.push("[7Cmore");
+        controller.processTerminalOutput(sessionMock);
         controller.processTerminalOutput(sessionMock);
         
         expectedCalls = {
             SessionMock::AppendOutputToCurrentCommandCall{"text"},
-            SessionMock::AppendOutputToCurrentCommandCall{"\x1b]133;A"}
+            SessionMock::AppendOutputToCurrentCommandCall{"\x1b[7Cmore"}
+        };
+        expectedWsCalls = {
+            WsMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 4, {{0, "text"}})},
+            WsMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 15, {{0, "more", 11}})}
+        };
+    }
+    
+    SECTION("OSC terminated by ST") {
+        sessionMock.readOutputReturnValues.push("\x1b]133;B;exit=2;cwd=/tmp\x1b\\");
+        sessionMock.hasActiveCommandReturnValue = true;
+        controller.processTerminalOutput(sessionMock);
+        
+        expectedCalls = {
+            SessionMock::SetLastKnownCwdCall{"/tmp"},
+            SessionMock::FinishCurrentCommandCall{2, "/tmp"}
         };
-        // "text" → row 0, cursor at col 4; incomplete OSC produces no visible output
         expectedWsCalls = {
-            WsMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 4, {{0, "text"}})}
+            WsMock::BroadcastMessageCall{json{{"type", "command_end"}, {"session_id", 1}, {"exit_code", 2}, {"cwd", "/tmp"}}.dump()}
         };
     }
     
@@ -426,6 +510,153 @@ TEST_CASE("processTerminalOutput truncated UTF-8", "[processTerminalOutput][utf8
     REQUIRE_NOTHROW(controller.processTerminalOutput(sessionMock));
 }
 
+TEST_CASE("processTerminalOutput reassembles UTF-8 split across reads", "[processTerminalOutput][utf8]") {
+    auto wsMock = std::make_unique<WebSocketServerMock>();
+    auto aiMock = std::make_unique<AIAgentControllerMock>();
+    auto storageMock = std::make_unique<ServerStorageMock>();
+    WebSocketServerMock* wsMockPtr = wsMock.get();
+    
+    TermihuiServerControllerTestable controller(std::move(wsMock), std::move(aiMock), std::move(storageMock));
+    TerminalSessionControllerMock sessionMock;
+    
+    // "ab" + first byte of "я" (0xD1 0x8F), then the continuation byte in the next read
+    sessionMock.readOutputReturnValues.push("ab\xd1");
+    sessionMock.readOutputReturnValues.push("\x8f");
+    
+    controller.processTerminalOutput(sessionMock);
+    sessionMock.hasDataReturnValue = true;
+    controller.processTerminalOutput(sessionMock);
+    
+    std::vector<TerminalSessionControllerMock::Call> expectedCalls = {
+        TerminalSessionControllerMock::AppendOutputToCurrentCommandCall{"ab"},
+        TerminalSessionControllerMock::AppendOutputToCurrentCommandCall{"\xd1\x8f"}
+    };
+    std::vector<WebSocketServerMock::Call> expectedWsCalls = {
+        WebSocketServerMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 2, {{0, "ab"}})},
+        WebSocketServerMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 3, {{0, "\xd1\x8f", 2}})}
+    };
+    REQUIRE(sessionMock.calls == expectedCalls);
+    REQUIRE(wsMockPtr->calls == expectedWsCalls);
+}
+
+TEST_CASE("processTerminalOutput resends whole row after overwriting a wide character", "[processTerminalOutput][utf8]") {
+    auto wsMock = std::make_unique<WebSocketServerMock>();
+    auto aiMock = std::make_unique<AIAgentControllerMock>();
+    auto storageMock = std::make_unique<ServerStorageMock>();
+    WebSocketServerMock* wsMockPtr = wsMock.get();
+    
+    TermihuiServerControllerTestable controller(std::move(wsMock), std::move(aiMock), std::move(storageMock));
+    TerminalSessionControllerMock sessionMock;
+    
+    // "xy" covers both cells of "日": the row is narrow now, but the client's copy is not,
+    // so splicing {column 1, "xy"} into "a日b" would give "axy"
+    sessionMock.readOutputReturnValues.push("a\xe6\x97\xa5" "b");
+    sessionMock.readOutputReturnValues.push("\x1b[1;2Hxy");
+    
+    controller.processTerminalOutput(sessionMock);
+    sessionMock.hasDataReturnValue = true;
+    controller.processTerminalOutput(sessionMock);
+    
+    std::vector<WebSocketServerMock::Call> expectedWsCalls = {
+        WebSocketServerMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 4, {{0, "a\xe6\x97\xa5" "b"}})},
+        WebSocketServerMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 3, {{0, "axyb"}})}
+    };
+    REQUIRE(wsMockPtr->calls == expectedWsCalls);
+    
+    // Row went out whole without wide cells: partial updates are safe again
+    sessionMock.readOutputReturnValues.push("\x1b[1;2Hz");
+    sessionMock.hasDataReturnValue = true;
+    controller.processTerminalOutput(sessionMock);
+    REQUIRE(wsMockPtr->calls.size() == 3);
+    CHECK(wsMockPtr->calls[2] == WebSocketServerMock::Call{
+        WebSocketServerMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 2, {{0, "z", 1}})}});
+}
+
+TEST_CASE("processTerminalOutput paces block screen updates", "[processTerminalOutput][pacing]") {
+    auto wsMock = std::make_unique<WebSocketServerMock>();
+    auto aiMock = std::make_unique<AIAgentControllerMock>();
+    auto storageMock = std::make_unique<ServerStorageMock>();
+    WebSocketServerMock* wsMockPtr = wsMock.get();
+    
+    TermihuiServerControllerTestable controller(std::move(wsMock), std::move(aiMock), std::move(storageMock));
+    controller.setFrameInterval(std::chrono::hours(1));
+    TerminalSessionControllerMock sessionMock;
+    auto feed = [&](const std::string& output) {
+        sessionMock.readOutputReturnValues.push(output);
+        sessionMock.hasDataReturnValue = true;
+        controller.processTerminalOutput(sessionMock);
+    };
+    
+    // First frame goes out right away
+    feed("ab");
+    REQUIRE(wsMockPtr->calls.size() == 1);
+    CHECK_FALSE(sessionMock.getFramePacer().getPendingDeadline().has_value());
+    
+    // Output within the interval is merged into one deferred frame
+    feed("c");
+    feed("d");
+    REQUIRE(wsMockPtr->calls.size() == 1);
+    CHECK(sessionMock.getFramePacer().getPendingDeadline().has_value());
+    
+    // Marker forces the deferred frame out before the event it triggers
+    feed("e\x1b]133;D\x07");
+    
+    // Input lets the next frame bypass the interval, including the deferred one
+    feed("f");
+    sessionMock.getFramePacer().requestImmediateFrame();
+    feed("g");
+    CHECK_FALSE(sessionMock.getFramePacer().getPendingDeadline().has_value());
+    
+    std::vector<WebSocketServerMock::Call> expectedWsCalls = {
+        WebSocketServerMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 2, {{0, "ab"}})},
+        WebSocketServerMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 5, {{0, "cde", 2}})},
+        WebSocketServerMock::BroadcastMessageCall{json{{"type", "prompt_end"}, {"session_id", 1}}.dump()},
+        WebSocketServerMock::BroadcastMessageCall{makeExpectedBlockScreenUpdate(0, 7, {{0, "fg", 5}})}
+    };
+    REQUIRE(wsMockPtr->calls == expectedWsCalls);
+}
+
+TEST_CASE("processTerminalOutput sends scroll instead of shifted rows in interactive mode", "[processTerminalOutput][scroll]") {
+    auto wsMock = std::make_unique<WebSocketServerMock>();
+    auto aiMock = std::make_unique<AIAgentControllerMock>();
+    auto storageMock = std::make_unique<ServerStorageMock>();
+    WebSocketServerMock* wsMockPtr = wsMock.get();
+    
+    TermihuiServerControllerTestable controller(std::move(wsMock), std::move(aiMock), std::move(storageMock));
+    TerminalSessionControllerMock sessionMock;
+    auto feed = [&](const std::string& output) {
+        sessionMock.readOutputReturnValues.push(output);
+        sessionMock.hasDataReturnValue = true;
+        controller.processTerminalOutput(sessionMock);
+    };
+    
+    feed("\x1b[?1049h");
+    REQUIRE(sessionMock.isInInteractiveMode());
+    size_t lastRow = sessionMock.getVirtualScreen().rows() - 1;
+    feed("\x1b[" + std::to_string(lastRow + 1) + ";1Hbottom");
+    wsMockPtr->calls.clear();
+    
+    // One line feed at the bottom: one scroll plus the row that scrolled in
+    feed("\nX");
+    
+    json defaultStyle = {
+        {"fg", nullptr}, {"bg", nullptr}, {"bold", false}, {"dim", false},
+        {"italic", false}, {"underline", false}, {"reverse", false}, {"strikethrough", false}
+    };
+    std::vector<WebSocketServerMock::Call> expectedWsCalls = {
+        WebSocketServerMock::BroadcastMessageCall{json{
+            {"type", "screen_scroll"}, {"session_id", 1}, {"top", 0}, {"bottom", lastRow}, {"count", 1}
+        }.dump()},
+        WebSocketServerMock::BroadcastMessageCall{json{
+            {"type", "screen_diff"}, {"session_id", 1}, {"cursor_row", lastRow}, {"cursor_column", 7},
+            {"updates", json::array({{{"row", lastRow}, {"segments", json::array({
+                {{"text", "      X"}, {"style", defaultStyle}}
+            })}}})}
+        }.dump()}
+    };
+    REQUIRE(wsMockPtr->calls == expectedWsCalls);
+}
+
 TEST_CASE("TermihuiServerController::update", "[update]") {
     using Testable = TermihuiServerControllerTestable;
     using WsMock = WebSocketServerMock;
@@ -1,9 +1,30 @@
 #include <catch2/catch_test_macros.hpp>
 #include "TerminalSessionController.h"
+#include "ProcessReaper.h"
 #include <thread>
 #include <chrono>
 #include <filesystem>
 
+namespace {
+
+/**
+ * End session the way SessionWorker does: hand its shell to a reaper and drive it until the shell is gone
+ */
+void terminateSession(TerminalSessionController& session) {
+    EventLoop eventLoop;
+    ProcessReaper processReaper(eventLoop, std::chrono::milliseconds(500));
+    auto child = session.releaseChild();
+    processReaper.terminate(child.pid, child.exitFd);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (processReaper.getPendingCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+        eventLoop.wait(processReaper.nextTimeoutMs());
+        processReaper.processTimers();
+    }
+    CHECK(processReaper.getPendingCount() == 0);
+}
+
+} // anonymous namespace
+
 // =============================================================================
 // BUG: Session should start in correct cwd, not inherit from parent process
 // =============================================================================
@@ -60,7 +81,7 @@ TEST_CASE("Restored session starts in last cwd from history", "[TerminalSessionC
         session.startCommandInHistory("/some/initial/path");
         session.finishCurrentCommand(0, "/tmp");
         
-        session.terminate();
+        terminateSession(session);
     }
     
     // Phase 2: Create new session with same dbPath (simulates server restart)
@@ -93,3 +114,61 @@ TEST_CASE("Restored session starts in last cwd from history", "[TerminalSessionC
     
     std::filesystem::remove(dbPath);
 }
+
+TEST_CASE("sendInput queues input the PTY doesn't accept", "[TerminalSessionController][input]") {
+    auto dbPath = std::filesystem::temp_directory_path() / "test_input_queue.sqlite";
+    std::filesystem::remove(dbPath);
+    
+    TerminalSessionController session(dbPath, 1, 1);
+    REQUIRE(session.createSession());
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    session.readOutput();
+    
+    // Foreground process never reads stdin: PTY input buffer fills up
+    REQUIRE(session.executeCommand("sleep 30").isOk());
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    
+    std::string input;
+    for (int i = 0; i < 16 * 1024; ++i) {
+        input += "queued input line that the PTY has no room for right now...\n";
+    }
+    CHECK(session.sendInput(input) == static_cast<ssize_t>(input.size()));
+    CHECK(session.hasPendingInput());
+    
+    // Still writable later without error, order kept in queue
+    CHECK(session.flushPendingInput());
+    CHECK(session.hasPendingInput());
+    
+    terminateSession(session);
+    CHECK_FALSE(session.hasPendingInput());
+    std::filesystem::remove(dbPath);
+}
+
+TEST_CASE("sendPaste brackets pasted text when application asked for it", "[TerminalSessionController][input]") {
+    auto dbPath = std::filesystem::temp_directory_path() / "test_bracketed_paste.sqlite";
+    std::filesystem::remove(dbPath);
+    
+    TerminalSessionController session(dbPath, 1, 1);
+    REQUIRE(session.createSession());
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    session.readOutput();
+    
+    REQUIRE(session.executeCommand("cat -v").isOk());
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    session.readOutput();
+    
+    // Application enables bracketed paste; end marker inside the paste must not leak through
+    session.getAnsiProcessor().process("\x1b[?2004h");
+    REQUIRE(session.sendPaste("paste_\x1b[201~marker\n") > 0);
+    
+    std::string output;
+    for (int attempts = 0; attempts < 40 && output.find("[201~") == std::string::npos; ++attempts) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        output += session.readOutput();
+    }
+    INFO("Output: " << output);
+    CHECK(output.find("[200~paste_marker") != std::string::npos);
+    
+    terminateSession(session);
+    std::filesystem::remove(dbPath);
+}
@@ -67,6 +67,29 @@ TEST_CASE("VirtualScreen putCharacter wraps at end of line", "[VirtualScreen][ou
     CHECK(screen.cellAt(1, 0).character == U'F');
 }
 
+TEST_CASE("VirtualScreen putString writes run with current style and wraps", "[VirtualScreen][output]") {
+    VirtualScreen screen(3, 5);
+    TextStyle style;
+    style.bold = true;
+    screen.setCurrentStyle(style);
+    screen.moveCursor(0, 2);
+    screen.clearDirtyRows();
+    
+    screen.putString(U"abcдефgh");
+    
+    CHECK(screen.getRowText(0) == "  abc");
+    CHECK(screen.getRowText(1) == "дефgh");
+    CHECK(screen.cursorRow() == 1);
+    CHECK(screen.cursorColumn() == 5);
+    CHECK(screen.styleAt(1, 4).bold);
+    CHECK(screen.dirtyRows() == std::vector<size_t>{0, 1});
+    CHECK(screen.isCursorDirty());
+    
+    // Pending wrap is taken by the next run, like putCharacter does
+    screen.putString(U"i");
+    CHECK(screen.getRowText(2) == "i");
+}
+
 TEST_CASE("VirtualScreen putCharacter with style", "[VirtualScreen][output]") {
     VirtualScreen screen(5, 10);
     
@@ -78,8 +101,8 @@ TEST_CASE("VirtualScreen putCharacter with style", "[VirtualScreen][output]") {
     
     const Cell& cell = screen.cellAt(0, 0);
     CHECK(cell.character == U'X');
-    CHECK(cell.style.bold == true);
-    CHECK(cell.style.foreground.has_value());
+    CHECK(screen.style(cell.styleId).bold == true);
+    CHECK(screen.style(cell.styleId).foreground.has_value());
 }
 
 TEST_CASE("VirtualScreen setCurrentStyle affects subsequent characters", "[VirtualScreen][output]") {
@@ -92,8 +115,46 @@ TEST_CASE("VirtualScreen setCurrentStyle affects subsequent characters", "[Virtu
     screen.putCharacter('A');
     screen.putCharacter('B');
     
-    CHECK(screen.cellAt(0, 0).style.italic == true);
-    CHECK(screen.cellAt(0, 1).style.italic == true);
+    CHECK(screen.styleAt(0, 0).italic == true);
+    CHECK(screen.styleAt(0, 1).italic == true);
+}
+
+TEST_CASE("VirtualScreen interns equal styles to one id", "[VirtualScreen][style]") {
+    VirtualScreen screen(5, 10);
+    
+    TextStyle style;
+    style.bold = true;
+    screen.setCurrentStyle(style);
+    screen.putCharacter('A');
+    screen.resetStyle();
+    screen.putCharacter('B');
+    screen.putCharacter('C', style);
+    
+    CHECK(screen.cellAt(0, 0).styleId == screen.cellAt(0, 2).styleId);
+    CHECK(screen.cellAt(0, 1).styleId == StyleTable::defaultStyleId);
+    CHECK(screen.styleCount() == 2);
+}
+
+TEST_CASE("VirtualScreen drops unreferenced styles when style table fills", "[VirtualScreen][style]") {
+    VirtualScreen screen(2, 4);
+    
+    TextStyle kept;
+    kept.foreground = Color::rgb(1, 2, 3);
+    screen.putCharacter('K', kept);
+    
+    // A gradient walks through more colors than ids exist; only the visible ones must survive
+    for (int i = 0; i < 70000; ++i) {
+        TextStyle style;
+        style.background = Color::rgb(i & 0xFF, (i >> 8) & 0xFF, i >> 16);
+        screen.setCurrentStyle(style);
+    }
+    screen.putCharacter('L');
+    
+    CHECK(screen.styleCount() < StyleTable::capacity);
+    REQUIRE(screen.styleAt(0, 0).foreground.has_value());
+    CHECK(*screen.styleAt(0, 0).foreground == Color::rgb(1, 2, 3));
+    REQUIRE(screen.styleAt(0, 1).background.has_value());
+    CHECK(*screen.styleAt(0, 1).background == Color::rgb(69999 & 0xFF, (69999 >> 8) & 0xFF, 69999 >> 16));
 }
 
 // =============================================================================
@@ -299,6 +360,143 @@ TEST_CASE("VirtualScreen scroll down moves content", "[VirtualScreen][scroll]")
     CHECK(screen.cellAt(2, 0).character == U'B');
 }
 
+TEST_CASE("VirtualScreen keeps row order across many scrolls and resize", "[VirtualScreen][scroll]") {
+    VirtualScreen screen(3, 10);
+    
+    for (char ch = 'A'; ch <= 'G'; ++ch) {
+        screen.putCharacter(ch);
+        screen.carriageReturn();
+        screen.lineFeed();
+    }
+    
+    CHECK(screen.getContent() == "F\nG\n");
+    
+    screen.resize(4, 12);
+    CHECK(screen.getRowText(0) == "F");
+    CHECK(screen.getRowText(1) == "G");
+    CHECK(screen.getRowText(3) == "");
+}
+
+TEST_CASE("VirtualScreen scroll region moves only its rows", "[VirtualScreen][scroll]") {
+    VirtualScreen screen(5, 10);
+    for (char ch = 'A'; ch <= 'E'; ++ch) {
+        screen.moveCursor(static_cast<size_t>(ch - 'A'), 0);
+        screen.putCharacter(ch);
+    }
+    
+    screen.setScrollRegion(1, 3);
+    CHECK(screen.cursorRow() == 0);
+    
+    screen.moveCursor(3, 0);
+    screen.lineFeed();
+    
+    CHECK(screen.getContent() == "A\nC\nD\n\nE");
+    CHECK(screen.cursorRow() == 3);
+    CHECK_FALSE(screen.hasScrolledOffRows());
+    
+    screen.scroll(-2);
+    CHECK(screen.getContent() == "A\n\n\nC\nE");
+}
+
+TEST_CASE("VirtualScreen ignores invalid scroll region", "[VirtualScreen][scroll]") {
+    VirtualScreen screen(5, 10);
+    
+    screen.setScrollRegion(3, 3);
+    CHECK(screen.scrollRegionTop() == 0);
+    CHECK(screen.scrollRegionBottom() == 4);
+    
+    screen.setScrollRegion(2, 100);
+    CHECK(screen.scrollRegionTop() == 2);
+    CHECK(screen.scrollRegionBottom() == 4);
+    
+    screen.resize(6, 10);
+    CHECK(screen.scrollRegionTop() == 0);
+    CHECK(screen.scrollRegionBottom() == 5);
+}
+
+TEST_CASE("VirtualScreen records scrolls and shifts dirty rows with content", "[VirtualScreen][scroll]") {
+    VirtualScreen screen(5, 10);
+    screen.clearDirtyRows();
+    
+    screen.moveCursor(3, 2);
+    screen.putCharacter('x');
+    screen.moveCursor(4, 0);
+    screen.lineFeed();
+    screen.lineFeed();
+    
+    auto operations = screen.takeScrollOperations();
+    REQUIRE(operations.size() == 1);
+    CHECK(operations[0].top == 0);
+    CHECK(operations[0].bottom == 4);
+    CHECK(operations[0].count == 2);
+    
+    // Row written before the scroll moved up with it, scrolled-in rows are dirty
+    CHECK(screen.dirtyRows() == std::vector<size_t>{1, 3, 4});
+    CHECK(screen.dirtyColumns(1).begin == 2);
+    CHECK(screen.dirtyColumns(1).end == 3);
+    
+    // Opposite scrolls of one region cancel out
+    screen.clearDirtyRows();
+    screen.scroll(1);
+    screen.scroll(-1);
+    CHECK_FALSE(screen.hasScrollOperations());
+    CHECK(screen.dirtyRows() == std::vector<size_t>{0});
+}
+
+TEST_CASE("VirtualScreen scrolls plus dirty rows rebuild the screen", "[VirtualScreen][scroll]") {
+    VirtualScreen screen(6, 8);
+    std::vector<std::string> client(6);
+    auto sync = [&screen, &client] {
+        // What a client does: shift rows per scroll, then overwrite dirty rows
+        for (const auto& operation : screen.takeScrollOperations()) {
+            auto first = client.begin() + static_cast<long>(operation.top);
+            auto last = client.begin() + static_cast<long>(operation.bottom) + 1;
+            long height = last - first;
+            long count = std::min<long>(std::abs(operation.count), height);
+            if (operation.count > 0) {
+                std::rotate(first, first + count, last);
+                std::fill(last - count, last, std::string());
+            } else {
+                std::rotate(first, last - count, last);
+                std::fill(first, first + count, std::string());
+            }
+        }
+        screen.forEachDirtyRow([&screen, &client](size_t row) { client[row] = screen.getRowText(row); });
+        screen.clearDirtyRows();
+    };
+    auto serverRows = [&screen] {
+        std::vector<std::string> rows;
+        for (size_t row = 0; row < screen.rows(); ++row) {
+            rows.push_back(screen.getRowText(row));
+        }
+        return rows;
+    };
+    
+    for (int step = 0; step < 40; ++step) {
+        screen.putString(std::string_view(std::to_string(step)));
+        screen.carriageReturn();
+        screen.lineFeed();
+        if (step % 7 == 3) {
+            screen.setScrollRegion(1, 4);
+            screen.moveCursor(4, 0);
+        }
+        if (step % 5 == 2) {
+            screen.moveCursor(2, 0);
+            screen.insertLines(1);
+            screen.putString(std::string_view("ins"));
+        }
+        if (step % 9 == 8) {
+            screen.resetScrollRegion();
+            screen.moveCursor(0, 0);
+            screen.reverseLineFeed();
+        }
+        if (step % 3 == 0) {
+            sync();
+            REQUIRE(client == serverRows());
+        }
+    }
+}
+
 // =============================================================================
 // Resize Tests
 // =============================================================================
@@ -371,13 +569,62 @@ TEST_CASE("VirtualScreen tracks dirty rows", "[VirtualScreen][dirty]") {
     screen.moveCursor(2, 0);
     screen.putCharacter('X');
     
-    CHECK(screen.dirtyRows().count(2) == 1);
+    CHECK(screen.isRowDirty(2));
     CHECK(screen.dirtyRows().size() == 1);
     
     screen.clearDirtyRows();
     CHECK(screen.dirtyRows().empty());
 }
 
+TEST_CASE("VirtualScreen tracks damaged column range per row", "[VirtualScreen][dirty]") {
+    VirtualScreen screen(3, 20);
+    screen.clearDirtyRows();
+    
+    screen.moveCursor(1, 5);
+    screen.putString(std::string_view("abc"));
+    screen.moveCursor(1, 12);
+    screen.putCharacter('x');
+    
+    CHECK(screen.dirtyRowCount() == 1);
+    CHECK(screen.dirtyColumns(1).begin == 5);
+    CHECK(screen.dirtyColumns(1).end == 13);
+    
+    screen.moveCursor(2, 7);
+    screen.clearLine(VirtualScreen::ClearLineMode::ToEnd);
+    CHECK(screen.dirtyColumns(2).begin == 7);
+    CHECK(screen.dirtyColumns(2).end == 20);
+    
+    // Range starts over after clearing
+    screen.clearDirtyRows();
+    screen.moveCursor(1, 2);
+    screen.putCharacter('y');
+    CHECK(screen.dirtyColumns(1).begin == 2);
+    CHECK(screen.dirtyColumns(1).end == 3);
+}
+
+TEST_CASE("VirtualScreen tracks dirty rows beyond one bitset word", "[VirtualScreen][dirty]") {
+    VirtualScreen screen(130, 10);
+    screen.clearDirtyRows();
+    
+    for (size_t row : {0, 63, 64, 129}) {
+        screen.moveCursor(row, 0);
+        screen.putCharacter('R');
+    }
+    
+    CHECK(screen.dirtyRows() == std::vector<size_t>{0, 63, 64, 129});
+    CHECK_FALSE(screen.isRowDirty(65));
+}
+
+TEST_CASE("VirtualScreen getRowSegments for column range keeps spaces", "[VirtualScreen][content]") {
+    VirtualScreen screen(2, 10);
+    screen.putString(std::string_view("ab  cd"));
+    
+    auto segments = screen.getRowSegments(0, 1, 8);
+    
+    REQUIRE(segments.size() == 1);
+    CHECK(segments[0].text == "b  cd  ");
+}
+
 TEST_CASE("VirtualScreen cursor dirty flag tracks cursor changes", "[VirtualScreen][dirty]") {
     VirtualScreen screen(5, 10);
     screen.clearDirtyRows();
@@ -399,7 +646,7 @@ TEST_CASE("VirtualScreen markAllDirty marks all rows", "[VirtualScreen][dirty]")
     
     CHECK(screen.dirtyRows().size() == 5);
     for (size_t row = 0; row < 5; ++row) {
-        CHECK(screen.dirtyRows().count(row) == 1);
+        CHECK(screen.isRowDirty(row));
     }
 }
 
@@ -576,3 +823,319 @@ TEST_CASE("VirtualScreen captures styled segments on scroll-off", "[VirtualScree
     CHECK(scrolledOff[0][1].text == ": fail");
     CHECK(scrolledOff[0][1].style.bold == false);
 }
+
+// =============================================================================
+// Row Cache Tests
+// =============================================================================
+
+TEST_CASE("VirtualScreen row version changes only when row is written", "[VirtualScreen][row-cache]") {
+    VirtualScreen screen(3, 10);
+    uint64_t row0 = screen.rowVersion(0);
+    uint64_t row1 = screen.rowVersion(1);
+    CHECK(row0 != row1);
+    
+    screen.putString(std::string_view("abc"));
+    CHECK(screen.rowVersion(0) != row0);
+    CHECK(screen.rowVersion(1) == row1);
+    
+    // Resending without a content change keeps versions
+    row0 = screen.rowVersion(0);
+    screen.clearDirtyRows();
+    screen.markAllDirty();
+    CHECK(screen.rowVersion(0) == row0);
+    CHECK(screen.rowVersion(1) == row1);
+}
+
+TEST_CASE("VirtualScreen row version moves with scrolled content", "[VirtualScreen][row-cache]") {
+    VirtualScreen screen(3, 10);
+    screen.moveCursor(1, 0);
+    screen.putString(std::string_view("middle"));
+    uint64_t middle = screen.rowVersion(1);
+    uint64_t bottom = screen.rowVersion(2);
+    
+    screen.scroll(1);
+    CHECK(screen.rowVersion(0) == middle);
+    CHECK(screen.rowVersion(1) == bottom);
+    CHECK(screen.rowVersion(2) != bottom);
+    CHECK(screen.rowVersion(2) != middle);
+    
+    // Region scroll (copies rows instead of rotating) behaves the same
+    screen.setScrollRegion(0, 1);
+    screen.scroll(-1);
+    CHECK(screen.rowVersion(1) == middle);
+    REQUIRE(screen.rowSegments(1).size() == 1);
+    CHECK(screen.rowSegments(1)[0].text == "middle");
+}
+
+TEST_CASE("VirtualScreen caches row segments and encoding until row changes", "[VirtualScreen][row-cache]") {
+    VirtualScreen screen(3, 10);
+    screen.putString(std::string_view("hi"));
+    
+    int encodeCalls = 0;
+    auto encode = [&encodeCalls](const std::vector<StyledSegment>& segments) {
+        ++encodeCalls;
+        std::string result;
+        for (const auto& segment : segments) {
+            result += "[" + segment.text + "]";
+        }
+        return result;
+    };
+    
+    const auto* segments = &screen.rowSegments(0);
+    CHECK(&screen.rowSegments(0) == segments);
+    CHECK(screen.encodedRow(0, encode) == "[hi]");
+    CHECK(screen.encodedRow(0, encode) == "[hi]");
+    CHECK(encodeCalls == 1);
+    
+    // Scrolling keeps the cached encoding with the moved row
+    screen.moveCursor(2, 0);
+    screen.lineFeed();
+    CHECK(screen.takeScrolledOffRows()[0][0].text == "hi");
+    CHECK(screen.encodedRow(1, encode) == "");
+    CHECK(encodeCalls == 2);
+    
+    screen.moveCursor(1, 0);
+    screen.putCharacter(U'x');
+    CHECK(screen.encodedRow(1, encode) == "[x]");
+    CHECK(screen.getRowSegments(1) == screen.rowSegments(1));
+    CHECK(encodeCalls == 3);
+    
+    screen.clearScreen(VirtualScreen::ClearScreenMode::Entire);
+    CHECK(screen.encodedRow(1, encode) == "");
+    CHECK(encodeCalls == 4);
+}
+
+// =============================================================================
+// Wide Character and Cluster Tests
+// =============================================================================
+
+TEST_CASE("VirtualScreen wide character takes two cells", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 10);
+    
+    screen.putCharacter(U'\u3042');
+    screen.putCharacter(U'x');
+    
+    CHECK(screen.cellAt(0, 0).isWide());
+    CHECK(screen.cellAt(0, 1).isSpacer());
+    CHECK(screen.cellAt(0, 2).character == U'x');
+    CHECK(screen.cursorColumn() == 3);
+    CHECK(screen.getRowText(0) == "\u3042x");
+    REQUIRE(screen.getRowSegments(0).size() == 1);
+    CHECK(screen.getRowSegments(0)[0].text == "\u3042x");
+    CHECK_FALSE(screen.hasOnlyNarrowCells(0));
+    CHECK(screen.hasOnlyNarrowCells(1));
+}
+
+TEST_CASE("VirtualScreen wide character in last column wraps", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 5);
+    
+    screen.putString(U"abcd");
+    screen.putCharacter(U'\U0001F600');
+    
+    CHECK(screen.getRowText(0) == "abcd");
+    CHECK(screen.cellAt(1, 0).character == U'\U0001F600');
+    CHECK(screen.cellAt(1, 1).isSpacer());
+    CHECK(screen.cursorRow() == 1);
+    CHECK(screen.cursorColumn() == 2);
+}
+
+TEST_CASE("VirtualScreen overwriting half of wide character blanks other half", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 10);
+    
+    screen.putString(U"\u3042\u3044");
+    screen.moveCursor(0, 1);
+    screen.putCharacter(U'x');
+    
+    CHECK(screen.cellAt(0, 0).character == U' ');
+    CHECK_FALSE(screen.cellAt(0, 0).isWide());
+    CHECK(screen.cellAt(0, 1).character == U'x');
+    CHECK(screen.getRowText(0) == " x\u3044");
+    
+    // Right half of the second one
+    screen.moveCursor(0, 2);
+    screen.putString(U"y");
+    CHECK(screen.getRowText(0) == " xy");
+    CHECK(screen.hasOnlyNarrowCells(0));
+}
+
+TEST_CASE("VirtualScreen remembers wide characters until row is sent whole", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 10);
+    
+    screen.putString(U"a\u3042b");
+    screen.moveCursor(0, 1);
+    screen.putString(U"xy");
+    
+    // Row is narrow again, but clients still hold the wide character
+    CHECK(screen.hasOnlyNarrowCells(0));
+    CHECK(screen.heldWideCells(0));
+    CHECK_FALSE(screen.heldWideCells(1));
+    
+    screen.markRowSentWhole(0);
+    CHECK_FALSE(screen.heldWideCells(0));
+    
+    // Combining character makes a cluster; the flag moves with the row when it scrolls
+    screen.moveCursor(1, 0);
+    screen.putString(U"e\u0301");
+    CHECK(screen.heldWideCells(1));
+    screen.scroll(1);
+    CHECK(screen.heldWideCells(0));
+    CHECK_FALSE(screen.heldWideCells(1));
+}
+
+TEST_CASE("VirtualScreen combining characters join previous cell", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 10);
+    
+    screen.putString(U"e\u0301x");
+    screen.putCharacter(U'\u0302');
+    
+    CHECK(screen.cursorColumn() == 2);
+    CHECK(screen.getRowText(0) == "e\u0301x\u0302");
+    CHECK(screen.cellAt(0, 1).character != U'x');
+    CHECK_FALSE(screen.hasOnlyNarrowCells(0));
+    
+    // Same cluster gets the same cell value
+    screen.moveCursor(1, 0);
+    screen.putString(U"e\u0301");
+    CHECK(screen.cellAt(1, 0).character == screen.cellAt(0, 0).character);
+}
+
+TEST_CASE("VirtualScreen joins emoji sequences into one wide cell", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 10);
+    
+    // Family: man ZWJ woman ZWJ girl, then a flag (two regional indicators)
+    screen.putString(U"\U0001F468\u200D\U0001F469\u200D\U0001F467\U0001F1E9\U0001F1EA");
+    
+    // Flag takes the width of its first regional indicator (East Asian Width: neutral)
+    CHECK(screen.cursorColumn() == 3);
+    CHECK(screen.cellAt(0, 0).isWide());
+    CHECK_FALSE(screen.cellAt(0, 2).isWide());
+    CHECK(screen.getRowText(0) == "\U0001F468\u200D\U0001F469\u200D\U0001F467\U0001F1E9\U0001F1EA");
+}
+
+TEST_CASE("VirtualScreen drops combining character after cursor move", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 10);
+    
+    screen.putString(U"ab");
+    screen.moveCursor(0, 1);
+    screen.putCharacter(U'\u0301');
+    screen.moveCursor(1, 0);
+    screen.putCharacter(U'\u0301');
+    
+    CHECK(screen.getRowText(0) == "ab");
+    CHECK(screen.getRowText(1) == "");
+    CHECK(screen.cursorColumn() == 0);
+}
+
+TEST_CASE("VirtualScreen clearing through wide character blanks both halves", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 10);
+    
+    screen.putString(U"a\u3042b");
+    screen.moveCursor(0, 2);
+    screen.clearLine(VirtualScreen::ClearLineMode::ToEnd);
+    
+    CHECK(screen.getRowText(0) == "a");
+    CHECK(screen.hasOnlyNarrowCells(0));
+}
+
+TEST_CASE("VirtualScreen resize drops wide character cut at last column", "[VirtualScreen][unicode]") {
+    VirtualScreen screen(3, 10);
+    
+    screen.putString(U"abc\u3042");
+    screen.resize(3, 4);
+    
+    CHECK(screen.getRowText(0) == "abc");
+    CHECK(screen.hasOnlyNarrowCells(0));
+}
+
+// =============================================================================
+// Alternate Screen Tests
+// =============================================================================
+
+TEST_CASE("VirtualScreen alternate screen keeps primary screen aside", "[VirtualScreen][alternate]") {
+    VirtualScreen screen(3, 10);
+    screen.putString(U"prompt");
+    uint64_t version = screen.rowVersion(0);
+    const auto* segments = &screen.rowSegments(0);
+    
+    screen.enterAlternateScreen(true);
+    CHECK(screen.isAlternateScreen());
+    CHECK(screen.getRowText(0) == "");
+    screen.moveCursor(0, 0);
+    screen.putString(U"app");
+    CHECK(screen.getRowText(0) == "app");
+    
+    screen.clearDirtyRows();
+    screen.exitAlternateScreen();
+    CHECK_FALSE(screen.isAlternateScreen());
+    CHECK(screen.getRowText(0) == "prompt");
+    CHECK(screen.dirtyRowCount() == 3);
+    
+    // Row state came back with the grid: nothing is segmented again
+    CHECK(screen.rowVersion(0) == version);
+    CHECK(&screen.rowSegments(0) == segments);
+}
+
+TEST_CASE("VirtualScreen alternate screen without clear keeps its content", "[VirtualScreen][alternate]") {
+    VirtualScreen screen(3, 10);
+    
+    screen.enterAlternateScreen(true);
+    screen.putString(U"app");
+    screen.exitAlternateScreen();
+    screen.enterAlternateScreen(false);
+    CHECK(screen.getRowText(0) == "app");
+    
+    screen.exitAlternateScreen();
+    screen.enterAlternateScreen(true);
+    CHECK(screen.getRowText(0) == "");
+}
+
+TEST_CASE("VirtualScreen resize while on alternate screen resizes primary on exit", "[VirtualScreen][alternate]") {
+    VirtualScreen screen(3, 10);
+    screen.putString(U"abcdefgh");
+    
+    screen.enterAlternateScreen(true);
+    screen.setScrollRegion(1, 2);
+    screen.resize(4, 5);
+    screen.exitAlternateScreen();
+    
+    CHECK(screen.rows() == 4);
+    CHECK(screen.columns() == 5);
+    CHECK(screen.getRowText(0) == "abcde");
+    CHECK(screen.scrollRegionTop() == 0);
+    CHECK(screen.scrollRegionBottom() == 3);
+}
+
+TEST_CASE("VirtualScreen style compaction covers screen aside", "[VirtualScreen][alternate]") {
+    VirtualScreen screen(2, 4);
+    TextStyle red;
+    red.foreground = Color::standard(1);
+    screen.putCharacter(U'r', red);
+    
+    screen.enterAlternateScreen(true);
+    for (int i = 0; i < 70000; ++i) {
+        TextStyle style;
+        style.foreground = Color::rgb(i & 0xFF, (i >> 8) & 0xFF, (i >> 16) & 0xFF);
+        screen.moveCursor(1, 0);
+        screen.putCharacter(U'x', style);
+    }
+    screen.exitAlternateScreen();
+    
+    CHECK(screen.styleAt(0, 0) == red);
+}
+
+TEST_CASE("VirtualScreen saved cursor belongs to its screen", "[VirtualScreen][alternate]") {
+    VirtualScreen screen(5, 10);
+    screen.moveCursor(3, 4);
+    screen.saveCursor();
+    
+    screen.enterAlternateScreen(true);
+    screen.moveCursor(1, 1);
+    screen.restoreCursor();
+    CHECK(screen.cursorRow() == 0);
+    CHECK(screen.cursorColumn() == 0);
+    
+    screen.exitAlternateScreen();
+    screen.restoreCursor();
+    CHECK(screen.cursorRow() == 3);
+    CHECK(screen.cursorColumn() == 4);
+}
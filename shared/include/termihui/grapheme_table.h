@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace termihui {
+
+/**
+ * Interning table for multi-codepoint grapheme clusters
+ *
+ * A cell holds one char32_t. Clusters of several codepoints (base + combining marks,
+ * ZWJ emoji sequences, flags) are stored here and the cell holds their id instead,
+ * which lies above the Unicode range so it can't be mistaken for a codepoint.
+ * Equal clusters always get the same id.
+ */
+class GraphemeTable {
+public:
+    static constexpr char32_t firstId = 0x110000;
+    static constexpr size_t capacity = 65536;
+
+    /**
+     * Check if cell character is a cluster id rather than a codepoint
+     */
+    static constexpr bool isCluster(char32_t character) { return character >= firstId; }
+
+    /**
+     * Get id for cluster, adding it to the table if it's new
+     * @return id of cluster, 0 if the table is full (call compact() first)
+     */
+    char32_t intern(std::u32string_view cluster) {
+        auto it = index_.find(std::u32string(cluster));
+        if (it != index_.end()) {
+            return it->second;
+        }
+        if (full()) {
+            return 0;
+        }
+        auto id = static_cast<char32_t>(firstId + clusters_.size());
+        clusters_.emplace_back(cluster);
+        index_.emplace(clusters_.back(), id);
+        return id;
+    }
+
+    /**
+     * Get codepoints of cluster by id (id must come from this table)
+     */
+    std::u32string_view cluster(char32_t id) const {
+        return clusters_[id - firstId];
+    }
+
+    /**
+     * Drop clusters that are no longer referenced and renumber the rest densely
+     * @param used Flag per cluster (indexed by id - firstId, size() entries)
+     * @return Mapping (old id - firstId) -> new id (unused clusters map to 0)
+     */
+    std::vector<char32_t> compact(const std::vector<bool>& used) {
+        std::vector<char32_t> remap(clusters_.size(), 0);
+        std::vector<std::u32string> clusters;
+        index_.clear();
+
+        for (size_t index = 0; index < clusters_.size(); ++index) {
+            if (index < used.size() && used[index]) {
+                remap[index] = static_cast<char32_t>(firstId + clusters.size());
+                index_.emplace(clusters_[index], remap[index]);
+                clusters.push_back(std::move(clusters_[index]));
+            }
+        }
+
+        clusters_ = std::move(clusters);
+        return remap;
+    }
+
+    /**
+     * Remove all clusters
+     */
+    void clear() {
+        clusters_.clear();
+        index_.clear();
+    }
+
+    /**
+     * Number of clusters in table
+     */
+    size_t size() const { return clusters_.size(); }
+
+    /**
+     * Check if no more clusters can be added
+     */
+    bool full() const { return clusters_.size() >= capacity; }
+
+private:
+    std::vector<std::u32string> clusters_;
+    std::unordered_map<std::u32string, char32_t> index_;
+};
+
+} // namespace termihui
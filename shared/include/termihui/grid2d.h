@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <stdexcept>
 #include <cstddef>
@@ -11,6 +12,12 @@ namespace termihui {
  * 
  * Stores elements in a single flat vector (row-major order)
  * for better cache locality compared to vector<vector<T>>
+ *
+ * Rows are addressed through a ring offset: rotateRows() scrolls the whole grid
+ * in O(1) by moving the logical first row instead of copying elements.
+ * Row-based access (at, operator(), rowPointer, fill*) always uses logical rows;
+ * data() and iterators expose physical storage, which is in logical row order
+ * only while rowOffset() == 0.
  */
 template<typename T>
 class Grid2D {
@@ -49,7 +56,7 @@ public:
      */
     T& at(size_t row, size_t column) {
         checkBounds(row, column);
-        return data_[row * columns_ + column];
+        return data_[physicalRow(row) * columns_ + column];
     }
     
     /**
@@ -58,7 +65,7 @@ public:
      */
     const T& at(size_t row, size_t column) const {
         checkBounds(row, column);
-        return data_[row * columns_ + column];
+        return data_[physicalRow(row) * columns_ + column];
     }
     
     /**
@@ -66,7 +73,7 @@ public:
      * Undefined behavior if indices are out of bounds
      */
     T& operator()(size_t row, size_t column) {
-        return data_[row * columns_ + column];
+        return data_[physicalRow(row) * columns_ + column];
     }
     
     /**
@@ -74,7 +81,7 @@ public:
      * Undefined behavior if indices are out of bounds
      */
     const T& operator()(size_t row, size_t column) const {
-        return data_[row * columns_ + column];
+        return data_[physicalRow(row) * columns_ + column];
     }
     
     /**
@@ -83,16 +90,40 @@ public:
      * @return Pointer to first element in row
      */
     T* rowPointer(size_t row) {
-        return &data_[row * columns_];
+        return &data_[physicalRow(row) * columns_];
     }
     
     /**
      * Get const pointer to start of row
      */
     const T* rowPointer(size_t row) const {
-        return &data_[row * columns_];
+        return &data_[physicalRow(row) * columns_];
     }
     
+    /**
+     * Rotate rows in O(1): logical row r shows former row (r + count) mod rows.
+     * Positive count scrolls content up (former top rows become the bottom rows),
+     * negative count scrolls it down. The rows that wrap around keep their old
+     * content; callers scrolling a screen refill them.
+     * @param count Number of rows to rotate by
+     */
+    void rotateRows(long count) {
+        if (rows_ == 0) {
+            return;
+        }
+        long rows = static_cast<long>(rows_);
+        long shift = count % rows;
+        if (shift < 0) {
+            shift += rows;
+        }
+        rowOffset_ = (rowOffset_ + static_cast<size_t>(shift)) % rows_;
+    }
+    
+    /**
+     * Physical index of logical row 0 in storage
+     */
+    size_t rowOffset() const { return rowOffset_; }
+    
     /**
      * Resize grid, preserving existing data where possible
      * New cells are default-initialized
@@ -104,6 +135,7 @@ public:
             return;
         }
         
+        linearize();
         if (newColumns == columns_) {
             // Simple case: same column count, just resize
             data_.resize(newRows * newColumns);
@@ -135,6 +167,7 @@ public:
             return;
         }
         
+        linearize();
         std::vector<T> newData(newRows * newColumns, defaultValue);
         
         size_t copyRows = std::min(rows_, newRows);
@@ -181,6 +214,7 @@ public:
         data_.clear();
         rows_ = 0;
         columns_ = 0;
+        rowOffset_ = 0;
     }
     
     /**
@@ -222,6 +256,21 @@ public:
     auto cend() const { return data_.cend(); }
 
 private:
+    size_t physicalRow(size_t row) const {
+        size_t physical = row + rowOffset_;
+        return physical >= rows_ ? physical - rows_ : physical;
+    }
+    
+    /**
+     * Move storage back into logical row order (rowOffset() becomes 0)
+     */
+    void linearize() {
+        if (rowOffset_ != 0) {
+            std::rotate(data_.begin(), data_.begin() + static_cast<std::ptrdiff_t>(rowOffset_ * columns_), data_.end());
+            rowOffset_ = 0;
+        }
+    }
+    
     void checkBounds(size_t row, size_t column) const {
         if (row >= rows_ || column >= columns_) {
             throw std::out_of_range(
@@ -234,6 +283,7 @@ private:
     
     size_t rows_;
     size_t columns_;
+    size_t rowOffset_ = 0;
     std::vector<T> data_;
 };
 
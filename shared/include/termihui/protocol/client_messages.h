@@ -18,6 +18,7 @@ struct ExecuteMessage {
 struct InputMessage {
     uint64_t sessionId;
     std::string text;
+    bool paste = false;  // Pasted text: wrapped in bracketed paste markers if the application enabled them
     
     static constexpr const char* type = "input";
 };
@@ -58,6 +59,26 @@ struct GetHistoryMessage {
     static constexpr const char* type = "get_history";
 };
 
+/**
+ * Receive screen and output messages of session
+ * Client without subscriptions receives messages of all sessions.
+ */
+struct SubscribeMessage {
+    uint64_t sessionId;
+    
+    static constexpr const char* type = "subscribe";
+};
+
+/**
+ * Stop receiving screen and output messages of session
+ * Client that unsubscribed from all its sessions receives no session messages at all.
+ */
+struct UnsubscribeMessage {
+    uint64_t sessionId;
+    
+    static constexpr const char* type = "unsubscribe";
+};
+
 // ============================================================================
 // AI Chat messages
 // ============================================================================
@@ -120,6 +141,8 @@ using ClientMessage = std::variant<
     CreateSessionMessage,
     CloseSessionMessage,
     GetHistoryMessage,
+    SubscribeMessage,
+    UnsubscribeMessage,
     AIChatMessage,
     GetChatHistoryMessage,
     ListLLMProvidersMessage,
@@ -4,7 +4,10 @@
 #include "server_messages.h"
 #include <termihui/text_style.h>
 #include <hv/json.hpp>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 using json = nlohmann::json;
 
@@ -49,6 +52,12 @@ void from_json(const json& j, CloseSessionMessage& message);
 void to_json(json& j, const GetHistoryMessage& message);
 void from_json(const json& j, GetHistoryMessage& message);
 
+void to_json(json& j, const SubscribeMessage& message);
+void from_json(const json& j, SubscribeMessage& message);
+
+void to_json(json& j, const UnsubscribeMessage& message);
+void from_json(const json& j, UnsubscribeMessage& message);
+
 void to_json(json& j, const AIChatMessage& message);
 void from_json(const json& j, AIChatMessage& message);
 
@@ -140,9 +149,15 @@ void from_json(const json& j, ScreenRowUpdate& update);
 void to_json(json& j, const ScreenDiffMessage& message);
 void from_json(const json& j, ScreenDiffMessage& message);
 
+void to_json(json& j, const ScreenScrollMessage& message);
+void from_json(const json& j, ScreenScrollMessage& message);
+
 void to_json(json& j, const BlockScreenUpdateMessage& message);
 void from_json(const json& j, BlockScreenUpdateMessage& message);
 
+void to_json(json& j, const OutputSkippedMessage& message);
+void from_json(const json& j, OutputSkippedMessage& message);
+
 void to_json(json& j, const InteractiveModeEndMessage& message);
 void from_json(const json& j, InteractiveModeEndMessage& message);
 
@@ -193,6 +208,8 @@ std::string serialize(const ListSessionsMessage& message);
 std::string serialize(const CreateSessionMessage& message);
 std::string serialize(const CloseSessionMessage& message);
 std::string serialize(const GetHistoryMessage& message);
+std::string serialize(const SubscribeMessage& message);
+std::string serialize(const UnsubscribeMessage& message);
 std::string serialize(const ConnectedMessage& message);
 std::string serialize(const ErrorMessage& message);
 std::string serialize(const OutputMessage& message);
@@ -212,8 +229,10 @@ std::string serialize(const CwdUpdateMessage& message);
 std::string serialize(const InteractiveModeStartMessage& message);
 std::string serialize(const ScreenSnapshotMessage& message);
 std::string serialize(const ScreenDiffMessage& message);
+std::string serialize(const ScreenScrollMessage& message);
 std::string serialize(const InteractiveModeEndMessage& message);
 std::string serialize(const BlockScreenUpdateMessage& message);
+std::string serialize(const OutputSkippedMessage& message);
 std::string serialize(const AIChatMessage& message);
 std::string serialize(const GetChatHistoryMessage& message);
 std::string serialize(const AIChunkMessage& message);
@@ -229,5 +248,32 @@ std::string serialize(const LLMProviderAddedMessage& message);
 std::string serialize(const LLMProviderUpdatedMessage& message);
 std::string serialize(const LLMProviderDeletedMessage& message);
 
+// ============================================================================
+// Screen messages with pre-encoded rows
+// ============================================================================
+
+/**
+ * Row update whose segments are already encoded with encodeSegments()
+ */
+struct EncodedRowUpdate {
+    size_t row;
+    std::string segments;
+    std::optional<size_t> column = std::nullopt;
+};
+
+/**
+ * Encode row segments as JSON array, the form rows take inside screen messages
+ */
+std::string encodeSegments(const std::vector<StyledSegment>& segments);
+
+/**
+ * Serialize screen message with rows encoded beforehand (lines / updates of message are ignored)
+ * Output is identical to serialize() of the message with those rows filled in; lets the server
+ * reuse encodings of rows that didn't change.
+ */
+std::string serialize(const ScreenSnapshotMessage& message, const std::vector<std::string_view>& encodedLines);
+std::string serialize(const ScreenDiffMessage& message, const std::vector<EncodedRowUpdate>& updates);
+std::string serialize(const BlockScreenUpdateMessage& message, const std::vector<EncodedRowUpdate>& updates);
+
 ClientMessage parseClientMessage(const std::string& jsonStr);
 ServerMessage parseServerMessage(const std::string& jsonStr);
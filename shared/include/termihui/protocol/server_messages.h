@@ -127,6 +127,7 @@ struct PromptEndMessage {
 };
 
 struct CwdUpdateMessage {
+    uint64_t sessionId = 0;
     std::string cwd;
     
     static constexpr const char* type = "cwd_update";
@@ -140,6 +141,7 @@ struct CwdUpdateMessage {
  * Sent when entering interactive mode (alternate screen buffer)
  */
 struct InteractiveModeStartMessage {
+    uint64_t sessionId = 0;
     size_t rows;
     size_t columns;
     
@@ -150,6 +152,7 @@ struct InteractiveModeStartMessage {
  * Full screen snapshot (sent after InteractiveModeStart and on reconnect)
  */
 struct ScreenSnapshotMessage {
+    uint64_t sessionId = 0;
     size_t cursorRow;
     size_t cursorColumn;
     std::vector<std::vector<StyledSegment>> lines;  // lines[row] = segments for that row
@@ -159,16 +162,23 @@ struct ScreenSnapshotMessage {
 
 /**
  * Single row update for screen diff
+ *
+ * Without column the segments replace the whole row (trailing blanks trimmed).
+ * With column they replace only the cells starting at that column, one cell per
+ * codepoint, and the rest of the row is kept (padded with blanks if shorter).
+ * Column is only sent for rows without wide characters and multi-codepoint clusters.
  */
 struct ScreenRowUpdate {
     size_t row;
     std::vector<StyledSegment> segments;
+    std::optional<size_t> column = std::nullopt;
 };
 
 /**
  * Screen diff (only changed rows)
  */
 struct ScreenDiffMessage {
+    uint64_t sessionId = 0;
     size_t cursorRow;
     size_t cursorColumn;
     std::vector<ScreenRowUpdate> updates;
@@ -176,10 +186,27 @@ struct ScreenDiffMessage {
     static constexpr const char* type = "screen_diff";
 };
 
+/**
+ * Scroll of screen rows [top, bottom] by count (positive = up, negative = down)
+ *
+ * Client shifts those rows locally and blanks the ones scrolled in; rows that changed
+ * otherwise follow in the next screen_diff. Sent right before it.
+ */
+struct ScreenScrollMessage {
+    uint64_t sessionId = 0;
+    size_t top;
+    size_t bottom;
+    int count;
+    
+    static constexpr const char* type = "screen_scroll";
+};
+
 /**
  * Sent when exiting interactive mode
  */
 struct InteractiveModeEndMessage {
+    uint64_t sessionId = 0;
+    
     static constexpr const char* type = "interactive_mode_end";
 };
 
@@ -196,6 +223,17 @@ struct BlockScreenUpdateMessage {
     static constexpr const char* type = "block_screen_update";
 };
 
+/**
+ * Scrolled-off output lines dropped for a client that fell behind
+ * Lines are stored in history; client may fetch them with get_history.
+ */
+struct OutputSkippedMessage {
+    uint64_t sessionId = 0;
+    size_t count = 0;
+    
+    static constexpr const char* type = "output_skipped";
+};
+
 // ============================================================================
 // AI Chat messages
 // ============================================================================
@@ -298,8 +336,10 @@ using ServerMessage = std::variant<
     InteractiveModeStartMessage,
     ScreenSnapshotMessage,
     ScreenDiffMessage,
+    ScreenScrollMessage,
     InteractiveModeEndMessage,
     BlockScreenUpdateMessage,
+    OutputSkippedMessage,
     AIChunkMessage,
     AIDoneMessage,
     AIErrorMessage,
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "text_style.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace termihui {
+
+/**
+ * Interning table for text styles
+ *
+ * Maps each distinct TextStyle to a small id so cells can store 16 bits instead of
+ * the whole style, and style runs can be detected with an integer compare.
+ * Id 0 is always the default style. Equal styles always get the same id.
+ */
+class StyleTable {
+public:
+    static constexpr StyleId defaultStyleId = 0;
+    static constexpr size_t capacity = size_t(1) << (8 * sizeof(StyleId));
+
+    StyleTable() {
+        clear();
+    }
+
+    /**
+     * Get id for style, adding it to the table if it's new
+     * @return id of style, defaultStyleId if the table is full (call compact() first)
+     */
+    StyleId intern(const TextStyle& style) {
+        auto it = index_.find(style);
+        if (it != index_.end()) {
+            return it->second;
+        }
+        if (full()) {
+            return defaultStyleId;
+        }
+        auto id = static_cast<StyleId>(styles_.size());
+        styles_.push_back(style);
+        index_.emplace(style, id);
+        return id;
+    }
+
+    /**
+     * Get style by id (id must come from this table)
+     */
+    const TextStyle& style(StyleId id) const {
+        return styles_[id];
+    }
+
+    /**
+     * Drop styles that are no longer referenced and renumber the rest densely
+     * @param used Flag per id (indexed by id, size() entries), default style is always kept
+     * @return Mapping old id -> new id (unused ids map to defaultStyleId)
+     */
+    std::vector<StyleId> compact(const std::vector<bool>& used) {
+        std::vector<StyleId> remap(styles_.size(), defaultStyleId);
+        std::vector<TextStyle> styles;
+        styles.reserve(styles_.size());
+        styles.push_back(styles_[defaultStyleId]);
+        index_.clear();
+        index_.emplace(styles_[defaultStyleId], defaultStyleId);
+
+        for (size_t id = 1; id < styles_.size(); ++id) {
+            if (id < used.size() && used[id]) {
+                remap[id] = static_cast<StyleId>(styles.size());
+                index_.emplace(styles_[id], remap[id]);
+                styles.push_back(std::move(styles_[id]));
+            }
+        }
+
+        styles_ = std::move(styles);
+        return remap;
+    }
+
+    /**
+     * Remove all styles except the default one
+     */
+    void clear() {
+        styles_.assign(1, TextStyle{});
+        index_.clear();
+        index_.emplace(TextStyle{}, defaultStyleId);
+    }
+
+    /**
+     * Number of styles in table (including default)
+     */
+    size_t size() const { return styles_.size(); }
+
+    /**
+     * Check if no more styles can be added
+     */
+    bool full() const { return styles_.size() >= capacity; }
+
+private:
+    struct StyleHash {
+        size_t operator()(const TextStyle& style) const {
+            size_t seed = hashColor(style.foreground);
+            seed = seed * 31 + hashColor(style.background);
+            unsigned flags = (style.bold << 0) | (style.dim << 1) | (style.italic << 2) |
+                             (style.underline << 3) | (style.blink << 4) | (style.reverse << 5) |
+                             (style.hidden << 6) | (style.strikethrough << 7);
+            return seed * 31 + flags;
+        }
+
+        static size_t hashColor(const std::optional<Color>& color) {
+            if (!color) {
+                return 0;
+            }
+            uint64_t packed = (uint64_t(color->type) + 1) << 56 |
+                              uint64_t(uint32_t(color->index) & 0xFFFF) << 32 |
+                              uint64_t(color->r & 0xFF) << 16 | uint64_t(color->g & 0xFF) << 8 |
+                              uint64_t(color->b & 0xFF);
+            return std::hash<uint64_t>{}(packed);
+        }
+    };
+
+    std::vector<TextStyle> styles_;
+    std::unordered_map<TextStyle, StyleId, StyleHash> index_;
+};
+
+} // namespace termihui
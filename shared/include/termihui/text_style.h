@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -65,19 +66,36 @@ struct StyledSegment {
 };
 
 /**
- * Terminal cell (character + style)
+ * Id of a TextStyle in the owning screen's StyleTable (0 = default style)
+ */
+using StyleId = uint16_t;
+
+/**
+ * Terminal cell (character + interned style)
+ *
+ * A double-width character takes two cells: the character flagged wide, then a spacer
+ * without content of its own. Character may also be a GraphemeTable cluster id.
  */
 struct Cell {
     char32_t character = U' ';
-    TextStyle style;
+    StyleId styleId = 0;
+    uint16_t flags = 0;
+    
+    static constexpr uint16_t wideFlag = 1;
+    static constexpr uint16_t spacerFlag = 2;
+    
+    bool isWide() const { return flags & wideFlag; }
+    bool isSpacer() const { return flags & spacerFlag; }
     
     bool operator==(const Cell& other) const = default;
     
-    static Cell blank() { return Cell{U' ', TextStyle{}}; }
-    static Cell withCharacter(char32_t ch) { return Cell{ch, TextStyle{}}; }
-    static Cell withCharacter(char32_t ch, const TextStyle& style) { return Cell{ch, style}; }
+    static Cell blank() { return Cell{U' ', 0}; }
+    static Cell withCharacter(char32_t ch) { return Cell{ch, 0}; }
+    static Cell withCharacter(char32_t ch, StyleId styleId) { return Cell{ch, styleId}; }
 };
 
+static_assert(sizeof(Cell) == 8, "Cell is expected to pack into 8 bytes");
+
 /**
  * Standard ANSI color names
  */
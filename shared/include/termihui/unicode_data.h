@@ -0,0 +1,1649 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace termihui::unicode {
+
+/**
+ * Grapheme_Cluster_Break property (UAX #29); CR and LF are folded into Control
+ */
+enum class GraphemeProperty : uint8_t {
+    Other,
+    Control,
+    Extend,
+    ZWJ,
+    RegionalIndicator,
+    Prepend,
+    SpacingMark,
+    L,
+    V,
+    T,
+    LV,
+    LVT,
+    ExtendedPictographic
+};
+
+/**
+ * Codepoints [first, last] sharing column width and grapheme property
+ */
+struct PropertyRange {
+    char32_t first;
+    char32_t last;
+    uint8_t width;
+    GraphemeProperty property;
+};
+
+namespace detail {
+
+using enum GraphemeProperty;
+
+/**
+ * Every codepoint that is not one column wide or not Grapheme_Cluster_Break=Other, sorted
+ *
+ * Derived from Unicode 14.0 data:
+ * - width 2: East_Asian_Width W / F, plus the unassigned parts of the CJK ideograph blocks
+ * - width 0: general categories Mn, Me, Cf (except U+00AD), U+200B, Hangul medial vowels
+ *   and final consonants
+ * - grapheme properties: Grapheme_Cluster_Break and Extended_Pictographic (emoji-data)
+ */
+inline constexpr PropertyRange propertyRanges[] = {
+    {0x00000, 0x0001F, 1, Control},
+    {0x0007F, 0x0009F, 1, Control},
+    {0x000A9, 0x000A9, 1, ExtendedPictographic},
+    {0x000AD, 0x000AD, 1, Control},
+    {0x000AE, 0x000AE, 1, ExtendedPictographic},
+    {0x00300, 0x0036F, 0, Extend},
+    {0x00483, 0x00489, 0, Extend},
+    {0x00591, 0x005BD, 0, Extend},
+    {0x005BF, 0x005BF, 0, Extend},
+    {0x005C1, 0x005C2, 0, Extend},
+    {0x005C4, 0x005C5, 0, Extend},
+    {0x005C7, 0x005C7, 0, Extend},
+    {0x00600, 0x00605, 0, Prepend},
+    {0x00610, 0x0061A, 0, Extend},
+    {0x0061C, 0x0061C, 0, Control},
+    {0x0064B, 0x0065F, 0, Extend},
+    {0x00670, 0x00670, 0, Extend},
+    {0x006D6, 0x006DC, 0, Extend},
+    {0x006DD, 0x006DD, 0, Prepend},
+    {0x006DF, 0x006E4, 0, Extend},
+    {0x006E7, 0x006E8, 0, Extend},
+    {0x006EA, 0x006ED, 0, Extend},
+    {0x0070F, 0x0070F, 0, Prepend},
+    {0x00711, 0x00711, 0, Extend},
+    {0x00730, 0x0074A, 0, Extend},
+    {0x007A6, 0x007B0, 0, Extend},
+    {0x007EB, 0x007F3, 0, Extend},
+    {0x007FD, 0x007FD, 0, Extend},
+    {0x00816, 0x00819, 0, Extend},
+    {0x0081B, 0x00823, 0, Extend},
+    {0x00825, 0x00827, 0, Extend},
+    {0x00829, 0x0082D, 0, Extend},
+    {0x00859, 0x0085B, 0, Extend},
+    {0x00890, 0x00891, 0, Prepend},
+    {0x00898, 0x0089F, 0, Extend},
+    {0x008CA, 0x008E1, 0, Extend},
+    {0x008E2, 0x008E2, 0, Prepend},
+    {0x008E3, 0x00902, 0, Extend},
+    {0x00903, 0x00903, 1, SpacingMark},
+    {0x0093A, 0x0093A, 0, Extend},
+    {0x0093B, 0x0093B, 1, SpacingMark},
+    {0x0093C, 0x0093C, 0, Extend},
+    {0x0093E, 0x00940, 1, SpacingMark},
+    {0x00941, 0x00948, 0, Extend},
+    {0x00949, 0x0094C, 1, SpacingMark},
+    {0x0094D, 0x0094D, 0, Extend},
+    {0x0094E, 0x0094F, 1, SpacingMark},
+    {0x00951, 0x00957, 0, Extend},
+    {0x00962, 0x00963, 0, Extend},
+    {0x00981, 0x00981, 0, Extend},
+    {0x00982, 0x00983, 1, SpacingMark},
+    {0x009BC, 0x009BC, 0, Extend},
+    {0x009BE, 0x009C0, 1, SpacingMark},
+    {0x009C1, 0x009C4, 0, Extend},
+    {0x009C7, 0x009C8, 1, SpacingMark},
+    {0x009CB, 0x009CC, 1, SpacingMark},
+    {0x009CD, 0x009CD, 0, Extend},
+    {0x009D7, 0x009D7, 1, SpacingMark},
+    {0x009E2, 0x009E3, 0, Extend},
+    {0x009FE, 0x009FE, 0, Extend},
+    {0x00A01, 0x00A02, 0, Extend},
+    {0x00A03, 0x00A03, 1, SpacingMark},
+    {0x00A3C, 0x00A3C, 0, Extend},
+    {0x00A3E, 0x00A40, 1, SpacingMark},
+    {0x00A41, 0x00A42, 0, Extend},
+    {0x00A47, 0x00A48, 0, Extend},
+    {0x00A4B, 0x00A4D, 0, Extend},
+    {0x00A51, 0x00A51, 0, Extend},
+    {0x00A70, 0x00A71, 0, Extend},
+    {0x00A75, 0x00A75, 0, Extend},
+    {0x00A81, 0x00A82, 0, Extend},
+    {0x00A83, 0x00A83, 1, SpacingMark},
+    {0x00ABC, 0x00ABC, 0, Extend},
+    {0x00ABE, 0x00AC0, 1, SpacingMark},
+    {0x00AC1, 0x00AC5, 0, Extend},
+    {0x00AC7, 0x00AC8, 0, Extend},
+    {0x00AC9, 0x00AC9, 1, SpacingMark},
+    {0x00ACB, 0x00ACC, 1, SpacingMark},
+    {0x00ACD, 0x00ACD, 0, Extend},
+    {0x00AE2, 0x00AE3, 0, Extend},
+    {0x00AFA, 0x00AFF, 0, Extend},
+    {0x00B01, 0x00B01, 0, Extend},
+    {0x00B02, 0x00B03, 1, SpacingMark},
+    {0x00B3C, 0x00B3C, 0, Extend},
+    {0x00B3E, 0x00B3E, 1, SpacingMark},
+    {0x00B3F, 0x00B3F, 0, Extend},
+    {0x00B40, 0x00B40, 1, SpacingMark},
+    {0x00B41, 0x00B44, 0, Extend},
+    {0x00B47, 0x00B48, 1, SpacingMark},
+    {0x00B4B, 0x00B4C, 1, SpacingMark},
+    {0x00B4D, 0x00B4D, 0, Extend},
+    {0x00B55, 0x00B56, 0, Extend},
+    {0x00B57, 0x00B57, 1, SpacingMark},
+    {0x00B62, 0x00B63, 0, Extend},
+    {0x00B82, 0x00B82, 0, Extend},
+    {0x00BBE, 0x00BBF, 1, SpacingMark},
+    {0x00BC0, 0x00BC0, 0, Extend},
+    {0x00BC1, 0x00BC2, 1, SpacingMark},
+    {0x00BC6, 0x00BC8, 1, SpacingMark},
+    {0x00BCA, 0x00BCC, 1, SpacingMark},
+    {0x00BCD, 0x00BCD, 0, Extend},
+    {0x00BD7, 0x00BD7, 1, SpacingMark},
+    {0x00C00, 0x00C00, 0, Extend},
+    {0x00C01, 0x00C03, 1, SpacingMark},
+    {0x00C04, 0x00C04, 0, Extend},
+    {0x00C3C, 0x00C3C, 0, Extend},
+    {0x00C3E, 0x00C40, 0, Extend},
+    {0x00C41, 0x00C44, 1, SpacingMark},
+    {0x00C46, 0x00C48, 0, Extend},
+    {0x00C4A, 0x00C4D, 0, Extend},
+    {0x00C55, 0x00C56, 0, Extend},
+    {0x00C62, 0x00C63, 0, Extend},
+    {0x00C81, 0x00C81, 0, Extend},
+    {0x00C82, 0x00C83, 1, SpacingMark},
+    {0x00CBC, 0x00CBC, 0, Extend},
+    {0x00CBE, 0x00CBE, 1, SpacingMark},
+    {0x00CBF, 0x00CBF, 0, Extend},
+    {0x00CC0, 0x00CC4, 1, SpacingMark},
+    {0x00CC6, 0x00CC6, 0, Extend},
+    {0x00CC7, 0x00CC8, 1, SpacingMark},
+    {0x00CCA, 0x00CCB, 1, SpacingMark},
+    {0x00CCC, 0x00CCD, 0, Extend},
+    {0x00CD5, 0x00CD6, 1, SpacingMark},
+    {0x00CE2, 0x00CE3, 0, Extend},
+    {0x00D00, 0x00D01, 0, Extend},
+    {0x00D02, 0x00D03, 1, SpacingMark},
+    {0x00D3B, 0x00D3C, 0, Extend},
+    {0x00D3E, 0x00D40, 1, SpacingMark},
+    {0x00D41, 0x00D44, 0, Extend},
+    {0x00D46, 0x00D48, 1, SpacingMark},
+    {0x00D4A, 0x00D4C, 1, SpacingMark},
+    {0x00D4D, 0x00D4D, 0, Extend},
+    {0x00D4E, 0x00D4E, 1, Prepend},
+    {0x00D57, 0x00D57, 1, SpacingMark},
+    {0x00D62, 0x00D63, 0, Extend},
+    {0x00D81, 0x00D81, 0, Extend},
+    {0x00D82, 0x00D83, 1, SpacingMark},
+    {0x00DCA, 0x00DCA, 0, Extend},
+    {0x00DCF, 0x00DD1, 1, SpacingMark},
+    {0x00DD2, 0x00DD4, 0, Extend},
+    {0x00DD6, 0x00DD6, 0, Extend},
+    {0x00DD8, 0x00DDF, 1, SpacingMark},
+    {0x00DF2, 0x00DF3, 1, SpacingMark},
+    {0x00E31, 0x00E31, 0, Extend},
+    {0x00E34, 0x00E3A, 0, Extend},
+    {0x00E47, 0x00E4E, 0, Extend},
+    {0x00EB1, 0x00EB1, 0, Extend},
+    {0x00EB4, 0x00EBC, 0, Extend},
+    {0x00EC8, 0x00ECD, 0, Extend},
+    {0x00F18, 0x00F19, 0, Extend},
+    {0x00F35, 0x00F35, 0, Extend},
+    {0x00F37, 0x00F37, 0, Extend},
+    {0x00F39, 0x00F39, 0, Extend},
+    {0x00F3E, 0x00F3F, 1, SpacingMark},
+    {0x00F71, 0x00F7E, 0, Extend},
+    {0x00F7F, 0x00F7F, 1, SpacingMark},
+    {0x00F80, 0x00F84, 0, Extend},
+    {0x00F86, 0x00F87, 0, Extend},
+    {0x00F8D, 0x00F97, 0, Extend},
+    {0x00F99, 0x00FBC, 0, Extend},
+    {0x00FC6, 0x00FC6, 0, Extend},
+    {0x0102B, 0x0102C, 1, SpacingMark},
+    {0x0102D, 0x01030, 0, Extend},
+    {0x01031, 0x01031, 1, SpacingMark},
+    {0x01032, 0x01037, 0, Extend},
+    {0x01038, 0x01038, 1, SpacingMark},
+    {0x01039, 0x0103A, 0, Extend},
+    {0x0103B, 0x0103C, 1, SpacingMark},
+    {0x0103D, 0x0103E, 0, Extend},
+    {0x01056, 0x01057, 1, SpacingMark},
+    {0x01058, 0x01059, 0, Extend},
+    {0x0105E, 0x01060, 0, Extend},
+    {0x01062, 0x01064, 1, SpacingMark},
+    {0x01067, 0x0106D, 1, SpacingMark},
+    {0x01071, 0x01074, 0, Extend},
+    {0x01082, 0x01082, 0, Extend},
+    {0x01083, 0x01084, 1, SpacingMark},
+    {0x01085, 0x01086, 0, Extend},
+    {0x01087, 0x0108C, 1, SpacingMark},
+    {0x0108D, 0x0108D, 0, Extend},
+    {0x0108F, 0x0108F, 1, SpacingMark},
+    {0x0109A, 0x0109C, 1, SpacingMark},
+    {0x0109D, 0x0109D, 0, Extend},
+    {0x01100, 0x0115F, 2, L},
+    {0x01160, 0x011A7, 0, V},
+    {0x011A8, 0x011FF, 0, T},
+    {0x0135D, 0x0135F, 0, Extend},
+    {0x01712, 0x01714, 0, Extend},
+    {0x01715, 0x01715, 1, SpacingMark},
+    {0x01732, 0x01733, 0, Extend},
+    {0x01734, 0x01734, 1, SpacingMark},
+    {0x01752, 0x01753, 0, Extend},
+    {0x01772, 0x01773, 0, Extend},
+    {0x017B4, 0x017B5, 0, Extend},
+    {0x017B6, 0x017B6, 1, SpacingMark},
+    {0x017B7, 0x017BD, 0, Extend},
+    {0x017BE, 0x017C5, 1, SpacingMark},
+    {0x017C6, 0x017C6, 0, Extend},
+    {0x017C7, 0x017C8, 1, SpacingMark},
+    {0x017C9, 0x017D3, 0, Extend},
+    {0x017DD, 0x017DD, 0, Extend},
+    {0x0180B, 0x0180D, 0, Extend},
+    {0x0180E, 0x0180E, 0, Control},
+    {0x0180F, 0x0180F, 0, Extend},
+    {0x01885, 0x01886, 0, Extend},
+    {0x018A9, 0x018A9, 0, Extend},
+    {0x01920, 0x01922, 0, Extend},
+    {0x01923, 0x01926, 1, SpacingMark},
+    {0x01927, 0x01928, 0, Extend},
+    {0x01929, 0x0192B, 1, SpacingMark},
+    {0x01930, 0x01931, 1, SpacingMark},
+    {0x01932, 0x01932, 0, Extend},
+    {0x01933, 0x01938, 1, SpacingMark},
+    {0x01939, 0x0193B, 0, Extend},
+    {0x01A17, 0x01A18, 0, Extend},
+    {0x01A19, 0x01A1A, 1, SpacingMark},
+    {0x01A1B, 0x01A1B, 0, Extend},
+    {0x01A55, 0x01A55, 1, SpacingMark},
+    {0x01A56, 0x01A56, 0, Extend},
+    {0x01A57, 0x01A57, 1, SpacingMark},
+    {0x01A58, 0x01A5E, 0, Extend},
+    {0x01A60, 0x01A60, 0, Extend},
+    {0x01A61, 0x01A61, 1, SpacingMark},
+    {0x01A62, 0x01A62, 0, Extend},
+    {0x01A63, 0x01A64, 1, SpacingMark},
+    {0x01A65, 0x01A6C, 0, Extend},
+    {0x01A6D, 0x01A72, 1, SpacingMark},
+    {0x01A73, 0x01A7C, 0, Extend},
+    {0x01A7F, 0x01A7F, 0, Extend},
+    {0x01AB0, 0x01ACE, 0, Extend},
+    {0x01B00, 0x01B03, 0, Extend},
+    {0x01B04, 0x01B04, 1, SpacingMark},
+    {0x01B34, 0x01B34, 0, Extend},
+    {0x01B35, 0x01B35, 1, SpacingMark},
+    {0x01B36, 0x01B3A, 0, Extend},
+    {0x01B3B, 0x01B3B, 1, SpacingMark},
+    {0x01B3C, 0x01B3C, 0, Extend},
+    {0x01B3D, 0x01B41, 1, SpacingMark},
+    {0x01B42, 0x01B42, 0, Extend},
+    {0x01B43, 0x01B44, 1, SpacingMark},
+    {0x01B6B, 0x01B73, 0, Extend},
+    {0x01B80, 0x01B81, 0, Extend},
+    {0x01B82, 0x01B82, 1, SpacingMark},
+    {0x01BA1, 0x01BA1, 1, SpacingMark},
+    {0x01BA2, 0x01BA5, 0, Extend},
+    {0x01BA6, 0x01BA7, 1, SpacingMark},
+    {0x01BA8, 0x01BA9, 0, Extend},
+    {0x01BAA, 0x01BAA, 1, SpacingMark},
+    {0x01BAB, 0x01BAD, 0, Extend},
+    {0x01BE6, 0x01BE6, 0, Extend},
+    {0x01BE7, 0x01BE7, 1, SpacingMark},
+    {0x01BE8, 0x01BE9, 0, Extend},
+    {0x01BEA, 0x01BEC, 1, SpacingMark},
+    {0x01BED, 0x01BED, 0, Extend},
+    {0x01BEE, 0x01BEE, 1, SpacingMark},
+    {0x01BEF, 0x01BF1, 0, Extend},
+    {0x01BF2, 0x01BF3, 1, SpacingMark},
+    {0x01C24, 0x01C2B, 1, SpacingMark},
+    {0x01C2C, 0x01C33, 0, Extend},
+    {0x01C34, 0x01C35, 1, SpacingMark},
+    {0x01C36, 0x01C37, 0, Extend},
+    {0x01CD0, 0x01CD2, 0, Extend},
+    {0x01CD4, 0x01CE0, 0, Extend},
+    {0x01CE1, 0x01CE1, 1, SpacingMark},
+    {0x01CE2, 0x01CE8, 0, Extend},
+    {0x01CED, 0x01CED, 0, Extend},
+    {0x01CF4, 0x01CF4, 0, Extend},
+    {0x01CF7, 0x01CF7, 1, SpacingMark},
+    {0x01CF8, 0x01CF9, 0, Extend},
+    {0x01DC0, 0x01DFF, 0, Extend},
+    {0x0200B, 0x0200B, 0, Control},
+    {0x0200C, 0x0200C, 0, Extend},
+    {0x0200D, 0x0200D, 0, ZWJ},
+    {0x0200E, 0x0200F, 0, Control},
+    {0x02028, 0x02029, 1, Control},
+    {0x0202A, 0x0202E, 0, Control},
+    {0x0203C, 0x0203C, 1, ExtendedPictographic},
+    {0x02049, 0x02049, 1, ExtendedPictographic},
+    {0x02060, 0x02064, 0, Control},
+    {0x02066, 0x0206F, 0, Control},
+    {0x020D0, 0x020F0, 0, Extend},
+    {0x02122, 0x02122, 1, ExtendedPictographic},
+    {0x02139, 0x02139, 1, ExtendedPictographic},
+    {0x02194, 0x02199, 1, ExtendedPictographic},
+    {0x021A9, 0x021AA, 1, ExtendedPictographic},
+    {0x0231A, 0x0231B, 2, ExtendedPictographic},
+    {0x02328, 0x02328, 1, ExtendedPictographic},
+    {0x02329, 0x0232A, 2, Other},
+    {0x02388, 0x02388, 1, ExtendedPictographic},
+    {0x023CF, 0x023CF, 1, ExtendedPictographic},
+    {0x023E9, 0x023EC, 2, ExtendedPictographic},
+    {0x023ED, 0x023EF, 1, ExtendedPictographic},
+    {0x023F0, 0x023F0, 2, ExtendedPictographic},
+    {0x023F1, 0x023F2, 1, ExtendedPictographic},
+    {0x023F3, 0x023F3, 2, ExtendedPictographic},
+    {0x023F8, 0x023FA, 1, ExtendedPictographic},
+    {0x024C2, 0x024C2, 1, ExtendedPictographic},
+    {0x025AA, 0x025AB, 1, ExtendedPictographic},
+    {0x025B6, 0x025B6, 1, ExtendedPictographic},
+    {0x025C0, 0x025C0, 1, ExtendedPictographic},
+    {0x025FB, 0x025FC, 1, ExtendedPictographic},
+    {0x025FD, 0x025FE, 2, ExtendedPictographic},
+    {0x02600, 0x02605, 1, ExtendedPictographic},
+    {0x02607, 0x02612, 1, ExtendedPictographic},
+    {0x02614, 0x02615, 2, ExtendedPictographic},
+    {0x02616, 0x02647, 1, ExtendedPictographic},
+    {0x02648, 0x02653, 2, ExtendedPictographic},
+    {0x02654, 0x0267E, 1, ExtendedPictographic},
+    {0x0267F, 0x0267F, 2, ExtendedPictographic},
+    {0x02680, 0x02685, 1, ExtendedPictographic},
+    {0x02690, 0x02692, 1, ExtendedPictographic},
+    {0x02693, 0x02693, 2, ExtendedPictographic},
+    {0x02694, 0x026A0, 1, ExtendedPictographic},
+    {0x026A1, 0x026A1, 2, ExtendedPictographic},
+    {0x026A2, 0x026A9, 1, ExtendedPictographic},
+    {0x026AA, 0x026AB, 2, ExtendedPictographic},
+    {0x026AC, 0x026BC, 1, ExtendedPictographic},
+    {0x026BD, 0x026BE, 2, ExtendedPictographic},
+    {0x026BF, 0x026C3, 1, ExtendedPictographic},
+    {0x026C4, 0x026C5, 2, ExtendedPictographic},
+    {0x026C6, 0x026CD, 1, ExtendedPictographic},
+    {0x026CE, 0x026CE, 2, ExtendedPictographic},
+    {0x026CF, 0x026D3, 1, ExtendedPictographic},
+    {0x026D4, 0x026D4, 2, ExtendedPictographic},
+    {0x026D5, 0x026E9, 1, ExtendedPictographic},
+    {0x026EA, 0x026EA, 2, ExtendedPictographic},
+    {0x026EB, 0x026F1, 1, ExtendedPictographic},
+    {0x026F2, 0x026F3, 2, ExtendedPictographic},
+    {0x026F4, 0x026F4, 1, ExtendedPictographic},
+    {0x026F5, 0x026F5, 2, ExtendedPictographic},
+    {0x026F6, 0x026F9, 1, ExtendedPictographic},
+    {0x026FA, 0x026FA, 2, ExtendedPictographic},
+    {0x026FB, 0x026FC, 1, ExtendedPictographic},
+    {0x026FD, 0x026FD, 2, ExtendedPictographic},
+    {0x026FE, 0x02704, 1, ExtendedPictographic},
+    {0x02705, 0x02705, 2, ExtendedPictographic},
+    {0x02708, 0x02709, 1, ExtendedPictographic},
+    {0x0270A, 0x0270B, 2, ExtendedPictographic},
+    {0x0270C, 0x02712, 1, ExtendedPictographic},
+    {0x02714, 0x02714, 1, ExtendedPictographic},
+    {0x02716, 0x02716, 1, ExtendedPictographic},
+    {0x0271D, 0x0271D, 1, ExtendedPictographic},
+    {0x02721, 0x02721, 1, ExtendedPictographic},
+    {0x02728, 0x02728, 2, ExtendedPictographic},
+    {0x02733, 0x02734, 1, ExtendedPictographic},
+    {0x02744, 0x02744, 1, ExtendedPictographic},
+    {0x02747, 0x02747, 1, ExtendedPictographic},
+    {0x0274C, 0x0274C, 2, ExtendedPictographic},
+    {0x0274E, 0x0274E, 2, ExtendedPictographic},
+    {0x02753, 0x02755, 2, ExtendedPictographic},
+    {0x02757, 0x02757, 2, ExtendedPictographic},
+    {0x02763, 0x02767, 1, ExtendedPictographic},
+    {0x02795, 0x02797, 2, ExtendedPictographic},
+    {0x027A1, 0x027A1, 1, ExtendedPictographic},
+    {0x027B0, 0x027B0, 2, ExtendedPictographic},
+    {0x027BF, 0x027BF, 2, ExtendedPictographic},
+    {0x02934, 0x02935, 1, ExtendedPictographic},
+    {0x02B05, 0x02B07, 1, ExtendedPictographic},
+    {0x02B1B, 0x02B1C, 2, ExtendedPictographic},
+    {0x02B50, 0x02B50, 2, ExtendedPictographic},
+    {0x02B55, 0x02B55, 2, ExtendedPictographic},
+    {0x02CEF, 0x02CF1, 0, Extend},
+    {0x02D7F, 0x02D7F, 0, Extend},
+    {0x02DE0, 0x02DFF, 0, Extend},
+    {0x02E80, 0x02E99, 2, Other},
+    {0x02E9B, 0x02EF3, 2, Other},
+    {0x02F00, 0x02FD5, 2, Other},
+    {0x02FF0, 0x02FFB, 2, Other},
+    {0x03000, 0x03029, 2, Other},
+    {0x0302A, 0x0302D, 0, Extend},
+    {0x0302E, 0x0302F, 2, SpacingMark},
+    {0x03030, 0x03030, 2, ExtendedPictographic},
+    {0x03031, 0x0303C, 2, Other},
+    {0x0303D, 0x0303D, 2, ExtendedPictographic},
+    {0x0303E, 0x0303E, 2, Other},
+    {0x03041, 0x03096, 2, Other},
+    {0x03099, 0x0309A, 0, Extend},
+    {0x0309B, 0x030FF, 2, Other},
+    {0x03105, 0x0312F, 2, Other},
+    {0x03131, 0x0318E, 2, Other},
+    {0x03190, 0x031E3, 2, Other},
+    {0x031F0, 0x0321E, 2, Other},
+    {0x03220, 0x03247, 2, Other},
+    {0x03250, 0x03296, 2, Other},
+    {0x03297, 0x03297, 2, ExtendedPictographic},
+    {0x03298, 0x03298, 2, Other},
+    {0x03299, 0x03299, 2, ExtendedPictographic},
+    {0x0329A, 0x04DBF, 2, Other},
+    {0x04E00, 0x0A48C, 2, Other},
+    {0x0A490, 0x0A4C6, 2, Other},
+    {0x0A66F, 0x0A672, 0, Extend},
+    {0x0A674, 0x0A67D, 0, Extend},
+    {0x0A69E, 0x0A69F, 0, Extend},
+    {0x0A6F0, 0x0A6F1, 0, Extend},
+    {0x0A802, 0x0A802, 0, Extend},
+    {0x0A806, 0x0A806, 0, Extend},
+    {0x0A80B, 0x0A80B, 0, Extend},
+    {0x0A823, 0x0A824, 1, SpacingMark},
+    {0x0A825, 0x0A826, 0, Extend},
+    {0x0A827, 0x0A827, 1, SpacingMark},
+    {0x0A82C, 0x0A82C, 0, Extend},
+    {0x0A880, 0x0A881, 1, SpacingMark},
+    {0x0A8B4, 0x0A8C3, 1, SpacingMark},
+    {0x0A8C4, 0x0A8C5, 0, Extend},
+    {0x0A8E0, 0x0A8F1, 0, Extend},
+    {0x0A8FF, 0x0A8FF, 0, Extend},
+    {0x0A926, 0x0A92D, 0, Extend},
+    {0x0A947, 0x0A951, 0, Extend},
+    {0x0A952, 0x0A953, 1, SpacingMark},
+    {0x0A960, 0x0A97C, 2, L},
+    {0x0A980, 0x0A982, 0, Extend},
+    {0x0A983, 0x0A983, 1, SpacingMark},
+    {0x0A9B3, 0x0A9B3, 0, Extend},
+    {0x0A9B4, 0x0A9B5, 1, SpacingMark},
+    {0x0A9B6, 0x0A9B9, 0, Extend},
+    {0x0A9BA, 0x0A9BB, 1, SpacingMark},
+    {0x0A9BC, 0x0A9BD, 0, Extend},
+    {0x0A9BE, 0x0A9C0, 1, SpacingMark},
+    {0x0A9E5, 0x0A9E5, 0, Extend},
+    {0x0AA29, 0x0AA2E, 0, Extend},
+    {0x0AA2F, 0x0AA30, 1, SpacingMark},
+    {0x0AA31, 0x0AA32, 0, Extend},
+    {0x0AA33, 0x0AA34, 1, SpacingMark},
+    {0x0AA35, 0x0AA36, 0, Extend},
+    {0x0AA43, 0x0AA43, 0, Extend},
+    {0x0AA4C, 0x0AA4C, 0, Extend},
+    {0x0AA4D, 0x0AA4D, 1, SpacingMark},
+    {0x0AA7B, 0x0AA7B, 1, SpacingMark},
+    {0x0AA7C, 0x0AA7C, 0, Extend},
+    {0x0AA7D, 0x0AA7D, 1, SpacingMark},
+    {0x0AAB0, 0x0AAB0, 0, Extend},
+    {0x0AAB2, 0x0AAB4, 0, Extend},
+    {0x0AAB7, 0x0AAB8, 0, Extend},
+    {0x0AABE, 0x0AABF, 0, Extend},
+    {0x0AAC1, 0x0AAC1, 0, Extend},
+    {0x0AAEB, 0x0AAEB, 1, SpacingMark},
+    {0x0AAEC, 0x0AAED, 0, Extend},
+    {0x0AAEE, 0x0AAEF, 1, SpacingMark},
+    {0x0AAF5, 0x0AAF5, 1, SpacingMark},
+    {0x0AAF6, 0x0AAF6, 0, Extend},
+    {0x0ABE3, 0x0ABE4, 1, SpacingMark},
+    {0x0ABE5, 0x0ABE5, 0, Extend},
+    {0x0ABE6, 0x0ABE7, 1, SpacingMark},
+    {0x0ABE8, 0x0ABE8, 0, Extend},
+    {0x0ABE9, 0x0ABEA, 1, SpacingMark},
+    {0x0ABEC, 0x0ABEC, 1, SpacingMark},
+    {0x0ABED, 0x0ABED, 0, Extend},
+    {0x0AC00, 0x0AC00, 2, LV},
+    {0x0AC01, 0x0AC1B, 2, LVT},
+    {0x0AC1C, 0x0AC1C, 2, LV},
+    {0x0AC1D, 0x0AC37, 2, LVT},
+    {0x0AC38, 0x0AC38, 2, LV},
+    {0x0AC39, 0x0AC53, 2, LVT},
+    {0x0AC54, 0x0AC54, 2, LV},
+    {0x0AC55, 0x0AC6F, 2, LVT},
+    {0x0AC70, 0x0AC70, 2, LV},
+    {0x0AC71, 0x0AC8B, 2, LVT},
+    {0x0AC8C, 0x0AC8C, 2, LV},
+    {0x0AC8D, 0x0ACA7, 2, LVT},
+    {0x0ACA8, 0x0ACA8, 2, LV},
+    {0x0ACA9, 0x0ACC3, 2, LVT},
+    {0x0ACC4, 0x0ACC4, 2, LV},
+    {0x0ACC5, 0x0ACDF, 2, LVT},
+    {0x0ACE0, 0x0ACE0, 2, LV},
+    {0x0ACE1, 0x0ACFB, 2, LVT},
+    {0x0ACFC, 0x0ACFC, 2, LV},
+    {0x0ACFD, 0x0AD17, 2, LVT},
+    {0x0AD18, 0x0AD18, 2, LV},
+    {0x0AD19, 0x0AD33, 2, LVT},
+    {0x0AD34, 0x0AD34, 2, LV},
+    {0x0AD35, 0x0AD4F, 2, LVT},
+    {0x0AD50, 0x0AD50, 2, LV},
+    {0x0AD51, 0x0AD6B, 2, LVT},
+    {0x0AD6C, 0x0AD6C, 2, LV},
+    {0x0AD6D, 0x0AD87, 2, LVT},
+    {0x0AD88, 0x0AD88, 2, LV},
+    {0x0AD89, 0x0ADA3, 2, LVT},
+    {0x0ADA4, 0x0ADA4, 2, LV},
+    {0x0ADA5, 0x0ADBF, 2, LVT},
+    {0x0ADC0, 0x0ADC0, 2, LV},
+    {0x0ADC1, 0x0ADDB, 2, LVT},
+    {0x0ADDC, 0x0ADDC, 2, LV},
+    {0x0ADDD, 0x0ADF7, 2, LVT},
+    {0x0ADF8, 0x0ADF8, 2, LV},
+    {0x0ADF9, 0x0AE13, 2, LVT},
+    {0x0AE14, 0x0AE14, 2, LV},
+    {0x0AE15, 0x0AE2F, 2, LVT},
+    {0x0AE30, 0x0AE30, 2, LV},
+    {0x0AE31, 0x0AE4B, 2, LVT},
+    {0x0AE4C, 0x0AE4C, 2, LV},
+    {0x0AE4D, 0x0AE67, 2, LVT},
+    {0x0AE68, 0x0AE68, 2, LV},
+    {0x0AE69, 0x0AE83, 2, LVT},
+    {0x0AE84, 0x0AE84, 2, LV},
+    {0x0AE85, 0x0AE9F, 2, LVT},
+    {0x0AEA0, 0x0AEA0, 2, LV},
+    {0x0AEA1, 0x0AEBB, 2, LVT},
+    {0x0AEBC, 0x0AEBC, 2, LV},
+    {0x0AEBD, 0x0AED7, 2, LVT},
+    {0x0AED8, 0x0AED8, 2, LV},
+    {0x0AED9, 0x0AEF3, 2, LVT},
+    {0x0AEF4, 0x0AEF4, 2, LV},
+    {0x0AEF5, 0x0AF0F, 2, LVT},
+    {0x0AF10, 0x0AF10, 2, LV},
+    {0x0AF11, 0x0AF2B, 2, LVT},
+    {0x0AF2C, 0x0AF2C, 2, LV},
+    {0x0AF2D, 0x0AF47, 2, LVT},
+    {0x0AF48, 0x0AF48, 2, LV},
+    {0x0AF49, 0x0AF63, 2, LVT},
+    {0x0AF64, 0x0AF64, 2, LV},
+    {0x0AF65, 0x0AF7F, 2, LVT},
+    {0x0AF80, 0x0AF80, 2, LV},
+    {0x0AF81, 0x0AF9B, 2, LVT},
+    {0x0AF9C, 0x0AF9C, 2, LV},
+    {0x0AF9D, 0x0AFB7, 2, LVT},
+    {0x0AFB8, 0x0AFB8, 2, LV},
+    {0x0AFB9, 0x0AFD3, 2, LVT},
+    {0x0AFD4, 0x0AFD4, 2, LV},
+    {0x0AFD5, 0x0AFEF, 2, LVT},
+    {0x0AFF0, 0x0AFF0, 2, LV},
+    {0x0AFF1, 0x0B00B, 2, LVT},
+    {0x0B00C, 0x0B00C, 2, LV},
+    {0x0B00D, 0x0B027, 2, LVT},
+    {0x0B028, 0x0B028, 2, LV},
+    {0x0B029, 0x0B043, 2, LVT},
+    {0x0B044, 0x0B044, 2, LV},
+    {0x0B045, 0x0B05F, 2, LVT},
+    {0x0B060, 0x0B060, 2, LV},
+    {0x0B061, 0x0B07B, 2, LVT},
+    {0x0B07C, 0x0B07C, 2, LV},
+    {0x0B07D, 0x0B097, 2, LVT},
+    {0x0B098, 0x0B098, 2, LV},
+    {0x0B099, 0x0B0B3, 2, LVT},
+    {0x0B0B4, 0x0B0B4, 2, LV},
+    {0x0B0B5, 0x0B0CF, 2, LVT},
+    {0x0B0D0, 0x0B0D0, 2, LV},
+    {0x0B0D1, 0x0B0EB, 2, LVT},
+    {0x0B0EC, 0x0B0EC, 2, LV},
+    {0x0B0ED, 0x0B107, 2, LVT},
+    {0x0B108, 0x0B108, 2, LV},
+    {0x0B109, 0x0B123, 2, LVT},
+    {0x0B124, 0x0B124, 2, LV},
+    {0x0B125, 0x0B13F, 2, LVT},
+    {0x0B140, 0x0B140, 2, LV},
+    {0x0B141, 0x0B15B, 2, LVT},
+    {0x0B15C, 0x0B15C, 2, LV},
+    {0x0B15D, 0x0B177, 2, LVT},
+    {0x0B178, 0x0B178, 2, LV},
+    {0x0B179, 0x0B193, 2, LVT},
+    {0x0B194, 0x0B194, 2, LV},
+    {0x0B195, 0x0B1AF, 2, LVT},
+    {0x0B1B0, 0x0B1B0, 2, LV},
+    {0x0B1B1, 0x0B1CB, 2, LVT},
+    {0x0B1CC, 0x0B1CC, 2, LV},
+    {0x0B1CD, 0x0B1E7, 2, LVT},
+    {0x0B1E8, 0x0B1E8, 2, LV},
+    {0x0B1E9, 0x0B203, 2, LVT},
+    {0x0B204, 0x0B204, 2, LV},
+    {0x0B205, 0x0B21F, 2, LVT},
+    {0x0B220, 0x0B220, 2, LV},
+    {0x0B221, 0x0B23B, 2, LVT},
+    {0x0B23C, 0x0B23C, 2, LV},
+    {0x0B23D, 0x0B257, 2, LVT},
+    {0x0B258, 0x0B258, 2, LV},
+    {0x0B259, 0x0B273, 2, LVT},
+    {0x0B274, 0x0B274, 2, LV},
+    {0x0B275, 0x0B28F, 2, LVT},
+    {0x0B290, 0x0B290, 2, LV},
+    {0x0B291, 0x0B2AB, 2, LVT},
+    {0x0B2AC, 0x0B2AC, 2, LV},
+    {0x0B2AD, 0x0B2C7, 2, LVT},
+    {0x0B2C8, 0x0B2C8, 2, LV},
+    {0x0B2C9, 0x0B2E3, 2, LVT},
+    {0x0B2E4, 0x0B2E4, 2, LV},
+    {0x0B2E5, 0x0B2FF, 2, LVT},
+    {0x0B300, 0x0B300, 2, LV},
+    {0x0B301, 0x0B31B, 2, LVT},
+    {0x0B31C, 0x0B31C, 2, LV},
+    {0x0B31D, 0x0B337, 2, LVT},
+    {0x0B338, 0x0B338, 2, LV},
+    {0x0B339, 0x0B353, 2, LVT},
+    {0x0B354, 0x0B354, 2, LV},
+    {0x0B355, 0x0B36F, 2, LVT},
+    {0x0B370, 0x0B370, 2, LV},
+    {0x0B371, 0x0B38B, 2, LVT},
+    {0x0B38C, 0x0B38C, 2, LV},
+    {0x0B38D, 0x0B3A7, 2, LVT},
+    {0x0B3A8, 0x0B3A8, 2, LV},
+    {0x0B3A9, 0x0B3C3, 2, LVT},
+    {0x0B3C4, 0x0B3C4, 2, LV},
+    {0x0B3C5, 0x0B3DF, 2, LVT},
+    {0x0B3E0, 0x0B3E0, 2, LV},
+    {0x0B3E1, 0x0B3FB, 2, LVT},
+    {0x0B3FC, 0x0B3FC, 2, LV},
+    {0x0B3FD, 0x0B417, 2, LVT},
+    {0x0B418, 0x0B418, 2, LV},
+    {0x0B419, 0x0B433, 2, LVT},
+    {0x0B434, 0x0B434, 2, LV},
+    {0x0B435, 0x0B44F, 2, LVT},
+    {0x0B450, 0x0B450, 2, LV},
+    {0x0B451, 0x0B46B, 2, LVT},
+    {0x0B46C, 0x0B46C, 2, LV},
+    {0x0B46D, 0x0B487, 2, LVT},
+    {0x0B488, 0x0B488, 2, LV},
+    {0x0B489, 0x0B4A3, 2, LVT},
+    {0x0B4A4, 0x0B4A4, 2, LV},
+    {0x0B4A5, 0x0B4BF, 2, LVT},
+    {0x0B4C0, 0x0B4C0, 2, LV},
+    {0x0B4C1, 0x0B4DB, 2, LVT},
+    {0x0B4DC, 0x0B4DC, 2, LV},
+    {0x0B4DD, 0x0B4F7, 2, LVT},
+    {0x0B4F8, 0x0B4F8, 2, LV},
+    {0x0B4F9, 0x0B513, 2, LVT},
+    {0x0B514, 0x0B514, 2, LV},
+    {0x0B515, 0x0B52F, 2, LVT},
+    {0x0B530, 0x0B530, 2, LV},
+    {0x0B531, 0x0B54B, 2, LVT},
+    {0x0B54C, 0x0B54C, 2, LV},
+    {0x0B54D, 0x0B567, 2, LVT},
+    {0x0B568, 0x0B568, 2, LV},
+    {0x0B569, 0x0B583, 2, LVT},
+    {0x0B584, 0x0B584, 2, LV},
+    {0x0B585, 0x0B59F, 2, LVT},
+    {0x0B5A0, 0x0B5A0, 2, LV},
+    {0x0B5A1, 0x0B5BB, 2, LVT},
+    {0x0B5BC, 0x0B5BC, 2, LV},
+    {0x0B5BD, 0x0B5D7, 2, LVT},
+    {0x0B5D8, 0x0B5D8, 2, LV},
+    {0x0B5D9, 0x0B5F3, 2, LVT},
+    {0x0B5F4, 0x0B5F4, 2, LV},
+    {0x0B5F5, 0x0B60F, 2, LVT},
+    {0x0B610, 0x0B610, 2, LV},
+    {0x0B611, 0x0B62B, 2, LVT},
+    {0x0B62C, 0x0B62C, 2, LV},
+    {0x0B62D, 0x0B647, 2, LVT},
+    {0x0B648, 0x0B648, 2, LV},
+    {0x0B649, 0x0B663, 2, LVT},
+    {0x0B664, 0x0B664, 2, LV},
+    {0x0B665, 0x0B67F, 2, LVT},
+    {0x0B680, 0x0B680, 2, LV},
+    {0x0B681, 0x0B69B, 2, LVT},
+    {0x0B69C, 0x0B69C, 2, LV},
+    {0x0B69D, 0x0B6B7, 2, LVT},
+    {0x0B6B8, 0x0B6B8, 2, LV},
+    {0x0B6B9, 0x0B6D3, 2, LVT},
+    {0x0B6D4, 0x0B6D4, 2, LV},
+    {0x0B6D5, 0x0B6EF, 2, LVT},
+    {0x0B6F0, 0x0B6F0, 2, LV},
+    {0x0B6F1, 0x0B70B, 2, LVT},
+    {0x0B70C, 0x0B70C, 2, LV},
+    {0x0B70D, 0x0B727, 2, LVT},
+    {0x0B728, 0x0B728, 2, LV},
+    {0x0B729, 0x0B743, 2, LVT},
+    {0x0B744, 0x0B744, 2, LV},
+    {0x0B745, 0x0B75F, 2, LVT},
+    {0x0B760, 0x0B760, 2, LV},
+    {0x0B761, 0x0B77B, 2, LVT},
+    {0x0B77C, 0x0B77C, 2, LV},
+    {0x0B77D, 0x0B797, 2, LVT},
+    {0x0B798, 0x0B798, 2, LV},
+    {0x0B799, 0x0B7B3, 2, LVT},
+    {0x0B7B4, 0x0B7B4, 2, LV},
+    {0x0B7B5, 0x0B7CF, 2, LVT},
+    {0x0B7D0, 0x0B7D0, 2, LV},
+    {0x0B7D1, 0x0B7EB, 2, LVT},
+    {0x0B7EC, 0x0B7EC, 2, LV},
+    {0x0B7ED, 0x0B807, 2, LVT},
+    {0x0B808, 0x0B808, 2, LV},
+    {0x0B809, 0x0B823, 2, LVT},
+    {0x0B824, 0x0B824, 2, LV},
+    {0x0B825, 0x0B83F, 2, LVT},
+    {0x0B840, 0x0B840, 2, LV},
+    {0x0B841, 0x0B85B, 2, LVT},
+    {0x0B85C, 0x0B85C, 2, LV},
+    {0x0B85D, 0x0B877, 2, LVT},
+    {0x0B878, 0x0B878, 2, LV},
+    {0x0B879, 0x0B893, 2, LVT},
+    {0x0B894, 0x0B894, 2, LV},
+    {0x0B895, 0x0B8AF, 2, LVT},
+    {0x0B8B0, 0x0B8B0, 2, LV},
+    {0x0B8B1, 0x0B8CB, 2, LVT},
+    {0x0B8CC, 0x0B8CC, 2, LV},
+    {0x0B8CD, 0x0B8E7, 2, LVT},
+    {0x0B8E8, 0x0B8E8, 2, LV},
+    {0x0B8E9, 0x0B903, 2, LVT},
+    {0x0B904, 0x0B904, 2, LV},
+    {0x0B905, 0x0B91F, 2, LVT},
+    {0x0B920, 0x0B920, 2, LV},
+    {0x0B921, 0x0B93B, 2, LVT},
+    {0x0B93C, 0x0B93C, 2, LV},
+    {0x0B93D, 0x0B957, 2, LVT},
+    {0x0B958, 0x0B958, 2, LV},
+    {0x0B959, 0x0B973, 2, LVT},
+    {0x0B974, 0x0B974, 2, LV},
+    {0x0B975, 0x0B98F, 2, LVT},
+    {0x0B990, 0x0B990, 2, LV},
+    {0x0B991, 0x0B9AB, 2, LVT},
+    {0x0B9AC, 0x0B9AC, 2, LV},
+    {0x0B9AD, 0x0B9C7, 2, LVT},
+    {0x0B9C8, 0x0B9C8, 2, LV},
+    {0x0B9C9, 0x0B9E3, 2, LVT},
+    {0x0B9E4, 0x0B9E4, 2, LV},
+    {0x0B9E5, 0x0B9FF, 2, LVT},
+    {0x0BA00, 0x0BA00, 2, LV},
+    {0x0BA01, 0x0BA1B, 2, LVT},
+    {0x0BA1C, 0x0BA1C, 2, LV},
+    {0x0BA1D, 0x0BA37, 2, LVT},
+    {0x0BA38, 0x0BA38, 2, LV},
+    {0x0BA39, 0x0BA53, 2, LVT},
+    {0x0BA54, 0x0BA54, 2, LV},
+    {0x0BA55, 0x0BA6F, 2, LVT},
+    {0x0BA70, 0x0BA70, 2, LV},
+    {0x0BA71, 0x0BA8B, 2, LVT},
+    {0x0BA8C, 0x0BA8C, 2, LV},
+    {0x0BA8D, 0x0BAA7, 2, LVT},
+    {0x0BAA8, 0x0BAA8, 2, LV},
+    {0x0BAA9, 0x0BAC3, 2, LVT},
+    {0x0BAC4, 0x0BAC4, 2, LV},
+    {0x0BAC5, 0x0BADF, 2, LVT},
+    {0x0BAE0, 0x0BAE0, 2, LV},
+    {0x0BAE1, 0x0BAFB, 2, LVT},
+    {0x0BAFC, 0x0BAFC, 2, LV},
+    {0x0BAFD, 0x0BB17, 2, LVT},
+    {0x0BB18, 0x0BB18, 2, LV},
+    {0x0BB19, 0x0BB33, 2, LVT},
+    {0x0BB34, 0x0BB34, 2, LV},
+    {0x0BB35, 0x0BB4F, 2, LVT},
+    {0x0BB50, 0x0BB50, 2, LV},
+    {0x0BB51, 0x0BB6B, 2, LVT},
+    {0x0BB6C, 0x0BB6C, 2, LV},
+    {0x0BB6D, 0x0BB87, 2, LVT},
+    {0x0BB88, 0x0BB88, 2, LV},
+    {0x0BB89, 0x0BBA3, 2, LVT},
+    {0x0BBA4, 0x0BBA4, 2, LV},
+    {0x0BBA5, 0x0BBBF, 2, LVT},
+    {0x0BBC0, 0x0BBC0, 2, LV},
+    {0x0BBC1, 0x0BBDB, 2, LVT},
+    {0x0BBDC, 0x0BBDC, 2, LV},
+    {0x0BBDD, 0x0BBF7, 2, LVT},
+    {0x0BBF8, 0x0BBF8, 2, LV},
+    {0x0BBF9, 0x0BC13, 2, LVT},
+    {0x0BC14, 0x0BC14, 2, LV},
+    {0x0BC15, 0x0BC2F, 2, LVT},
+    {0x0BC30, 0x0BC30, 2, LV},
+    {0x0BC31, 0x0BC4B, 2, LVT},
+    {0x0BC4C, 0x0BC4C, 2, LV},
+    {0x0BC4D, 0x0BC67, 2, LVT},
+    {0x0BC68, 0x0BC68, 2, LV},
+    {0x0BC69, 0x0BC83, 2, LVT},
+    {0x0BC84, 0x0BC84, 2, LV},
+    {0x0BC85, 0x0BC9F, 2, LVT},
+    {0x0BCA0, 0x0BCA0, 2, LV},
+    {0x0BCA1, 0x0BCBB, 2, LVT},
+    {0x0BCBC, 0x0BCBC, 2, LV},
+    {0x0BCBD, 0x0BCD7, 2, LVT},
+    {0x0BCD8, 0x0BCD8, 2, LV},
+    {0x0BCD9, 0x0BCF3, 2, LVT},
+    {0x0BCF4, 0x0BCF4, 2, LV},
+    {0x0BCF5, 0x0BD0F, 2, LVT},
+    {0x0BD10, 0x0BD10, 2, LV},
+    {0x0BD11, 0x0BD2B, 2, LVT},
+    {0x0BD2C, 0x0BD2C, 2, LV},
+    {0x0BD2D, 0x0BD47, 2, LVT},
+    {0x0BD48, 0x0BD48, 2, LV},
+    {0x0BD49, 0x0BD63, 2, LVT},
+    {0x0BD64, 0x0BD64, 2, LV},
+    {0x0BD65, 0x0BD7F, 2, LVT},
+    {0x0BD80, 0x0BD80, 2, LV},
+    {0x0BD81, 0x0BD9B, 2, LVT},
+    {0x0BD9C, 0x0BD9C, 2, LV},
+    {0x0BD9D, 0x0BDB7, 2, LVT},
+    {0x0BDB8, 0x0BDB8, 2, LV},
+    {0x0BDB9, 0x0BDD3, 2, LVT},
+    {0x0BDD4, 0x0BDD4, 2, LV},
+    {0x0BDD5, 0x0BDEF, 2, LVT},
+    {0x0BDF0, 0x0BDF0, 2, LV},
+    {0x0BDF1, 0x0BE0B, 2, LVT},
+    {0x0BE0C, 0x0BE0C, 2, LV},
+    {0x0BE0D, 0x0BE27, 2, LVT},
+    {0x0BE28, 0x0BE28, 2, LV},
+    {0x0BE29, 0x0BE43, 2, LVT},
+    {0x0BE44, 0x0BE44, 2, LV},
+    {0x0BE45, 0x0BE5F, 2, LVT},
+    {0x0BE60, 0x0BE60, 2, LV},
+    {0x0BE61, 0x0BE7B, 2, LVT},
+    {0x0BE7C, 0x0BE7C, 2, LV},
+    {0x0BE7D, 0x0BE97, 2, LVT},
+    {0x0BE98, 0x0BE98, 2, LV},
+    {0x0BE99, 0x0BEB3, 2, LVT},
+    {0x0BEB4, 0x0BEB4, 2, LV},
+    {0x0BEB5, 0x0BECF, 2, LVT},
+    {0x0BED0, 0x0BED0, 2, LV},
+    {0x0BED1, 0x0BEEB, 2, LVT},
+    {0x0BEEC, 0x0BEEC, 2, LV},
+    {0x0BEED, 0x0BF07, 2, LVT},
+    {0x0BF08, 0x0BF08, 2, LV},
+    {0x0BF09, 0x0BF23, 2, LVT},
+    {0x0BF24, 0x0BF24, 2, LV},
+    {0x0BF25, 0x0BF3F, 2, LVT},
+    {0x0BF40, 0x0BF40, 2, LV},
+    {0x0BF41, 0x0BF5B, 2, LVT},
+    {0x0BF5C, 0x0BF5C, 2, LV},
+    {0x0BF5D, 0x0BF77, 2, LVT},
+    {0x0BF78, 0x0BF78, 2, LV},
+    {0x0BF79, 0x0BF93, 2, LVT},
+    {0x0BF94, 0x0BF94, 2, LV},
+    {0x0BF95, 0x0BFAF, 2, LVT},
+    {0x0BFB0, 0x0BFB0, 2, LV},
+    {0x0BFB1, 0x0BFCB, 2, LVT},
+    {0x0BFCC, 0x0BFCC, 2, LV},
+    {0x0BFCD, 0x0BFE7, 2, LVT},
+    {0x0BFE8, 0x0BFE8, 2, LV},
+    {0x0BFE9, 0x0C003, 2, LVT},
+    {0x0C004, 0x0C004, 2, LV},
+    {0x0C005, 0x0C01F, 2, LVT},
+    {0x0C020, 0x0C020, 2, LV},
+    {0x0C021, 0x0C03B, 2, LVT},
+    {0x0C03C, 0x0C03C, 2, LV},
+    {0x0C03D, 0x0C057, 2, LVT},
+    {0x0C058, 0x0C058, 2, LV},
+    {0x0C059, 0x0C073, 2, LVT},
+    {0x0C074, 0x0C074, 2, LV},
+    {0x0C075, 0x0C08F, 2, LVT},
+    {0x0C090, 0x0C090, 2, LV},
+    {0x0C091, 0x0C0AB, 2, LVT},
+    {0x0C0AC, 0x0C0AC, 2, LV},
+    {0x0C0AD, 0x0C0C7, 2, LVT},
+    {0x0C0C8, 0x0C0C8, 2, LV},
+    {0x0C0C9, 0x0C0E3, 2, LVT},
+    {0x0C0E4, 0x0C0E4, 2, LV},
+    {0x0C0E5, 0x0C0FF, 2, LVT},
+    {0x0C100, 0x0C100, 2, LV},
+    {0x0C101, 0x0C11B, 2, LVT},
+    {0x0C11C, 0x0C11C, 2, LV},
+    {0x0C11D, 0x0C137, 2, LVT},
+    {0x0C138, 0x0C138, 2, LV},
+    {0x0C139, 0x0C153, 2, LVT},
+    {0x0C154, 0x0C154, 2, LV},
+    {0x0C155, 0x0C16F, 2, LVT},
+    {0x0C170, 0x0C170, 2, LV},
+    {0x0C171, 0x0C18B, 2, LVT},
+    {0x0C18C, 0x0C18C, 2, LV},
+    {0x0C18D, 0x0C1A7, 2, LVT},
+    {0x0C1A8, 0x0C1A8, 2, LV},
+    {0x0C1A9, 0x0C1C3, 2, LVT},
+    {0x0C1C4, 0x0C1C4, 2, LV},
+    {0x0C1C5, 0x0C1DF, 2, LVT},
+    {0x0C1E0, 0x0C1E0, 2, LV},
+    {0x0C1E1, 0x0C1FB, 2, LVT},
+    {0x0C1FC, 0x0C1FC, 2, LV},
+    {0x0C1FD, 0x0C217, 2, LVT},
+    {0x0C218, 0x0C218, 2, LV},
+    {0x0C219, 0x0C233, 2, LVT},
+    {0x0C234, 0x0C234, 2, LV},
+    {0x0C235, 0x0C24F, 2, LVT},
+    {0x0C250, 0x0C250, 2, LV},
+    {0x0C251, 0x0C26B, 2, LVT},
+    {0x0C26C, 0x0C26C, 2, LV},
+    {0x0C26D, 0x0C287, 2, LVT},
+    {0x0C288, 0x0C288, 2, LV},
+    {0x0C289, 0x0C2A3, 2, LVT},
+    {0x0C2A4, 0x0C2A4, 2, LV},
+    {0x0C2A5, 0x0C2BF, 2, LVT},
+    {0x0C2C0, 0x0C2C0, 2, LV},
+    {0x0C2C1, 0x0C2DB, 2, LVT},
+    {0x0C2DC, 0x0C2DC, 2, LV},
+    {0x0C2DD, 0x0C2F7, 2, LVT},
+    {0x0C2F8, 0x0C2F8, 2, LV},
+    {0x0C2F9, 0x0C313, 2, LVT},
+    {0x0C314, 0x0C314, 2, LV},
+    {0x0C315, 0x0C32F, 2, LVT},
+    {0x0C330, 0x0C330, 2, LV},
+    {0x0C331, 0x0C34B, 2, LVT},
+    {0x0C34C, 0x0C34C, 2, LV},
+    {0x0C34D, 0x0C367, 2, LVT},
+    {0x0C368, 0x0C368, 2, LV},
+    {0x0C369, 0x0C383, 2, LVT},
+    {0x0C384, 0x0C384, 2, LV},
+    {0x0C385, 0x0C39F, 2, LVT},
+    {0x0C3A0, 0x0C3A0, 2, LV},
+    {0x0C3A1, 0x0C3BB, 2, LVT},
+    {0x0C3BC, 0x0C3BC, 2, LV},
+    {0x0C3BD, 0x0C3D7, 2, LVT},
+    {0x0C3D8, 0x0C3D8, 2, LV},
+    {0x0C3D9, 0x0C3F3, 2, LVT},
+    {0x0C3F4, 0x0C3F4, 2, LV},
+    {0x0C3F5, 0x0C40F, 2, LVT},
+    {0x0C410, 0x0C410, 2, LV},
+    {0x0C411, 0x0C42B, 2, LVT},
+    {0x0C42C, 0x0C42C, 2, LV},
+    {0x0C42D, 0x0C447, 2, LVT},
+    {0x0C448, 0x0C448, 2, LV},
+    {0x0C449, 0x0C463, 2, LVT},
+    {0x0C464, 0x0C464, 2, LV},
+    {0x0C465, 0x0C47F, 2, LVT},
+    {0x0C480, 0x0C480, 2, LV},
+    {0x0C481, 0x0C49B, 2, LVT},
+    {0x0C49C, 0x0C49C, 2, LV},
+    {0x0C49D, 0x0C4B7, 2, LVT},
+    {0x0C4B8, 0x0C4B8, 2, LV},
+    {0x0C4B9, 0x0C4D3, 2, LVT},
+    {0x0C4D4, 0x0C4D4, 2, LV},
+    {0x0C4D5, 0x0C4EF, 2, LVT},
+    {0x0C4F0, 0x0C4F0, 2, LV},
+    {0x0C4F1, 0x0C50B, 2, LVT},
+    {0x0C50C, 0x0C50C, 2, LV},
+    {0x0C50D, 0x0C527, 2, LVT},
+    {0x0C528, 0x0C528, 2, LV},
+    {0x0C529, 0x0C543, 2, LVT},
+    {0x0C544, 0x0C544, 2, LV},
+    {0x0C545, 0x0C55F, 2, LVT},
+    {0x0C560, 0x0C560, 2, LV},
+    {0x0C561, 0x0C57B, 2, LVT},
+    {0x0C57C, 0x0C57C, 2, LV},
+    {0x0C57D, 0x0C597, 2, LVT},
+    {0x0C598, 0x0C598, 2, LV},
+    {0x0C599, 0x0C5B3, 2, LVT},
+    {0x0C5B4, 0x0C5B4, 2, LV},
+    {0x0C5B5, 0x0C5CF, 2, LVT},
+    {0x0C5D0, 0x0C5D0, 2, LV},
+    {0x0C5D1, 0x0C5EB, 2, LVT},
+    {0x0C5EC, 0x0C5EC, 2, LV},
+    {0x0C5ED, 0x0C607, 2, LVT},
+    {0x0C608, 0x0C608, 2, LV},
+    {0x0C609, 0x0C623, 2, LVT},
+    {0x0C624, 0x0C624, 2, LV},
+    {0x0C625, 0x0C63F, 2, LVT},
+    {0x0C640, 0x0C640, 2, LV},
+    {0x0C641, 0x0C65B, 2, LVT},
+    {0x0C65C, 0x0C65C, 2, LV},
+    {0x0C65D, 0x0C677, 2, LVT},
+    {0x0C678, 0x0C678, 2, LV},
+    {0x0C679, 0x0C693, 2, LVT},
+    {0x0C694, 0x0C694, 2, LV},
+    {0x0C695, 0x0C6AF, 2, LVT},
+    {0x0C6B0, 0x0C6B0, 2, LV},
+    {0x0C6B1, 0x0C6CB, 2, LVT},
+    {0x0C6CC, 0x0C6CC, 2, LV},
+    {0x0C6CD, 0x0C6E7, 2, LVT},
+    {0x0C6E8, 0x0C6E8, 2, LV},
+    {0x0C6E9, 0x0C703, 2, LVT},
+    {0x0C704, 0x0C704, 2, LV},
+    {0x0C705, 0x0C71F, 2, LVT},
+    {0x0C720, 0x0C720, 2, LV},
+    {0x0C721, 0x0C73B, 2, LVT},
+    {0x0C73C, 0x0C73C, 2, LV},
+    {0x0C73D, 0x0C757, 2, LVT},
+    {0x0C758, 0x0C758, 2, LV},
+    {0x0C759, 0x0C773, 2, LVT},
+    {0x0C774, 0x0C774, 2, LV},
+    {0x0C775, 0x0C78F, 2, LVT},
+    {0x0C790, 0x0C790, 2, LV},
+    {0x0C791, 0x0C7AB, 2, LVT},
+    {0x0C7AC, 0x0C7AC, 2, LV},
+    {0x0C7AD, 0x0C7C7, 2, LVT},
+    {0x0C7C8, 0x0C7C8, 2, LV},
+    {0x0C7C9, 0x0C7E3, 2, LVT},
+    {0x0C7E4, 0x0C7E4, 2, LV},
+    {0x0C7E5, 0x0C7FF, 2, LVT},
+    {0x0C800, 0x0C800, 2, LV},
+    {0x0C801, 0x0C81B, 2, LVT},
+    {0x0C81C, 0x0C81C, 2, LV},
+    {0x0C81D, 0x0C837, 2, LVT},
+    {0x0C838, 0x0C838, 2, LV},
+    {0x0C839, 0x0C853, 2, LVT},
+    {0x0C854, 0x0C854, 2, LV},
+    {0x0C855, 0x0C86F, 2, LVT},
+    {0x0C870, 0x0C870, 2, LV},
+    {0x0C871, 0x0C88B, 2, LVT},
+    {0x0C88C, 0x0C88C, 2, LV},
+    {0x0C88D, 0x0C8A7, 2, LVT},
+    {0x0C8A8, 0x0C8A8, 2, LV},
+    {0x0C8A9, 0x0C8C3, 2, LVT},
+    {0x0C8C4, 0x0C8C4, 2, LV},
+    {0x0C8C5, 0x0C8DF, 2, LVT},
+    {0x0C8E0, 0x0C8E0, 2, LV},
+    {0x0C8E1, 0x0C8FB, 2, LVT},
+    {0x0C8FC, 0x0C8FC, 2, LV},
+    {0x0C8FD, 0x0C917, 2, LVT},
+    {0x0C918, 0x0C918, 2, LV},
+    {0x0C919, 0x0C933, 2, LVT},
+    {0x0C934, 0x0C934, 2, LV},
+    {0x0C935, 0x0C94F, 2, LVT},
+    {0x0C950, 0x0C950, 2, LV},
+    {0x0C951, 0x0C96B, 2, LVT},
+    {0x0C96C, 0x0C96C, 2, LV},
+    {0x0C96D, 0x0C987, 2, LVT},
+    {0x0C988, 0x0C988, 2, LV},
+    {0x0C989, 0x0C9A3, 2, LVT},
+    {0x0C9A4, 0x0C9A4, 2, LV},
+    {0x0C9A5, 0x0C9BF, 2, LVT},
+    {0x0C9C0, 0x0C9C0, 2, LV},
+    {0x0C9C1, 0x0C9DB, 2, LVT},
+    {0x0C9DC, 0x0C9DC, 2, LV},
+    {0x0C9DD, 0x0C9F7, 2, LVT},
+    {0x0C9F8, 0x0C9F8, 2, LV},
+    {0x0C9F9, 0x0CA13, 2, LVT},
+    {0x0CA14, 0x0CA14, 2, LV},
+    {0x0CA15, 0x0CA2F, 2, LVT},
+    {0x0CA30, 0x0CA30, 2, LV},
+    {0x0CA31, 0x0CA4B, 2, LVT},
+    {0x0CA4C, 0x0CA4C, 2, LV},
+    {0x0CA4D, 0x0CA67, 2, LVT},
+    {0x0CA68, 0x0CA68, 2, LV},
+    {0x0CA69, 0x0CA83, 2, LVT},
+    {0x0CA84, 0x0CA84, 2, LV},
+    {0x0CA85, 0x0CA9F, 2, LVT},
+    {0x0CAA0, 0x0CAA0, 2, LV},
+    {0x0CAA1, 0x0CABB, 2, LVT},
+    {0x0CABC, 0x0CABC, 2, LV},
+    {0x0CABD, 0x0CAD7, 2, LVT},
+    {0x0CAD8, 0x0CAD8, 2, LV},
+    {0x0CAD9, 0x0CAF3, 2, LVT},
+    {0x0CAF4, 0x0CAF4, 2, LV},
+    {0x0CAF5, 0x0CB0F, 2, LVT},
+    {0x0CB10, 0x0CB10, 2, LV},
+    {0x0CB11, 0x0CB2B, 2, LVT},
+    {0x0CB2C, 0x0CB2C, 2, LV},
+    {0x0CB2D, 0x0CB47, 2, LVT},
+    {0x0CB48, 0x0CB48, 2, LV},
+    {0x0CB49, 0x0CB63, 2, LVT},
+    {0x0CB64, 0x0CB64, 2, LV},
+    {0x0CB65, 0x0CB7F, 2, LVT},
+    {0x0CB80, 0x0CB80, 2, LV},
+    {0x0CB81, 0x0CB9B, 2, LVT},
+    {0x0CB9C, 0x0CB9C, 2, LV},
+    {0x0CB9D, 0x0CBB7, 2, LVT},
+    {0x0CBB8, 0x0CBB8, 2, LV},
+    {0x0CBB9, 0x0CBD3, 2, LVT},
+    {0x0CBD4, 0x0CBD4, 2, LV},
+    {0x0CBD5, 0x0CBEF, 2, LVT},
+    {0x0CBF0, 0x0CBF0, 2, LV},
+    {0x0CBF1, 0x0CC0B, 2, LVT},
+    {0x0CC0C, 0x0CC0C, 2, LV},
+    {0x0CC0D, 0x0CC27, 2, LVT},
+    {0x0CC28, 0x0CC28, 2, LV},
+    {0x0CC29, 0x0CC43, 2, LVT},
+    {0x0CC44, 0x0CC44, 2, LV},
+    {0x0CC45, 0x0CC5F, 2, LVT},
+    {0x0CC60, 0x0CC60, 2, LV},
+    {0x0CC61, 0x0CC7B, 2, LVT},
+    {0x0CC7C, 0x0CC7C, 2, LV},
+    {0x0CC7D, 0x0CC97, 2, LVT},
+    {0x0CC98, 0x0CC98, 2, LV},
+    {0x0CC99, 0x0CCB3, 2, LVT},
+    {0x0CCB4, 0x0CCB4, 2, LV},
+    {0x0CCB5, 0x0CCCF, 2, LVT},
+    {0x0CCD0, 0x0CCD0, 2, LV},
+    {0x0CCD1, 0x0CCEB, 2, LVT},
+    {0x0CCEC, 0x0CCEC, 2, LV},
+    {0x0CCED, 0x0CD07, 2, LVT},
+    {0x0CD08, 0x0CD08, 2, LV},
+    {0x0CD09, 0x0CD23, 2, LVT},
+    {0x0CD24, 0x0CD24, 2, LV},
+    {0x0CD25, 0x0CD3F, 2, LVT},
+    {0x0CD40, 0x0CD40, 2, LV},
+    {0x0CD41, 0x0CD5B, 2, LVT},
+    {0x0CD5C, 0x0CD5C, 2, LV},
+    {0x0CD5D, 0x0CD77, 2, LVT},
+    {0x0CD78, 0x0CD78, 2, LV},
+    {0x0CD79, 0x0CD93, 2, LVT},
+    {0x0CD94, 0x0CD94, 2, LV},
+    {0x0CD95, 0x0CDAF, 2, LVT},
+    {0x0CDB0, 0x0CDB0, 2, LV},
+    {0x0CDB1, 0x0CDCB, 2, LVT},
+    {0x0CDCC, 0x0CDCC, 2, LV},
+    {0x0CDCD, 0x0CDE7, 2, LVT},
+    {0x0CDE8, 0x0CDE8, 2, LV},
+    {0x0CDE9, 0x0CE03, 2, LVT},
+    {0x0CE04, 0x0CE04, 2, LV},
+    {0x0CE05, 0x0CE1F, 2, LVT},
+    {0x0CE20, 0x0CE20, 2, LV},
+    {0x0CE21, 0x0CE3B, 2, LVT},
+    {0x0CE3C, 0x0CE3C, 2, LV},
+    {0x0CE3D, 0x0CE57, 2, LVT},
+    {0x0CE58, 0x0CE58, 2, LV},
+    {0x0CE59, 0x0CE73, 2, LVT},
+    {0x0CE74, 0x0CE74, 2, LV},
+    {0x0CE75, 0x0CE8F, 2, LVT},
+    {0x0CE90, 0x0CE90, 2, LV},
+    {0x0CE91, 0x0CEAB, 2, LVT},
+    {0x0CEAC, 0x0CEAC, 2, LV},
+    {0x0CEAD, 0x0CEC7, 2, LVT},
+    {0x0CEC8, 0x0CEC8, 2, LV},
+    {0x0CEC9, 0x0CEE3, 2, LVT},
+    {0x0CEE4, 0x0CEE4, 2, LV},
+    {0x0CEE5, 0x0CEFF, 2, LVT},
+    {0x0CF00, 0x0CF00, 2, LV},
+    {0x0CF01, 0x0CF1B, 2, LVT},
+    {0x0CF1C, 0x0CF1C, 2, LV},
+    {0x0CF1D, 0x0CF37, 2, LVT},
+    {0x0CF38, 0x0CF38, 2, LV},
+    {0x0CF39, 0x0CF53, 2, LVT},
+    {0x0CF54, 0x0CF54, 2, LV},
+    {0x0CF55, 0x0CF6F, 2, LVT},
+    {0x0CF70, 0x0CF70, 2, LV},
+    {0x0CF71, 0x0CF8B, 2, LVT},
+    {0x0CF8C, 0x0CF8C, 2, LV},
+    {0x0CF8D, 0x0CFA7, 2, LVT},
+    {0x0CFA8, 0x0CFA8, 2, LV},
+    {0x0CFA9, 0x0CFC3, 2, LVT},
+    {0x0CFC4, 0x0CFC4, 2, LV},
+    {0x0CFC5, 0x0CFDF, 2, LVT},
+    {0x0CFE0, 0x0CFE0, 2, LV},
+    {0x0CFE1, 0x0CFFB, 2, LVT},
+    {0x0CFFC, 0x0CFFC, 2, LV},
+    {0x0CFFD, 0x0D017, 2, LVT},
+    {0x0D018, 0x0D018, 2, LV},
+    {0x0D019, 0x0D033, 2, LVT},
+    {0x0D034, 0x0D034, 2, LV},
+    {0x0D035, 0x0D04F, 2, LVT},
+    {0x0D050, 0x0D050, 2, LV},
+    {0x0D051, 0x0D06B, 2, LVT},
+    {0x0D06C, 0x0D06C, 2, LV},
+    {0x0D06D, 0x0D087, 2, LVT},
+    {0x0D088, 0x0D088, 2, LV},
+    {0x0D089, 0x0D0A3, 2, LVT},
+    {0x0D0A4, 0x0D0A4, 2, LV},
+    {0x0D0A5, 0x0D0BF, 2, LVT},
+    {0x0D0C0, 0x0D0C0, 2, LV},
+    {0x0D0C1, 0x0D0DB, 2, LVT},
+    {0x0D0DC, 0x0D0DC, 2, LV},
+    {0x0D0DD, 0x0D0F7, 2, LVT},
+    {0x0D0F8, 0x0D0F8, 2, LV},
+    {0x0D0F9, 0x0D113, 2, LVT},
+    {0x0D114, 0x0D114, 2, LV},
+    {0x0D115, 0x0D12F, 2, LVT},
+    {0x0D130, 0x0D130, 2, LV},
+    {0x0D131, 0x0D14B, 2, LVT},
+    {0x0D14C, 0x0D14C, 2, LV},
+    {0x0D14D, 0x0D167, 2, LVT},
+    {0x0D168, 0x0D168, 2, LV},
+    {0x0D169, 0x0D183, 2, LVT},
+    {0x0D184, 0x0D184, 2, LV},
+    {0x0D185, 0x0D19F, 2, LVT},
+    {0x0D1A0, 0x0D1A0, 2, LV},
+    {0x0D1A1, 0x0D1BB, 2, LVT},
+    {0x0D1BC, 0x0D1BC, 2, LV},
+    {0x0D1BD, 0x0D1D7, 2, LVT},
+    {0x0D1D8, 0x0D1D8, 2, LV},
+    {0x0D1D9, 0x0D1F3, 2, LVT},
+    {0x0D1F4, 0x0D1F4, 2, LV},
+    {0x0D1F5, 0x0D20F, 2, LVT},
+    {0x0D210, 0x0D210, 2, LV},
+    {0x0D211, 0x0D22B, 2, LVT},
+    {0x0D22C, 0x0D22C, 2, LV},
+    {0x0D22D, 0x0D247, 2, LVT},
+    {0x0D248, 0x0D248, 2, LV},
+    {0x0D249, 0x0D263, 2, LVT},
+    {0x0D264, 0x0D264, 2, LV},
+    {0x0D265, 0x0D27F, 2, LVT},
+    {0x0D280, 0x0D280, 2, LV},
+    {0x0D281, 0x0D29B, 2, LVT},
+    {0x0D29C, 0x0D29C, 2, LV},
+    {0x0D29D, 0x0D2B7, 2, LVT},
+    {0x0D2B8, 0x0D2B8, 2, LV},
+    {0x0D2B9, 0x0D2D3, 2, LVT},
+    {0x0D2D4, 0x0D2D4, 2, LV},
+    {0x0D2D5, 0x0D2EF, 2, LVT},
+    {0x0D2F0, 0x0D2F0, 2, LV},
+    {0x0D2F1, 0x0D30B, 2, LVT},
+    {0x0D30C, 0x0D30C, 2, LV},
+    {0x0D30D, 0x0D327, 2, LVT},
+    {0x0D328, 0x0D328, 2, LV},
+    {0x0D329, 0x0D343, 2, LVT},
+    {0x0D344, 0x0D344, 2, LV},
+    {0x0D345, 0x0D35F, 2, LVT},
+    {0x0D360, 0x0D360, 2, LV},
+    {0x0D361, 0x0D37B, 2, LVT},
+    {0x0D37C, 0x0D37C, 2, LV},
+    {0x0D37D, 0x0D397, 2, LVT},
+    {0x0D398, 0x0D398, 2, LV},
+    {0x0D399, 0x0D3B3, 2, LVT},
+    {0x0D3B4, 0x0D3B4, 2, LV},
+    {0x0D3B5, 0x0D3CF, 2, LVT},
+    {0x0D3D0, 0x0D3D0, 2, LV},
+    {0x0D3D1, 0x0D3EB, 2, LVT},
+    {0x0D3EC, 0x0D3EC, 2, LV},
+    {0x0D3ED, 0x0D407, 2, LVT},
+    {0x0D408, 0x0D408, 2, LV},
+    {0x0D409, 0x0D423, 2, LVT},
+    {0x0D424, 0x0D424, 2, LV},
+    {0x0D425, 0x0D43F, 2, LVT},
+    {0x0D440, 0x0D440, 2, LV},
+    {0x0D441, 0x0D45B, 2, LVT},
+    {0x0D45C, 0x0D45C, 2, LV},
+    {0x0D45D, 0x0D477, 2, LVT},
+    {0x0D478, 0x0D478, 2, LV},
+    {0x0D479, 0x0D493, 2, LVT},
+    {0x0D494, 0x0D494, 2, LV},
+    {0x0D495, 0x0D4AF, 2, LVT},
+    {0x0D4B0, 0x0D4B0, 2, LV},
+    {0x0D4B1, 0x0D4CB, 2, LVT},
+    {0x0D4CC, 0x0D4CC, 2, LV},
+    {0x0D4CD, 0x0D4E7, 2, LVT},
+    {0x0D4E8, 0x0D4E8, 2, LV},
+    {0x0D4E9, 0x0D503, 2, LVT},
+    {0x0D504, 0x0D504, 2, LV},
+    {0x0D505, 0x0D51F, 2, LVT},
+    {0x0D520, 0x0D520, 2, LV},
+    {0x0D521, 0x0D53B, 2, LVT},
+    {0x0D53C, 0x0D53C, 2, LV},
+    {0x0D53D, 0x0D557, 2, LVT},
+    {0x0D558, 0x0D558, 2, LV},
+    {0x0D559, 0x0D573, 2, LVT},
+    {0x0D574, 0x0D574, 2, LV},
+    {0x0D575, 0x0D58F, 2, LVT},
+    {0x0D590, 0x0D590, 2, LV},
+    {0x0D591, 0x0D5AB, 2, LVT},
+    {0x0D5AC, 0x0D5AC, 2, LV},
+    {0x0D5AD, 0x0D5C7, 2, LVT},
+    {0x0D5C8, 0x0D5C8, 2, LV},
+    {0x0D5C9, 0x0D5E3, 2, LVT},
+    {0x0D5E4, 0x0D5E4, 2, LV},
+    {0x0D5E5, 0x0D5FF, 2, LVT},
+    {0x0D600, 0x0D600, 2, LV},
+    {0x0D601, 0x0D61B, 2, LVT},
+    {0x0D61C, 0x0D61C, 2, LV},
+    {0x0D61D, 0x0D637, 2, LVT},
+    {0x0D638, 0x0D638, 2, LV},
+    {0x0D639, 0x0D653, 2, LVT},
+    {0x0D654, 0x0D654, 2, LV},
+    {0x0D655, 0x0D66F, 2, LVT},
+    {0x0D670, 0x0D670, 2, LV},
+    {0x0D671, 0x0D68B, 2, LVT},
+    {0x0D68C, 0x0D68C, 2, LV},
+    {0x0D68D, 0x0D6A7, 2, LVT},
+    {0x0D6A8, 0x0D6A8, 2, LV},
+    {0x0D6A9, 0x0D6C3, 2, LVT},
+    {0x0D6C4, 0x0D6C4, 2, LV},
+    {0x0D6C5, 0x0D6DF, 2, LVT},
+    {0x0D6E0, 0x0D6E0, 2, LV},
+    {0x0D6E1, 0x0D6FB, 2, LVT},
+    {0x0D6FC, 0x0D6FC, 2, LV},
+    {0x0D6FD, 0x0D717, 2, LVT},
+    {0x0D718, 0x0D718, 2, LV},
+    {0x0D719, 0x0D733, 2, LVT},
+    {0x0D734, 0x0D734, 2, LV},
+    {0x0D735, 0x0D74F, 2, LVT},
+    {0x0D750, 0x0D750, 2, LV},
+    {0x0D751, 0x0D76B, 2, LVT},
+    {0x0D76C, 0x0D76C, 2, LV},
+    {0x0D76D, 0x0D787, 2, LVT},
+    {0x0D788, 0x0D788, 2, LV},
+    {0x0D789, 0x0D7A3, 2, LVT},
+    {0x0D7B0, 0x0D7C6, 0, V},
+    {0x0D7C7, 0x0D7CA, 0, Other},
+    {0x0D7CB, 0x0D7FB, 0, T},
+    {0x0D7FC, 0x0D7FF, 0, Other},
+    {0x0F900, 0x0FAFF, 2, Other},
+    {0x0FB1E, 0x0FB1E, 0, Extend},
+    {0x0FE00, 0x0FE0F, 0, Extend},
+    {0x0FE10, 0x0FE19, 2, Other},
+    {0x0FE20, 0x0FE2F, 0, Extend},
+    {0x0FE30, 0x0FE52, 2, Other},
+    {0x0FE54, 0x0FE66, 2, Other},
+    {0x0FE68, 0x0FE6B, 2, Other},
+    {0x0FEFF, 0x0FEFF, 0, Control},
+    {0x0FF01, 0x0FF60, 2, Other},
+    {0x0FF9E, 0x0FF9F, 1, Extend},
+    {0x0FFE0, 0x0FFE6, 2, Other},
+    {0x0FFF9, 0x0FFFB, 0, Control},
+    {0x101FD, 0x101FD, 0, Extend},
+    {0x102E0, 0x102E0, 0, Extend},
+    {0x10376, 0x1037A, 0, Extend},
+    {0x10A01, 0x10A03, 0, Extend},
+    {0x10A05, 0x10A06, 0, Extend},
+    {0x10A0C, 0x10A0F, 0, Extend},
+    {0x10A38, 0x10A3A, 0, Extend},
+    {0x10A3F, 0x10A3F, 0, Extend},
+    {0x10AE5, 0x10AE6, 0, Extend},
+    {0x10D24, 0x10D27, 0, Extend},
+    {0x10EAB, 0x10EAC, 0, Extend},
+    {0x10F46, 0x10F50, 0, Extend},
+    {0x10F82, 0x10F85, 0, Extend},
+    {0x11000, 0x11000, 1, SpacingMark},
+    {0x11001, 0x11001, 0, Extend},
+    {0x11002, 0x11002, 1, SpacingMark},
+    {0x11038, 0x11046, 0, Extend},
+    {0x11070, 0x11070, 0, Extend},
+    {0x11073, 0x11074, 0, Extend},
+    {0x1107F, 0x11081, 0, Extend},
+    {0x11082, 0x11082, 1, SpacingMark},
+    {0x110B0, 0x110B2, 1, SpacingMark},
+    {0x110B3, 0x110B6, 0, Extend},
+    {0x110B7, 0x110B8, 1, SpacingMark},
+    {0x110B9, 0x110BA, 0, Extend},
+    {0x110BD, 0x110BD, 0, Prepend},
+    {0x110C2, 0x110C2, 0, Extend},
+    {0x110CD, 0x110CD, 0, Prepend},
+    {0x11100, 0x11102, 0, Extend},
+    {0x11127, 0x1112B, 0, Extend},
+    {0x1112C, 0x1112C, 1, SpacingMark},
+    {0x1112D, 0x11134, 0, Extend},
+    {0x11145, 0x11146, 1, SpacingMark},
+    {0x11173, 0x11173, 0, Extend},
+    {0x11180, 0x11181, 0, Extend},
+    {0x11182, 0x11182, 1, SpacingMark},
+    {0x111B3, 0x111B5, 1, SpacingMark},
+    {0x111B6, 0x111BE, 0, Extend},
+    {0x111BF, 0x111C0, 1, SpacingMark},
+    {0x111C2, 0x111C3, 1, Prepend},
+    {0x111C9, 0x111CC, 0, Extend},
+    {0x111CE, 0x111CE, 1, SpacingMark},
+    {0x111CF, 0x111CF, 0, Extend},
+    {0x1122C, 0x1122E, 1, SpacingMark},
+    {0x1122F, 0x11231, 0, Extend},
+    {0x11232, 0x11233, 1, SpacingMark},
+    {0x11234, 0x11234, 0, Extend},
+    {0x11235, 0x11235, 1, SpacingMark},
+    {0x11236, 0x11237, 0, Extend},
+    {0x1123E, 0x1123E, 0, Extend},
+    {0x112DF, 0x112DF, 0, Extend},
+    {0x112E0, 0x112E2, 1, SpacingMark},
+    {0x112E3, 0x112EA, 0, Extend},
+    {0x11300, 0x11301, 0, Extend},
+    {0x11302, 0x11303, 1, SpacingMark},
+    {0x1133B, 0x1133C, 0, Extend},
+    {0x1133E, 0x1133F, 1, SpacingMark},
+    {0x11340, 0x11340, 0, Extend},
+    {0x11341, 0x11344, 1, SpacingMark},
+    {0x11347, 0x11348, 1, SpacingMark},
+    {0x1134B, 0x1134D, 1, SpacingMark},
+    {0x11357, 0x11357, 1, SpacingMark},
+    {0x11362, 0x11363, 1, SpacingMark},
+    {0x11366, 0x1136C, 0, Extend},
+    {0x11370, 0x11374, 0, Extend},
+    {0x11435, 0x11437, 1, SpacingMark},
+    {0x11438, 0x1143F, 0, Extend},
+    {0x11440, 0x11441, 1, SpacingMark},
+    {0x11442, 0x11444, 0, Extend},
+    {0x11445, 0x11445, 1, SpacingMark},
+    {0x11446, 0x11446, 0, Extend},
+    {0x1145E, 0x1145E, 0, Extend},
+    {0x114B0, 0x114B2, 1, SpacingMark},
+    {0x114B3, 0x114B8, 0, Extend},
+    {0x114B9, 0x114B9, 1, SpacingMark},
+    {0x114BA, 0x114BA, 0, Extend},
+    {0x114BB, 0x114BE, 1, SpacingMark},
+    {0x114BF, 0x114C0, 0, Extend},
+    {0x114C1, 0x114C1, 1, SpacingMark},
+    {0x114C2, 0x114C3, 0, Extend},
+    {0x115AF, 0x115B1, 1, SpacingMark},
+    {0x115B2, 0x115B5, 0, Extend},
+    {0x115B8, 0x115BB, 1, SpacingMark},
+    {0x115BC, 0x115BD, 0, Extend},
+    {0x115BE, 0x115BE, 1, SpacingMark},
+    {0x115BF, 0x115C0, 0, Extend},
+    {0x115DC, 0x115DD, 0, Extend},
+    {0x11630, 0x11632, 1, SpacingMark},
+    {0x11633, 0x1163A, 0, Extend},
+    {0x1163B, 0x1163C, 1, SpacingMark},
+    {0x1163D, 0x1163D, 0, Extend},
+    {0x1163E, 0x1163E, 1, SpacingMark},
+    {0x1163F, 0x11640, 0, Extend},
+    {0x116AB, 0x116AB, 0, Extend},
+    {0x116AC, 0x116AC, 1, SpacingMark},
+    {0x116AD, 0x116AD, 0, Extend},
+    {0x116AE, 0x116AF, 1, SpacingMark},
+    {0x116B0, 0x116B5, 0, Extend},
+    {0x116B6, 0x116B6, 1, SpacingMark},
+    {0x116B7, 0x116B7, 0, Extend},
+    {0x1171D, 0x1171F, 0, Extend},
+    {0x11720, 0x11721, 1, SpacingMark},
+    {0x11722, 0x11725, 0, Extend},
+    {0x11726, 0x11726, 1, SpacingMark},
+    {0x11727, 0x1172B, 0, Extend},
+    {0x1182C, 0x1182E, 1, SpacingMark},
+    {0x1182F, 0x11837, 0, Extend},
+    {0x11838, 0x11838, 1, SpacingMark},
+    {0x11839, 0x1183A, 0, Extend},
+    {0x11930, 0x11935, 1, SpacingMark},
+    {0x11937, 0x11938, 1, SpacingMark},
+    {0x1193B, 0x1193C, 0, Extend},
+    {0x1193D, 0x1193D, 1, SpacingMark},
+    {0x1193E, 0x1193E, 0, Extend},
+    {0x1193F, 0x1193F, 1, Prepend},
+    {0x11940, 0x11940, 1, SpacingMark},
+    {0x11941, 0x11941, 1, Prepend},
+    {0x11942, 0x11942, 1, SpacingMark},
+    {0x11943, 0x11943, 0, Extend},
+    {0x119D1, 0x119D3, 1, SpacingMark},
+    {0x119D4, 0x119D7, 0, Extend},
+    {0x119DA, 0x119DB, 0, Extend},
+    {0x119DC, 0x119DF, 1, SpacingMark},
+    {0x119E0, 0x119E0, 0, Extend},
+    {0x119E4, 0x119E4, 1, SpacingMark},
+    {0x11A01, 0x11A0A, 0, Extend},
+    {0x11A33, 0x11A38, 0, Extend},
+    {0x11A39, 0x11A39, 1, SpacingMark},
+    {0x11A3A, 0x11A3A, 1, Prepend},
+    {0x11A3B, 0x11A3E, 0, Extend},
+    {0x11A47, 0x11A47, 0, Extend},
+    {0x11A51, 0x11A56, 0, Extend},
+    {0x11A57, 0x11A58, 1, SpacingMark},
+    {0x11A59, 0x11A5B, 0, Extend},
+    {0x11A84, 0x11A89, 1, Prepend},
+    {0x11A8A, 0x11A96, 0, Extend},
+    {0x11A97, 0x11A97, 1, SpacingMark},
+    {0x11A98, 0x11A99, 0, Extend},
+    {0x11C2F, 0x11C2F, 1, SpacingMark},
+    {0x11C30, 0x11C36, 0, Extend},
+    {0x11C38, 0x11C3D, 0, Extend},
+    {0x11C3E, 0x11C3E, 1, SpacingMark},
+    {0x11C3F, 0x11C3F, 0, Extend},
+    {0x11C92, 0x11CA7, 0, Extend},
+    {0x11CA9, 0x11CA9, 1, SpacingMark},
+    {0x11CAA, 0x11CB0, 0, Extend},
+    {0x11CB1, 0x11CB1, 1, SpacingMark},
+    {0x11CB2, 0x11CB3, 0, Extend},
+    {0x11CB4, 0x11CB4, 1, SpacingMark},
+    {0x11CB5, 0x11CB6, 0, Extend},
+    {0x11D31, 0x11D36, 0, Extend},
+    {0x11D3A, 0x11D3A, 0, Extend},
+    {0x11D3C, 0x11D3D, 0, Extend},
+    {0x11D3F, 0x11D45, 0, Extend},
+    {0x11D46, 0x11D46, 1, Prepend},
+    {0x11D47, 0x11D47, 0, Extend},
+    {0x11D8A, 0x11D8E, 1, SpacingMark},
+    {0x11D90, 0x11D91, 0, Extend},
+    {0x11D93, 0x11D94, 1, SpacingMark},
+    {0x11D95, 0x11D95, 0, Extend},
+    {0x11D96, 0x11D96, 1, SpacingMark},
+    {0x11D97, 0x11D97, 0, Extend},
+    {0x11EF3, 0x11EF4, 0, Extend},
+    {0x11EF5, 0x11EF6, 1, SpacingMark},
+    {0x13430, 0x13438, 0, Control},
+    {0x16AF0, 0x16AF4, 0, Extend},
+    {0x16B30, 0x16B36, 0, Extend},
+    {0x16F4F, 0x16F4F, 0, Extend},
+    {0x16F51, 0x16F87, 1, SpacingMark},
+    {0x16F8F, 0x16F92, 0, Extend},
+    {0x16FE0, 0x16FE3, 2, Other},
+    {0x16FE4, 0x16FE4, 0, Extend},
+    {0x16FF0, 0x16FF1, 2, SpacingMark},
+    {0x17000, 0x187F7, 2, Other},
+    {0x18800, 0x18CD5, 2, Other},
+    {0x18D00, 0x18D08, 2, Other},
+    {0x1AFF0, 0x1AFF3, 2, Other},
+    {0x1AFF5, 0x1AFFB, 2, Other},
+    {0x1AFFD, 0x1AFFE, 2, Other},
+    {0x1B000, 0x1B122, 2, Other},
+    {0x1B150, 0x1B152, 2, Other},
+    {0x1B164, 0x1B167, 2, Other},
+    {0x1B170, 0x1B2FB, 2, Other},
+    {0x1BC9D, 0x1BC9E, 0, Extend},
+    {0x1BCA0, 0x1BCA3, 0, Control},
+    {0x1CF00, 0x1CF2D, 0, Extend},
+    {0x1CF30, 0x1CF46, 0, Extend},
+    {0x1D165, 0x1D166, 1, SpacingMark},
+    {0x1D167, 0x1D169, 0, Extend},
+    {0x1D16D, 0x1D172, 1, SpacingMark},
+    {0x1D173, 0x1D17A, 0, Control},
+    {0x1D17B, 0x1D182, 0, Extend},
+    {0x1D185, 0x1D18B, 0, Extend},
+    {0x1D1AA, 0x1D1AD, 0, Extend},
+    {0x1D242, 0x1D244, 0, Extend},
+    {0x1DA00, 0x1DA36, 0, Extend},
+    {0x1DA3B, 0x1DA6C, 0, Extend},
+    {0x1DA75, 0x1DA75, 0, Extend},
+    {0x1DA84, 0x1DA84, 0, Extend},
+    {0x1DA9B, 0x1DA9F, 0, Extend},
+    {0x1DAA1, 0x1DAAF, 0, Extend},
+    {0x1E000, 0x1E006, 0, Extend},
+    {0x1E008, 0x1E018, 0, Extend},
+    {0x1E01B, 0x1E021, 0, Extend},
+    {0x1E023, 0x1E024, 0, Extend},
+    {0x1E026, 0x1E02A, 0, Extend},
+    {0x1E130, 0x1E136, 0, Extend},
+    {0x1E2AE, 0x1E2AE, 0, Extend},
+    {0x1E2EC, 0x1E2EF, 0, Extend},
+    {0x1E8D0, 0x1E8D6, 0, Extend},
+    {0x1E944, 0x1E94A, 0, Extend},
+    {0x1F000, 0x1F003, 1, ExtendedPictographic},
+    {0x1F004, 0x1F004, 2, ExtendedPictographic},
+    {0x1F005, 0x1F0CE, 1, ExtendedPictographic},
+    {0x1F0CF, 0x1F0CF, 2, ExtendedPictographic},
+    {0x1F0D0, 0x1F0FF, 1, ExtendedPictographic},
+    {0x1F10D, 0x1F10F, 1, ExtendedPictographic},
+    {0x1F12F, 0x1F12F, 1, ExtendedPictographic},
+    {0x1F16C, 0x1F171, 1, ExtendedPictographic},
+    {0x1F17E, 0x1F17F, 1, ExtendedPictographic},
+    {0x1F18E, 0x1F18E, 2, ExtendedPictographic},
+    {0x1F191, 0x1F19A, 2, ExtendedPictographic},
+    {0x1F1AD, 0x1F1E5, 1, ExtendedPictographic},
+    {0x1F1E6, 0x1F1FF, 1, RegionalIndicator},
+    {0x1F200, 0x1F200, 2, Other},
+    {0x1F201, 0x1F202, 2, ExtendedPictographic},
+    {0x1F203, 0x1F20F, 1, ExtendedPictographic},
+    {0x1F210, 0x1F219, 2, Other},
+    {0x1F21A, 0x1F21A, 2, ExtendedPictographic},
+    {0x1F21B, 0x1F22E, 2, Other},
+    {0x1F22F, 0x1F22F, 2, ExtendedPictographic},
+    {0x1F230, 0x1F231, 2, Other},
+    {0x1F232, 0x1F23A, 2, ExtendedPictographic},
+    {0x1F23B, 0x1F23B, 2, Other},
+    {0x1F23C, 0x1F23F, 1, ExtendedPictographic},
+    {0x1F240, 0x1F248, 2, Other},
+    {0x1F249, 0x1F24F, 1, ExtendedPictographic},
+    {0x1F250, 0x1F251, 2, ExtendedPictographic},
+    {0x1F252, 0x1F25F, 1, ExtendedPictographic},
+    {0x1F260, 0x1F265, 2, ExtendedPictographic},
+    {0x1F266, 0x1F2FF, 1, ExtendedPictographic},
+    {0x1F300, 0x1F320, 2, ExtendedPictographic},
+    {0x1F321, 0x1F32C, 1, ExtendedPictographic},
+    {0x1F32D, 0x1F335, 2, ExtendedPictographic},
+    {0x1F336, 0x1F336, 1, ExtendedPictographic},
+    {0x1F337, 0x1F37C, 2, ExtendedPictographic},
+    {0x1F37D, 0x1F37D, 1, ExtendedPictographic},
+    {0x1F37E, 0x1F393, 2, ExtendedPictographic},
+    {0x1F394, 0x1F39F, 1, ExtendedPictographic},
+    {0x1F3A0, 0x1F3CA, 2, ExtendedPictographic},
+    {0x1F3CB, 0x1F3CE, 1, ExtendedPictographic},
+    {0x1F3CF, 0x1F3D3, 2, ExtendedPictographic},
+    {0x1F3D4, 0x1F3DF, 1, ExtendedPictographic},
+    {0x1F3E0, 0x1F3F0, 2, ExtendedPictographic},
+    {0x1F3F1, 0x1F3F3, 1, ExtendedPictographic},
+    {0x1F3F4, 0x1F3F4, 2, ExtendedPictographic},
+    {0x1F3F5, 0x1F3F7, 1, ExtendedPictographic},
+    {0x1F3F8, 0x1F3FA, 2, ExtendedPictographic},
+    {0x1F3FB, 0x1F3FF, 2, Extend},
+    {0x1F400, 0x1F43E, 2, ExtendedPictographic},
+    {0x1F43F, 0x1F43F, 1, ExtendedPictographic},
+    {0x1F440, 0x1F440, 2, ExtendedPictographic},
+    {0x1F441, 0x1F441, 1, ExtendedPictographic},
+    {0x1F442, 0x1F4FC, 2, ExtendedPictographic},
+    {0x1F4FD, 0x1F4FE, 1, ExtendedPictographic},
+    {0x1F4FF, 0x1F53D, 2, ExtendedPictographic},
+    {0x1F546, 0x1F54A, 1, ExtendedPictographic},
+    {0x1F54B, 0x1F54E, 2, ExtendedPictographic},
+    {0x1F54F, 0x1F54F, 1, ExtendedPictographic},
+    {0x1F550, 0x1F567, 2, ExtendedPictographic},
+    {0x1F568, 0x1F579, 1, ExtendedPictographic},
+    {0x1F57A, 0x1F57A, 2, ExtendedPictographic},
+    {0x1F57B, 0x1F594, 1, ExtendedPictographic},
+    {0x1F595, 0x1F596, 2, ExtendedPictographic},
+    {0x1F597, 0x1F5A3, 1, ExtendedPictographic},
+    {0x1F5A4, 0x1F5A4, 2, ExtendedPictographic},
+    {0x1F5A5, 0x1F5FA, 1, ExtendedPictographic},
+    {0x1F5FB, 0x1F64F, 2, ExtendedPictographic},
+    {0x1F680, 0x1F6C5, 2, ExtendedPictographic},
+    {0x1F6C6, 0x1F6CB, 1, ExtendedPictographic},
+    {0x1F6CC, 0x1F6CC, 2, ExtendedPictographic},
+    {0x1F6CD, 0x1F6CF, 1, ExtendedPictographic},
+    {0x1F6D0, 0x1F6D2, 2, ExtendedPictographic},
+    {0x1F6D3, 0x1F6D4, 1, ExtendedPictographic},
+    {0x1F6D5, 0x1F6D7, 2, ExtendedPictographic},
+    {0x1F6D8, 0x1F6DC, 1, ExtendedPictographic},
+    {0x1F6DD, 0x1F6DF, 2, ExtendedPictographic},
+    {0x1F6E0, 0x1F6EA, 1, ExtendedPictographic},
+    {0x1F6EB, 0x1F6EC, 2, ExtendedPictographic},
+    {0x1F6ED, 0x1F6F3, 1, ExtendedPictographic},
+    {0x1F6F4, 0x1F6FC, 2, ExtendedPictographic},
+    {0x1F6FD, 0x1F6FF, 1, ExtendedPictographic},
+    {0x1F774, 0x1F77F, 1, ExtendedPictographic},
+    {0x1F7D5, 0x1F7DF, 1, ExtendedPictographic},
+    {0x1F7E0, 0x1F7EB, 2, ExtendedPictographic},
+    {0x1F7EC, 0x1F7EF, 1, ExtendedPictographic},
+    {0x1F7F0, 0x1F7F0, 2, ExtendedPictographic},
+    {0x1F7F1, 0x1F7FF, 1, ExtendedPictographic},
+    {0x1F80C, 0x1F80F, 1, ExtendedPictographic},
+    {0x1F848, 0x1F84F, 1, ExtendedPictographic},
+    {0x1F85A, 0x1F85F, 1, ExtendedPictographic},
+    {0x1F888, 0x1F88F, 1, ExtendedPictographic},
+    {0x1F8AE, 0x1F8FF, 1, ExtendedPictographic},
+    {0x1F90C, 0x1F93A, 2, ExtendedPictographic},
+    {0x1F93C, 0x1F945, 2, ExtendedPictographic},
+    {0x1F947, 0x1F9FF, 2, ExtendedPictographic},
+    {0x1FA00, 0x1FA6F, 1, ExtendedPictographic},
+    {0x1FA70, 0x1FA74, 2, ExtendedPictographic},
+    {0x1FA75, 0x1FA77, 1, ExtendedPictographic},
+    {0x1FA78, 0x1FA7C, 2, ExtendedPictographic},
+    {0x1FA7D, 0x1FA7F, 1, ExtendedPictographic},
+    {0x1FA80, 0x1FA86, 2, ExtendedPictographic},
+    {0x1FA87, 0x1FA8F, 1, ExtendedPictographic},
+    {0x1FA90, 0x1FAAC, 2, ExtendedPictographic},
+    {0x1FAAD, 0x1FAAF, 1, ExtendedPictographic},
+    {0x1FAB0, 0x1FABA, 2, ExtendedPictographic},
+    {0x1FABB, 0x1FABF, 1, ExtendedPictographic},
+    {0x1FAC0, 0x1FAC5, 2, ExtendedPictographic},
+    {0x1FAC6, 0x1FACF, 1, ExtendedPictographic},
+    {0x1FAD0, 0x1FAD9, 2, ExtendedPictographic},
+    {0x1FADA, 0x1FADF, 1, ExtendedPictographic},
+    {0x1FAE0, 0x1FAE7, 2, ExtendedPictographic},
+    {0x1FAE8, 0x1FAEF, 1, ExtendedPictographic},
+    {0x1FAF0, 0x1FAF6, 2, ExtendedPictographic},
+    {0x1FAF7, 0x1FAFF, 1, ExtendedPictographic},
+    {0x1FC00, 0x1FFFD, 1, ExtendedPictographic},
+    {0x20000, 0x2FFFD, 2, Other},
+    {0x30000, 0x3FFFD, 2, Other},
+    {0xE0001, 0xE0001, 0, Control},
+    {0xE0020, 0xE007F, 0, Extend},
+    {0xE0100, 0xE01EF, 0, Extend},
+};
+
+} // namespace detail
+
+} // namespace termihui::unicode
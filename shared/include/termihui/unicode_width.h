@@ -0,0 +1,254 @@
+#pragma once
+
+#include "unicode_data.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Column width and grapheme cluster boundaries of Unicode codepoints
+ *
+ * Both properties live in one two-level table generated at compile time from the ranges in
+ * unicode_data.h: the high bits of a codepoint select one of a few deduplicated 256-entry
+ * blocks, the low byte indexes into it. A lookup is two array loads, no search and no calls.
+ */
+namespace termihui::unicode {
+
+namespace detail {
+
+inline constexpr size_t blockSize = 256;
+inline constexpr size_t blockIndexCount = 0x110000 / blockSize;
+inline constexpr size_t maxBlocks = 256;
+
+/**
+ * Table entry: width in bits 0-1, grapheme property in bits 2-5
+ */
+constexpr uint8_t packEntry(uint8_t width, GraphemeProperty property) {
+    return static_cast<uint8_t>(width | (static_cast<uint8_t>(property) << 2));
+}
+
+inline constexpr uint8_t defaultEntry = packEntry(1, GraphemeProperty::Other);
+
+using Block = std::array<uint8_t, blockSize>;
+
+template<size_t BlockCount>
+struct Tables {
+    std::array<uint8_t, blockIndexCount> blockIndex{};
+    std::array<Block, BlockCount> blocks{};
+    size_t blockCount = 0;
+};
+
+constexpr uint32_t hashBlock(const Block& block) {
+    uint32_t hash = 2166136261u;
+    for (uint8_t entry : block) {
+        hash = (hash ^ entry) * 16777619u;
+    }
+    return hash;
+}
+
+constexpr Tables<maxBlocks> buildTables() {
+    Tables<maxBlocks> tables;
+    std::array<uint32_t, maxBlocks> hashes{};
+    constexpr size_t rangeCount = std::size(propertyRanges);
+    size_t firstRange = 0;
+
+    // Blocks holding a single entry are shared without building them first
+    constexpr size_t noBlock = maxBlocks;
+    std::array<size_t, 64> uniformBlocks{};
+    uniformBlocks.fill(noBlock);
+
+    auto addBlock = [&tables, &hashes](const Block& block, uint32_t hash) {
+        if (tables.blockCount == maxBlocks) {
+            throw "too many distinct blocks for an 8-bit block index";
+        }
+        tables.blocks[tables.blockCount] = block;
+        hashes[tables.blockCount] = hash;
+        return tables.blockCount++;
+    };
+
+    for (size_t index = 0; index < blockIndexCount; ++index) {
+        char32_t blockFirst = static_cast<char32_t>(index * blockSize);
+        char32_t blockLast = blockFirst + blockSize - 1;
+        size_t lastRange = firstRange;
+        while (lastRange < rangeCount && propertyRanges[lastRange].first <= blockLast) {
+            ++lastRange;
+        }
+
+        // Uniform: no range inside the block, or one range covering all of it
+        int uniformEntry = -1;
+        if (lastRange == firstRange) {
+            uniformEntry = defaultEntry;
+        } else if (lastRange == firstRange + 1 && propertyRanges[firstRange].first <= blockFirst &&
+                   propertyRanges[firstRange].last >= blockLast) {
+            uniformEntry = packEntry(propertyRanges[firstRange].width, propertyRanges[firstRange].property);
+        }
+
+        size_t found;
+        if (uniformEntry >= 0) {
+            size_t& uniform = uniformBlocks[static_cast<size_t>(uniformEntry)];
+            if (uniform == noBlock) {
+                Block block;
+                block.fill(static_cast<uint8_t>(uniformEntry));
+                uniform = addBlock(block, hashBlock(block));
+            }
+            found = uniform;
+        } else {
+            Block block;
+            block.fill(defaultEntry);
+            for (size_t r = firstRange; r < lastRange; ++r) {
+                const PropertyRange& range = propertyRanges[r];
+                char32_t first = range.first > blockFirst ? range.first : blockFirst;
+                char32_t last = range.last < blockLast ? range.last : blockLast;
+                uint8_t entry = packEntry(range.width, range.property);
+                for (char32_t codepoint = first; codepoint <= last; ++codepoint) {
+                    block[codepoint - blockFirst] = entry;
+                }
+            }
+
+            // Share identical blocks
+            uint32_t hash = hashBlock(block);
+            found = tables.blockCount;
+            for (size_t b = 0; b < tables.blockCount; ++b) {
+                if (hashes[b] == hash && tables.blocks[b] == block) {
+                    found = b;
+                    break;
+                }
+            }
+            if (found == tables.blockCount) {
+                found = addBlock(block, hash);
+            }
+        }
+        tables.blockIndex[index] = static_cast<uint8_t>(found);
+
+        // Ranges reaching into the next block stay
+        while (firstRange < rangeCount && propertyRanges[firstRange].last <= blockLast) {
+            ++firstRange;
+        }
+    }
+    return tables;
+}
+
+inline constexpr Tables<maxBlocks> builtTables = buildTables();
+
+/**
+ * Final tables: only as many blocks as are distinct
+ */
+constexpr auto trimTables() {
+    Tables<builtTables.blockCount> tables;
+    tables.blockIndex = builtTables.blockIndex;
+    for (size_t b = 0; b < builtTables.blockCount; ++b) {
+        tables.blocks[b] = builtTables.blocks[b];
+    }
+    tables.blockCount = builtTables.blockCount;
+    return tables;
+}
+
+inline constexpr auto tables = trimTables();
+
+} // namespace detail
+
+/**
+ * Get packed table entry of codepoint (see width() and graphemeProperty())
+ */
+constexpr uint8_t propertyEntry(char32_t codepoint) {
+    if (codepoint >= 0x110000) {
+        return detail::defaultEntry;
+    }
+    return detail::tables.blocks[detail::tables.blockIndex[codepoint >> 8]][codepoint & 0xFF];
+}
+
+/**
+ * Get number of terminal columns codepoint occupies: 0 (combining / format), 1 or 2 (wide)
+ */
+constexpr int width(char32_t codepoint) {
+    return propertyEntry(codepoint) & 0x03;
+}
+
+/**
+ * Get grapheme cluster break property of codepoint
+ */
+constexpr GraphemeProperty graphemeProperty(char32_t codepoint) {
+    return static_cast<GraphemeProperty>(propertyEntry(codepoint) >> 2);
+}
+
+/**
+ * Check if codepoint is one column wide and always starts a new grapheme cluster
+ * (true for the bulk of text, which can then be laid out one cell per codepoint)
+ */
+constexpr bool isSimple(char32_t codepoint) {
+    return propertyEntry(codepoint) == detail::defaultEntry;
+}
+
+/**
+ * Incremental grapheme cluster boundary detection
+ *
+ * Implements the extended grapheme cluster rules of UAX #29 (GB3-GB13, without the
+ * Indic conjunct rule GB9c). Codepoints are fed one at a time; state carries what the
+ * ZWJ emoji and regional indicator rules need to look back at.
+ */
+class GraphemeSegmenter {
+public:
+    /**
+     * Feed next codepoint
+     * @return true if a cluster boundary lies before it
+     */
+    constexpr bool isBoundary(char32_t codepoint) {
+        using enum GraphemeProperty;
+        GraphemeProperty property = graphemeProperty(codepoint);
+
+        bool boundary;
+        if (this->carriageReturn && codepoint == U'\n') {
+            boundary = false;                                                   // GB3
+        } else if (this->previous == Control || property == Control) {
+            boundary = true;                                                    // GB4, GB5
+        } else if (this->previous == L && (property == L || property == V || property == LV || property == LVT)) {
+            boundary = false;                                                   // GB6
+        } else if ((this->previous == LV || this->previous == V) && (property == V || property == T)) {
+            boundary = false;                                                   // GB7
+        } else if ((this->previous == LVT || this->previous == T) && property == T) {
+            boundary = false;                                                   // GB8
+        } else if (property == Extend || property == ZWJ || property == SpacingMark) {
+            boundary = false;                                                   // GB9, GB9a
+        } else if (this->previous == Prepend) {
+            boundary = false;                                                   // GB9b
+        } else if (this->previous == ZWJ && property == ExtendedPictographic && this->pictographicZwj) {
+            boundary = false;                                                   // GB11
+        } else if (this->previous == RegionalIndicator && property == RegionalIndicator && this->oddRegionalIndicator) {
+            boundary = false;                                                   // GB12, GB13
+        } else {
+            boundary = true;                                                    // GB999
+        }
+
+        this->pictographicZwj = property == ZWJ && this->pictographic;
+        this->pictographic = property == ExtendedPictographic || (property == Extend && this->pictographic);
+        this->oddRegionalIndicator = property == RegionalIndicator && (boundary || !this->oddRegionalIndicator);
+        this->previous = property;
+        this->carriageReturn = codepoint == U'\r';
+        return boundary;
+    }
+
+    /**
+     * Forget previous codepoints
+     * @param previous Property to assume for the codepoint before the next one
+     *                 (Control = next codepoint always starts a cluster)
+     */
+    constexpr void reset(GraphemeProperty previous = GraphemeProperty::Control) {
+        this->previous = previous;
+        this->pictographic = false;
+        this->pictographicZwj = false;
+        this->oddRegionalIndicator = false;
+        this->carriageReturn = false;
+    }
+
+private:
+    GraphemeProperty previous = GraphemeProperty::Control;
+    bool pictographic = false;           // ExtendedPictographic Extend* so far
+    bool pictographicZwj = false;        // ... followed by ZWJ
+    bool oddRegionalIndicator = false;   // odd number of regional indicators in a row
+    bool carriageReturn = false;
+};
+
+static_assert(width(U'a') == 1 && width(U'\u3042') == 2 && width(U'\u0301') == 0);
+static_assert(isSimple(U'a') && !isSimple(U'\u0301') && !isSimple(U'\U0001F600'));
+
+} // namespace termihui::unicode
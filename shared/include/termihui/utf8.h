@@ -0,0 +1,287 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h>
+#define TERMIHUI_UTF8_SSE2 1
+#endif
+
+/**
+ * UTF-8 decoding and encoding
+ *
+ * Decoding is strict (RFC 3629): overlong forms, surrogates and values above U+10FFFF are
+ * rejected, so every decoded codepoint can go into a cell as is. ASCII, the bulk of terminal
+ * output, is skipped 16 bytes per compare; only multi-byte sequences are decoded one by one.
+ */
+namespace termihui::utf8 {
+
+inline constexpr size_t maxSequenceLength = 4;
+
+namespace detail {
+
+/**
+ * What a lead byte allows: sequence length (0 = can't start a sequence) and range of the
+ * second byte, which is where overlong forms, surrogates and too large values are ruled out
+ */
+struct LeadByte {
+    uint8_t length;
+    uint8_t secondLow;
+    uint8_t secondHigh;
+};
+
+constexpr LeadByte leadByte(unsigned char byte) {
+    if (byte < 0x80) return {1, 0, 0};
+    if (byte < 0xC2) return {0, 0, 0};           // continuation byte, overlong 2-byte lead
+    if (byte < 0xE0) return {2, 0x80, 0xBF};
+    if (byte == 0xE0) return {3, 0xA0, 0xBF};    // overlong below U+0800
+    if (byte == 0xED) return {3, 0x80, 0x9F};    // surrogates
+    if (byte < 0xF0) return {3, 0x80, 0xBF};
+    if (byte == 0xF0) return {4, 0x90, 0xBF};    // overlong below U+10000
+    if (byte < 0xF4) return {4, 0x80, 0xBF};
+    if (byte == 0xF4) return {4, 0x80, 0x8F};    // above U+10FFFF
+    return {0, 0, 0};
+}
+
+/**
+ * Payload bits of lead byte of a sequence of given length (2..4)
+ */
+constexpr char32_t leadBits(unsigned char byte, size_t length) {
+    return byte & (0x7F >> length);
+}
+
+} // namespace detail
+
+/**
+ * Length of leading run of ASCII bytes
+ */
+inline size_t asciiLength(const char* data, size_t size) {
+    size_t i = 0;
+#ifdef TERMIHUI_UTF8_SSE2
+    // High bit of each byte straight into a mask
+    for (; i + 16 <= size; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(chunk));
+        if (mask != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+#else
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        if (word & 0x8080808080808080ull) {
+            break;
+        }
+    }
+#endif
+    while (i < size && static_cast<unsigned char>(data[i]) < 0x80) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Decode one sequence
+ * @return sequence length, 0 if data doesn't start with a complete valid sequence
+ */
+constexpr size_t decode(const char* data, size_t size, char32_t& codepoint) {
+    if (size == 0) {
+        return 0;
+    }
+    auto lead = static_cast<unsigned char>(data[0]);
+    detail::LeadByte info = detail::leadByte(lead);
+    if (info.length == 0 || info.length > size) {
+        return 0;
+    }
+    if (info.length == 1) {
+        codepoint = lead;
+        return 1;
+    }
+
+    auto second = static_cast<unsigned char>(data[1]);
+    if (second < info.secondLow || second > info.secondHigh) {
+        return 0;
+    }
+    char32_t result = (detail::leadBits(lead, info.length) << 6) | (second & 0x3F);
+    for (size_t i = 2; i < info.length; ++i) {
+        auto byte = static_cast<unsigned char>(data[i]);
+        if ((byte & 0xC0) != 0x80) {
+            return 0;
+        }
+        result = (result << 6) | (byte & 0x3F);
+    }
+    codepoint = result;
+    return info.length;
+}
+
+/**
+ * Decode leading valid part of data, taking ASCII only in runs accepted by scanAscii
+ * @param codepoints receives decoded codepoints (appended)
+ * @param scanAscii size_t(const char* data, size_t size): length of leading run of accepted
+ *        ASCII bytes, stopping at the first byte >= 0x80 at the latest
+ * @return bytes consumed; stops before the first ASCII byte not accepted and before the
+ *         first invalid or incomplete sequence
+ */
+template<typename AsciiScanner>
+size_t decode(std::string_view data, std::u32string& codepoints, AsciiScanner&& scanAscii) {
+    size_t i = 0;
+    while (i < data.size()) {
+        size_t ascii = scanAscii(data.data() + i, data.size() - i);
+        codepoints.append(data.begin() + i, data.begin() + i + ascii);
+        i += ascii;
+        if (i == data.size() || static_cast<unsigned char>(data[i]) < 0x80) {
+            break;
+        }
+        char32_t codepoint;
+        size_t length = decode(data.data() + i, data.size() - i, codepoint);
+        if (length == 0) {
+            break;
+        }
+        codepoints.push_back(codepoint);
+        i += length;
+    }
+    return i;
+}
+
+/**
+ * Decode leading valid part of data
+ * @param codepoints receives decoded codepoints (appended)
+ * @return bytes consumed; stops before the first invalid or incomplete sequence
+ */
+inline size_t decode(std::string_view data, std::u32string& codepoints) {
+    return decode(data, codepoints, asciiLength);
+}
+
+/**
+ * Check if data is the valid beginning of a sequence that continues past its end
+ */
+constexpr bool isTruncated(std::string_view data) {
+    if (data.empty()) {
+        return false;
+    }
+    detail::LeadByte info = detail::leadByte(static_cast<unsigned char>(data[0]));
+    if (info.length <= data.size()) {
+        return false;
+    }
+    if (data.size() > 1) {
+        auto second = static_cast<unsigned char>(data[1]);
+        if (second < info.secondLow || second > info.secondHigh) {
+            return false;
+        }
+    }
+    return data.size() < 3 || (static_cast<unsigned char>(data[2]) & 0xC0) == 0x80;
+}
+
+/**
+ * Length of data without a sequence cut off at its end (the rest comes with the next read)
+ * Invalid bytes at the end count as complete: waiting wouldn't make them valid.
+ */
+constexpr size_t completeLength(std::string_view data) {
+    size_t limit = data.size() > maxSequenceLength - 1 ? data.size() - (maxSequenceLength - 1) : 0;
+    for (size_t start = data.size(); start > limit;) {
+        --start;
+        if ((static_cast<unsigned char>(data[start]) & 0xC0) != 0x80) {
+            return isTruncated(data.substr(start)) ? start : data.size();
+        }
+    }
+    return data.size();
+}
+
+/**
+ * Append UTF-8 encoding of codepoint
+ */
+inline void append(std::string& text, char32_t codepoint) {
+    if (codepoint < 0x80) {
+        text += static_cast<char>(codepoint);
+    } else if (codepoint < 0x800) {
+        char bytes[] = {static_cast<char>(0xC0 | (codepoint >> 6)),
+                        static_cast<char>(0x80 | (codepoint & 0x3F))};
+        text.append(bytes, sizeof(bytes));
+    } else if (codepoint < 0x10000) {
+        char bytes[] = {static_cast<char>(0xE0 | (codepoint >> 12)),
+                        static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)),
+                        static_cast<char>(0x80 | (codepoint & 0x3F))};
+        text.append(bytes, sizeof(bytes));
+    } else {
+        char bytes[] = {static_cast<char>(0xF0 | (codepoint >> 18)),
+                        static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)),
+                        static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)),
+                        static_cast<char>(0x80 | (codepoint & 0x3F))};
+        text.append(bytes, sizeof(bytes));
+    }
+}
+
+/**
+ * Byte-at-a-time decoder keeping a partial sequence between calls
+ *
+ * For parsers that see bytes one by one and data that arrives in pieces: a sequence
+ * split across two reads is completed by the first bytes of the second.
+ */
+class Decoder {
+public:
+    enum class Result {
+        Pending,      // byte taken, sequence not complete yet
+        Complete,     // codepoint decoded
+        Invalid,      // byte can't start a sequence
+        Interrupted,  // byte doesn't continue the pending sequence: sequence dropped,
+                      // byte not taken (feed it again)
+    };
+
+    /**
+     * Feed next byte
+     * @param codepoint receives decoded codepoint when Complete is returned
+     */
+    constexpr Result feed(unsigned char byte, char32_t& codepoint) {
+        if (this->remaining == 0) {
+            detail::LeadByte info = detail::leadByte(byte);
+            if (info.length == 1) {
+                codepoint = byte;
+                return Result::Complete;
+            }
+            if (info.length == 0) {
+                return Result::Invalid;
+            }
+            this->partial = detail::leadBits(byte, info.length);
+            this->remaining = static_cast<uint8_t>(info.length - 1);
+            this->low = info.secondLow;
+            this->high = info.secondHigh;
+            return Result::Pending;
+        }
+
+        if (byte < this->low || byte > this->high) {
+            this->remaining = 0;
+            return Result::Interrupted;
+        }
+        this->partial = (this->partial << 6) | (byte & 0x3F);
+        this->low = 0x80;
+        this->high = 0xBF;
+        if (--this->remaining > 0) {
+            return Result::Pending;
+        }
+        codepoint = this->partial;
+        return Result::Complete;
+    }
+
+    /**
+     * Check if a sequence is started but not complete
+     */
+    constexpr bool pending() const { return this->remaining > 0; }
+
+    /**
+     * Drop pending sequence
+     */
+    constexpr void reset() { this->remaining = 0; }
+
+private:
+    char32_t partial = 0;
+    uint8_t remaining = 0;      // continuation bytes still expected
+    uint8_t low = 0x80;         // allowed range of the next byte
+    uint8_t high = 0xBF;
+};
+
+} // namespace termihui::utf8
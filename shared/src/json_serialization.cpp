@@ -123,13 +123,15 @@ void to_json(json& j, const InputMessage& message) {
     j = json{
         {"type", InputMessage::type},
         {"session_id", message.sessionId},
-        {"text", message.text}
+        {"text", message.text},
+        {"paste", message.paste}
     };
 }
 
 void from_json(const json& j, InputMessage& message) {
     j.at("session_id").get_to(message.sessionId);
     j.at("text").get_to(message.text);
+    if (auto it = j.find("paste"); it != j.end()) it->get_to(message.paste);
 }
 
 void to_json(json& j, const CompletionMessage& message) {
@@ -200,6 +202,28 @@ void from_json(const json& j, GetHistoryMessage& message) {
     j.at("session_id").get_to(message.sessionId);
 }
 
+void to_json(json& j, const SubscribeMessage& message) {
+    j = json{
+        {"type", SubscribeMessage::type},
+        {"session_id", message.sessionId}
+    };
+}
+
+void from_json(const json& j, SubscribeMessage& message) {
+    j.at("session_id").get_to(message.sessionId);
+}
+
+void to_json(json& j, const UnsubscribeMessage& message) {
+    j = json{
+        {"type", UnsubscribeMessage::type},
+        {"session_id", message.sessionId}
+    };
+}
+
+void from_json(const json& j, UnsubscribeMessage& message) {
+    j.at("session_id").get_to(message.sessionId);
+}
+
 void to_json(json& j, const AIChatMessage& message) {
     j = json{
         {"type", AIChatMessage::type},
@@ -330,6 +354,14 @@ void from_json(const json& j, ClientMessage& message) {
         GetHistoryMessage m;
         from_json(j, m);
         message = std::move(m);
+    } else if (type == SubscribeMessage::type) {
+        SubscribeMessage m;
+        from_json(j, m);
+        message = std::move(m);
+    } else if (type == UnsubscribeMessage::type) {
+        UnsubscribeMessage m;
+        from_json(j, m);
+        message = std::move(m);
     } else if (type == AIChatMessage::type) {
         AIChatMessage m;
         from_json(j, m);
@@ -588,11 +620,13 @@ void from_json(const json& j, PromptEndMessage& message) {
 void to_json(json& j, const CwdUpdateMessage& message) {
     j = json{
         {"type", CwdUpdateMessage::type},
+        {"session_id", message.sessionId},
         {"cwd", message.cwd}
     };
 }
 
 void from_json(const json& j, CwdUpdateMessage& message) {
+    if (auto it = j.find("session_id"); it != j.end()) it->get_to(message.sessionId);
     j.at("cwd").get_to(message.cwd);
 }
 
@@ -603,12 +637,14 @@ void from_json(const json& j, CwdUpdateMessage& message) {
 void to_json(json& j, const InteractiveModeStartMessage& message) {
     j = json{
         {"type", InteractiveModeStartMessage::type},
+        {"session_id", message.sessionId},
         {"rows", message.rows},
         {"columns", message.columns}
     };
 }
 
 void from_json(const json& j, InteractiveModeStartMessage& message) {
+    if (auto it = j.find("session_id"); it != j.end()) it->get_to(message.sessionId);
     j.at("rows").get_to(message.rows);
     j.at("columns").get_to(message.columns);
 }
@@ -616,6 +652,7 @@ void from_json(const json& j, InteractiveModeStartMessage& message) {
 void to_json(json& j, const ScreenSnapshotMessage& message) {
     j = json{
         {"type", ScreenSnapshotMessage::type},
+        {"session_id", message.sessionId},
         {"cursor_row", message.cursorRow},
         {"cursor_column", message.cursorColumn},
         {"lines", message.lines}
@@ -623,6 +660,7 @@ void to_json(json& j, const ScreenSnapshotMessage& message) {
 }
 
 void from_json(const json& j, ScreenSnapshotMessage& message) {
+    if (auto it = j.find("session_id"); it != j.end()) it->get_to(message.sessionId);
     j.at("cursor_row").get_to(message.cursorRow);
     j.at("cursor_column").get_to(message.cursorColumn);
     j.at("lines").get_to(message.lines);
@@ -633,16 +671,23 @@ void to_json(json& j, const ScreenRowUpdate& update) {
         {"row", update.row},
         {"segments", update.segments}
     };
+    if (update.column) {
+        j["column"] = *update.column;
+    }
 }
 
 void from_json(const json& j, ScreenRowUpdate& update) {
     j.at("row").get_to(update.row);
     j.at("segments").get_to(update.segments);
+    if (auto it = j.find("column"); it != j.end()) {
+        update.column = it->get<size_t>();
+    }
 }
 
 void to_json(json& j, const ScreenDiffMessage& message) {
     j = json{
         {"type", ScreenDiffMessage::type},
+        {"session_id", message.sessionId},
         {"cursor_row", message.cursorRow},
         {"cursor_column", message.cursorColumn},
         {"updates", message.updates}
@@ -650,11 +695,29 @@ void to_json(json& j, const ScreenDiffMessage& message) {
 }
 
 void from_json(const json& j, ScreenDiffMessage& message) {
+    if (auto it = j.find("session_id"); it != j.end()) it->get_to(message.sessionId);
     j.at("cursor_row").get_to(message.cursorRow);
     j.at("cursor_column").get_to(message.cursorColumn);
     j.at("updates").get_to(message.updates);
 }
 
+void to_json(json& j, const ScreenScrollMessage& message) {
+    j = json{
+        {"type", ScreenScrollMessage::type},
+        {"session_id", message.sessionId},
+        {"top", message.top},
+        {"bottom", message.bottom},
+        {"count", message.count}
+    };
+}
+
+void from_json(const json& j, ScreenScrollMessage& message) {
+    if (auto it = j.find("session_id"); it != j.end()) it->get_to(message.sessionId);
+    j.at("top").get_to(message.top);
+    j.at("bottom").get_to(message.bottom);
+    j.at("count").get_to(message.count);
+}
+
 void to_json(json& j, const BlockScreenUpdateMessage& message) {
     j = json{
         {"type", BlockScreenUpdateMessage::type},
@@ -671,12 +734,25 @@ void from_json(const json& j, BlockScreenUpdateMessage& message) {
     j.at("updates").get_to(message.updates);
 }
 
-void to_json(json& j, const InteractiveModeEndMessage&) {
-    j = json{{"type", InteractiveModeEndMessage::type}};
+void to_json(json& j, const OutputSkippedMessage& message) {
+    j = json{
+        {"type", OutputSkippedMessage::type},
+        {"session_id", message.sessionId},
+        {"count", message.count}
+    };
 }
 
-void from_json(const json&, InteractiveModeEndMessage&) {
-    // No fields
+void from_json(const json& j, OutputSkippedMessage& message) {
+    j.at("session_id").get_to(message.sessionId);
+    j.at("count").get_to(message.count);
+}
+
+void to_json(json& j, const InteractiveModeEndMessage& message) {
+    j = json{{"type", InteractiveModeEndMessage::type}, {"session_id", message.sessionId}};
+}
+
+void from_json(const json& j, InteractiveModeEndMessage& message) {
+    if (auto it = j.find("session_id"); it != j.end()) it->get_to(message.sessionId);
 }
 
 void to_json(json& j, const AIChunkMessage& message) {
@@ -942,6 +1018,8 @@ std::string serialize(const ListSessionsMessage& message) { return serializeImpl
 std::string serialize(const CreateSessionMessage& message) { return serializeImpl(message); }
 std::string serialize(const CloseSessionMessage& message) { return serializeImpl(message); }
 std::string serialize(const GetHistoryMessage& message) { return serializeImpl(message); }
+std::string serialize(const SubscribeMessage& message) { return serializeImpl(message); }
+std::string serialize(const UnsubscribeMessage& message) { return serializeImpl(message); }
 std::string serialize(const ConnectedMessage& message) { return serializeImpl(message); }
 std::string serialize(const ErrorMessage& message) { return serializeImpl(message); }
 std::string serialize(const OutputMessage& message) { return serializeImpl(message); }
@@ -961,8 +1039,10 @@ std::string serialize(const CwdUpdateMessage& message) { return serializeImpl(me
 std::string serialize(const InteractiveModeStartMessage& message) { return serializeImpl(message); }
 std::string serialize(const ScreenSnapshotMessage& message) { return serializeImpl(message); }
 std::string serialize(const ScreenDiffMessage& message) { return serializeImpl(message); }
+std::string serialize(const ScreenScrollMessage& message) { return serializeImpl(message); }
 std::string serialize(const InteractiveModeEndMessage& message) { return serializeImpl(message); }
 std::string serialize(const BlockScreenUpdateMessage& message) { return serializeImpl(message); }
+std::string serialize(const OutputSkippedMessage& message) { return serializeImpl(message); }
 std::string serialize(const AIChatMessage& message) { return serializeImpl(message); }
 std::string serialize(const GetChatHistoryMessage& message) { return serializeImpl(message); }
 std::string serialize(const AIChunkMessage& message) { return serializeImpl(message); }
@@ -978,6 +1058,76 @@ std::string serialize(const LLMProviderAddedMessage& message) { return serialize
 std::string serialize(const LLMProviderUpdatedMessage& message) { return serializeImpl(message); }
 std::string serialize(const LLMProviderDeletedMessage& message) { return serializeImpl(message); }
 
+// ============================================================================
+// Screen messages with pre-encoded rows
+// ============================================================================
+
+/**
+ * Dump message json with field given as raw JSON: the field is dumped as null placeholder
+ * and replaced, so key order and formatting match a plain dump
+ */
+static std::string dumpWithRawField(json j, const char* key, std::string_view rawValue) {
+    j[key] = nullptr;
+    std::string dumped = j.dump();
+    std::string placeholder = fmt::format("\"{}\":null", key);
+    size_t position = dumped.find(placeholder);
+    dumped.replace(position + placeholder.size() - 4, 4, rawValue);
+    return dumped;
+}
+
+static std::string encodeRowUpdates(const std::vector<EncodedRowUpdate>& updates) {
+    std::string result = "[";
+    for (const auto& update : updates) {
+        if (result.size() > 1) {
+            result += ',';
+        }
+        // Keys in the order json objects dump them
+        result += '{';
+        if (update.column) {
+            result += fmt::format("\"column\":{},", *update.column);
+        }
+        result += fmt::format("\"row\":{},\"segments\":", update.row);
+        result += update.segments;
+        result += '}';
+    }
+    result += ']';
+    return result;
+}
+
+template<typename T>
+static json screenMessageHeader(const T& message) {
+    return json{
+        {"type", T::type},
+        {"session_id", message.sessionId},
+        {"cursor_row", message.cursorRow},
+        {"cursor_column", message.cursorColumn}
+    };
+}
+
+std::string encodeSegments(const std::vector<StyledSegment>& segments) {
+    return json(segments).dump();
+}
+
+std::string serialize(const ScreenSnapshotMessage& message, const std::vector<std::string_view>& encodedLines) {
+    std::string lines = "[";
+    for (size_t i = 0; i < encodedLines.size(); ++i) {
+        if (i > 0) {
+            lines += ',';
+        }
+        lines += encodedLines[i];
+    }
+    lines += ']';
+    return dumpWithRawField(screenMessageHeader(message), "lines", lines);
+}
+
+std::string serialize(const ScreenDiffMessage& message, const std::vector<EncodedRowUpdate>& updates) {
+    return dumpWithRawField(screenMessageHeader(message), "updates", encodeRowUpdates(updates));
+}
+
+std::string serialize(const BlockScreenUpdateMessage& message, const std::vector<EncodedRowUpdate>& updates) {
+    return dumpWithRawField(screenMessageHeader(message), "updates", encodeRowUpdates(updates));
+}
+
 ClientMessage parseClientMessage(const std::string& jsonStr) {
     json j = json::parse(jsonStr);
     ClientMessage message;
@@ -0,0 +1,55 @@
+#include <catch2/catch_test_macros.hpp>
+#include <termihui/grapheme_table.h>
+
+using namespace termihui;
+
+TEST_CASE("GraphemeTable returns same id for equal clusters", "[GraphemeTable]") {
+    GraphemeTable table;
+    
+    char32_t accented = table.intern(U"e\u0301");
+    char32_t family = table.intern(U"\U0001F468\u200D\U0001F469");
+    
+    CHECK(GraphemeTable::isCluster(accented));
+    CHECK(GraphemeTable::isCluster(family));
+    CHECK_FALSE(GraphemeTable::isCluster(U'\U0010FFFF'));
+    CHECK(accented != family);
+    CHECK(table.intern(U"e\u0301") == accented);
+    CHECK(table.cluster(family) == U"\U0001F468\u200D\U0001F469");
+    CHECK(table.size() == 2);
+}
+
+TEST_CASE("GraphemeTable compact keeps used clusters and renumbers them", "[GraphemeTable]") {
+    GraphemeTable table;
+    
+    char32_t first = table.intern(U"a\u0301");
+    char32_t second = table.intern(U"b\u0301");
+    char32_t third = table.intern(U"c\u0301");
+    
+    auto remap = table.compact({false, true, true});
+    
+    CHECK(table.size() == 2);
+    CHECK(remap[first - GraphemeTable::firstId] == 0);
+    CHECK(remap[second - GraphemeTable::firstId] == GraphemeTable::firstId);
+    CHECK(table.cluster(remap[third - GraphemeTable::firstId]) == U"c\u0301");
+    CHECK(table.intern(U"b\u0301") == GraphemeTable::firstId);
+}
+
+TEST_CASE("GraphemeTable reports full instead of growing", "[GraphemeTable]") {
+    GraphemeTable table;
+    
+    std::u32string cluster = U"a\u0301\u0301";
+    size_t failed = 0;
+    for (size_t i = 0; i < GraphemeTable::capacity; ++i) {
+        cluster[0] = static_cast<char32_t>(0x4E00 + i);
+        failed += table.intern(cluster) == 0 ? 1 : 0;
+    }
+    
+    CHECK(failed == 0);
+    CHECK(table.full());
+    CHECK(table.intern(U"z\u0301") == 0);
+    CHECK(table.intern(cluster) != 0);
+    
+    table.clear();
+    CHECK(table.size() == 0);
+    CHECK(table.intern(U"z\u0301") == GraphemeTable::firstId);
+}
@@ -377,6 +377,76 @@ TEST_CASE("Grid2D single column grid", "[Grid2D][edge]") {
     CHECK(grid(4, 0) == 12);
 }
 
+// =============================================================================
+// Row Rotation Tests
+// =============================================================================
+
+static Grid2D<int> makeNumberedRows(size_t rows, size_t columns) {
+    Grid2D<int> grid(rows, columns);
+    for (size_t r = 0; r < rows; ++r) {
+        grid.fillRow(r, static_cast<int>(r));
+    }
+    return grid;
+}
+
+TEST_CASE("Grid2D rotateRows up moves logical rows", "[Grid2D][rotate]") {
+    Grid2D<int> grid = makeNumberedRows(4, 3);
+    
+    grid.rotateRows(1);
+    
+    CHECK(grid(0, 0) == 1);
+    CHECK(grid(2, 2) == 3);
+    CHECK(grid.at(3, 1) == 0); // Wrapped row keeps old content
+    CHECK(grid.rowPointer(1)[0] == 2);
+    CHECK(grid.rowOffset() == 1);
+}
+
+TEST_CASE("Grid2D rotateRows down and wrap-around", "[Grid2D][rotate]") {
+    Grid2D<int> grid = makeNumberedRows(4, 2);
+    
+    grid.rotateRows(-1);
+    CHECK(grid(0, 0) == 3);
+    CHECK(grid(1, 0) == 0);
+    
+    grid.rotateRows(9); // Same as 1 on 4 rows
+    CHECK(grid(0, 0) == 0);
+    CHECK(grid.rowOffset() == 0);
+}
+
+TEST_CASE("Grid2D fillRow uses logical rows after rotation", "[Grid2D][rotate]") {
+    Grid2D<int> grid = makeNumberedRows(3, 3);
+    
+    grid.rotateRows(2);
+    grid.fillRow(0, 9);
+    grid.fillRowRange(2, 1, 3, 8);
+    
+    CHECK(grid(0, 0) == 9);
+    CHECK(grid(1, 0) == 0);
+    CHECK(grid(2, 0) == 1);
+    CHECK(grid(2, 2) == 8);
+}
+
+TEST_CASE("Grid2D resize after rotation keeps logical order", "[Grid2D][rotate][resize]") {
+    Grid2D<int> grid = makeNumberedRows(3, 2);
+    grid.rotateRows(1);
+    
+    SECTION("Same columns") {
+        grid.resize(4, 2);
+        CHECK(grid(0, 0) == 1);
+        CHECK(grid(1, 0) == 2);
+        CHECK(grid(2, 0) == 0);
+    }
+    
+    SECTION("Different columns with default value") {
+        grid.resize(2, 3, -1);
+        CHECK(grid(0, 0) == 1);
+        CHECK(grid(1, 1) == 2);
+        CHECK(grid(1, 2) == -1);
+    }
+    
+    CHECK(grid.rowOffset() == 0);
+}
+
 // =============================================================================
 // Struct Cell Example (simulating terminal cell)
 // =============================================================================
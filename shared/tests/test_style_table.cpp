@@ -0,0 +1,58 @@
+#include <catch2/catch_test_macros.hpp>
+#include <termihui/style_table.h>
+
+using namespace termihui;
+
+TEST_CASE("StyleTable starts with default style", "[StyleTable]") {
+    StyleTable table;
+    
+    CHECK(table.size() == 1);
+    CHECK(table.style(StyleTable::defaultStyleId) == TextStyle{});
+    CHECK(table.intern(TextStyle{}) == StyleTable::defaultStyleId);
+}
+
+TEST_CASE("StyleTable returns same id for equal styles", "[StyleTable]") {
+    StyleTable table;
+    
+    TextStyle red;
+    red.foreground = Color::standard(1);
+    TextStyle boldRed = red;
+    boldRed.bold = true;
+    
+    StyleId redId = table.intern(red);
+    StyleId boldRedId = table.intern(boldRed);
+    
+    CHECK(redId != StyleTable::defaultStyleId);
+    CHECK(boldRedId != redId);
+    CHECK(table.intern(red) == redId);
+    CHECK(table.style(boldRedId) == boldRed);
+    CHECK(table.size() == 3);
+}
+
+TEST_CASE("StyleTable compact keeps used styles and renumbers them", "[StyleTable]") {
+    StyleTable table;
+    
+    std::vector<StyleId> ids;
+    for (int i = 0; i < 4; ++i) {
+        TextStyle style;
+        style.foreground = Color::indexed(100 + i);
+        ids.push_back(table.intern(style));
+    }
+    
+    std::vector<bool> used(table.size(), false);
+    used[ids[1]] = true;
+    used[ids[3]] = true;
+    std::vector<StyleId> remap = table.compact(used);
+    
+    CHECK(table.size() == 3);
+    CHECK(remap[ids[0]] == StyleTable::defaultStyleId);
+    CHECK(table.style(remap[ids[1]]).foreground == Color::indexed(101));
+    CHECK(table.style(remap[ids[3]]).foreground == Color::indexed(103));
+    
+    // Index is rebuilt: interning a kept style finds it, a dropped one is added again
+    TextStyle style;
+    style.foreground = Color::indexed(103);
+    CHECK(table.intern(style) == remap[ids[3]]);
+    style.foreground = Color::indexed(100);
+    CHECK(table.intern(style) == 3);
+}
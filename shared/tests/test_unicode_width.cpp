@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <termihui/unicode_width.h>
+#include <string>
+#include <vector>
+
+using namespace termihui::unicode;
+
+namespace {
+
+/**
+ * Count grapheme clusters of text
+ */
+size_t countClusters(std::u32string_view text) {
+    GraphemeSegmenter segmenter;
+    size_t count = 0;
+    for (char32_t codepoint : text) {
+        count += segmenter.isBoundary(codepoint) ? 1 : 0;
+    }
+    return count;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Unicode tables match property ranges for every codepoint", "[unicode]") {
+    std::vector<uint8_t> expected(0x110000, detail::defaultEntry);
+    for (const auto& range : detail::propertyRanges) {
+        for (char32_t codepoint = range.first; codepoint <= range.last; ++codepoint) {
+            expected[codepoint] = detail::packEntry(range.width, range.property);
+        }
+    }
+    
+    size_t mismatches = 0;
+    for (char32_t codepoint = 0; codepoint < 0x110000; ++codepoint) {
+        mismatches += propertyEntry(codepoint) != expected[codepoint] ? 1 : 0;
+    }
+    CHECK(mismatches == 0);
+    CHECK(detail::tables.blockCount < detail::maxBlocks);
+}
+
+TEST_CASE("Unicode width of common characters", "[unicode]") {
+    CHECK(width(U'a') == 1);
+    CHECK(width(U'\u044F') == 1);             // Cyrillic ya
+    CHECK(width(U'\u3042') == 2);             // Hiragana a
+    CHECK(width(U'\uAC00') == 2);             // Hangul syllable
+    CHECK(width(U'\U0001F600') == 2);         // Emoji
+    CHECK(width(U'\u0301') == 0);             // Combining acute accent
+    CHECK(width(U'\u200B') == 0);             // Zero width space
+    CHECK(width(U'\u00AD') == 1);             // Soft hyphen
+    CHECK(width(U'\U00030000') == 2);         // Unassigned, but in CJK extension plane
+    CHECK(width(char32_t{0x110000}) == 1);
+}
+
+TEST_CASE("Grapheme segmenter joins combining marks and Hangul jamo", "[unicode]") {
+    CHECK(countClusters(U"e\u0301") == 1);
+    CHECK(countClusters(U"e\u0301a") == 2);
+    CHECK(countClusters(U"\u1100\u1161\u11A8") == 1);   // L V T
+    CHECK(countClusters(U"\r\n") == 1);
+    CHECK(countClusters(U"\n\u0301") == 2);
+}
+
+TEST_CASE("Grapheme segmenter handles emoji sequences and flags", "[unicode]") {
+    CHECK(countClusters(U"\U0001F468\u200D\U0001F469\u200D\U0001F467") == 1);
+    CHECK(countClusters(U"\U0001F44D\U0001F3FD") == 1);           // Skin tone modifier
+    CHECK(countClusters(U"a\u200D\U0001F469") == 2);              // ZWJ after non-pictographic
+    CHECK(countClusters(U"\U0001F1E9\U0001F1EA\U0001F1EB\U0001F1F7") == 2);
+    CHECK(countClusters(U"\U0001F1E9\U0001F1EA\U0001F1EB") == 2);
+}
+
+TEST_CASE("Grapheme segmenter reset", "[unicode]") {
+    GraphemeSegmenter segmenter;
+    CHECK(segmenter.isBoundary(U'a'));
+    CHECK_FALSE(segmenter.isBoundary(U'\u0301'));
+    
+    segmenter.reset();
+    CHECK(segmenter.isBoundary(U'\u0301'));
+    
+    segmenter.reset(GraphemeProperty::Other);
+    CHECK_FALSE(segmenter.isBoundary(U'\u0301'));
+}
@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include <termihui/utf8.h>
+#include <string>
+
+using namespace termihui;
+
+namespace {
+
+/**
+ * Decode byte by byte with the resumable decoder, dropping invalid bytes
+ */
+std::u32string decodeBytewise(std::string_view data) {
+    utf8::Decoder decoder;
+    std::u32string codepoints;
+    for (char ch : data) {
+        auto byte = static_cast<unsigned char>(ch);
+        char32_t codepoint = 0;
+        auto result = decoder.feed(byte, codepoint);
+        if (result == utf8::Decoder::Result::Interrupted) {
+            result = decoder.feed(byte, codepoint);
+        }
+        if (result == utf8::Decoder::Result::Complete) {
+            codepoints.push_back(codepoint);
+        }
+    }
+    return codepoints;
+}
+
+} // anonymous namespace
+
+TEST_CASE("utf8 decodes sequences of every length", "[utf8]") {
+    std::string text = "a\xD0\x9F\xE2\x82\xAC\xF0\x9F\x98\x80";
+    std::u32string codepoints;
+
+    CHECK(utf8::decode(text, codepoints) == text.size());
+    CHECK(codepoints == U"a\u041F\u20AC\U0001F600");
+    CHECK(decodeBytewise(text) == codepoints);
+}
+
+TEST_CASE("utf8 rejects malformed sequences", "[utf8]") {
+    char32_t codepoint = 0;
+
+    CHECK(utf8::decode("\xC0\xAF", 2, codepoint) == 0);          // overlong '/'
+    CHECK(utf8::decode("\xE0\x80\xAF", 3, codepoint) == 0);      // overlong '/'
+    CHECK(utf8::decode("\xF0\x80\x80\xAF", 4, codepoint) == 0);  // overlong '/'
+    CHECK(utf8::decode("\xED\xA0\x80", 3, codepoint) == 0);      // surrogate U+D800
+    CHECK(utf8::decode("\xF4\x90\x80\x80", 4, codepoint) == 0);  // U+110000
+    CHECK(utf8::decode("\xE2\x28\xA1", 3, codepoint) == 0);      // bad continuation
+    CHECK(utf8::decode("\xE2\x82", 2, codepoint) == 0);          // incomplete
+
+    // Decoding stops before the first bad sequence, also after a long ASCII run
+    std::string text = std::string(40, 'x') + "\xC3\xA9\xC3(";
+    std::u32string codepoints;
+    CHECK(utf8::decode(text, codepoints) == 42);
+    CHECK(codepoints.size() == 41);
+}
+
+TEST_CASE("utf8 decoding stops at ASCII the scanner rejects", "[utf8]") {
+    // Like a terminal parser taking printable text only: control bytes end the run
+    auto printableLength = [](const char* data, size_t size) {
+        size_t i = 0;
+        while (i < size && data[i] >= 0x20 && data[i] < 0x7F) {
+            ++i;
+        }
+        return i;
+    };
+    std::string text = "ab\xC3\xA9" "cd\r\n\xC3\xA9";
+    std::u32string codepoints;
+
+    CHECK(utf8::decode(text, codepoints, printableLength) == 6);
+    CHECK(codepoints == U"ab\u00E9cd");
+}
+
+TEST_CASE("utf8 finds sequence cut off at end", "[utf8]") {
+    CHECK(utf8::completeLength("") == 0);
+    CHECK(utf8::completeLength("abc") == 3);
+    CHECK(utf8::completeLength("ab\xD0") == 2);
+    CHECK(utf8::completeLength("ab\xE2\x82") == 2);
+    CHECK(utf8::completeLength("ab\xF0\x9F\x98") == 2);
+    CHECK(utf8::completeLength("ab\xE2\x82\xAC") == 5);
+
+    // Bytes that can't become valid are not held back
+    CHECK(utf8::completeLength("ab\xFF") == 3);
+    CHECK(utf8::completeLength("ab\xE0\x80") == 4);
+    CHECK(utf8::completeLength("ab\x80\x80\x80\x80") == 6);
+}
+
+TEST_CASE("utf8 decoder resumes sequence split across pieces", "[utf8]") {
+    utf8::Decoder decoder;
+    char32_t codepoint = 0;
+
+    CHECK(decoder.feed(0xF0, codepoint) == utf8::Decoder::Result::Pending);
+    CHECK(decoder.feed(0x9F, codepoint) == utf8::Decoder::Result::Pending);
+    CHECK(decoder.pending());
+    CHECK(decoder.feed(0x98, codepoint) == utf8::Decoder::Result::Pending);
+    CHECK(decoder.feed(0x80, codepoint) == utf8::Decoder::Result::Complete);
+    CHECK(codepoint == U'\U0001F600');
+    CHECK_FALSE(decoder.pending());
+
+    // Byte that doesn't fit is handed back, the sequence is gone
+    CHECK(decoder.feed(0xE2, codepoint) == utf8::Decoder::Result::Pending);
+    CHECK(decoder.feed('x', codepoint) == utf8::Decoder::Result::Interrupted);
+    CHECK_FALSE(decoder.pending());
+    CHECK(decoder.feed('x', codepoint) == utf8::Decoder::Result::Complete);
+    CHECK(decoder.feed(0x80, codepoint) == utf8::Decoder::Result::Invalid);
+}
+
+TEST_CASE("utf8 encodes what it decodes", "[utf8]") {
+    std::u32string codepoints = U"a\x7F\x80\u07FF\u0800\uFFFD\U00010000\U0010FFFF";
+    std::string text;
+    for (char32_t codepoint : codepoints) {
+        utf8::append(text, codepoint);
+    }
+
+    CHECK(text.size() == 1 + 1 + 2 + 2 + 3 + 3 + 4 + 4);
+    std::u32string decoded;
+    CHECK(utf8::decode(text, decoded) == text.size());
+    CHECK(decoded == codepoints);
+}